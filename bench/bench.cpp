@@ -0,0 +1,385 @@
+/*
+* Benchmarks for SSDE (http://github.com/notnanocat/ssde).
+* This file is not a subject to license, feel free to use it in any way
+* You wish.
+*/
+#include "../ssde/ssde_x86.hpp"
+#include "../ssde/ssde_x64.hpp"
+#include "../ssde/ssde_sweep.hpp"
+#include "../ssde/ssde_descent.hpp"
+#include "../ssde/ssde_functions.hpp"
+#include "../ssde/ssde_cache.hpp"
+#include "../ssde/ssde_file.hpp"
+#include "../ssde/ssde_stream.hpp"
+#include "../ssde/ssde_pipeline.hpp"
+#include "../ssde/ssde_range.hpp"
+#include "../ssde/ssde_operands.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <memory>
+
+
+/* -- time a linear sweep over the buffer, returns instructions per second - */
+template <class sweep>
+static double measure(const char *name, size_t size, int rounds, sweep f)
+{
+	using namespace std;
+	using namespace std::chrono;
+
+	size_t count = 0;
+
+	auto start = steady_clock::now();
+
+	for (int r = 0; r < rounds; ++r)
+		count += f();
+
+	double seconds = duration<double>(steady_clock::now() - start).count();
+	double ips     = count / seconds;
+
+	cout << left << setw(30) << name
+	     << right << setw(12) << fixed << setprecision(2) << ips / 1e6 << " Minsn/s"
+	     << setw(12) << setprecision(2) << seconds * 1e9 / count << " ns/insn"
+	     << setw(10) << setprecision(1) << size * rounds / seconds / 1e6 << " MB/s\n";
+
+	return ips;
+}
+
+template <class arch>
+static void bench_arch(const char *name, const std::string &code, size_t size, int rounds)
+{
+	using namespace std;
+
+	const uint8_t *data = reinterpret_cast<const uint8_t *>(code.data());
+
+	measure((string(name) + " ssde::dec()").c_str(), size, rounds, [&]() -> size_t
+	{
+		size_t count = 0;
+
+		arch  impl(data, size);
+		ssde &dis = impl;
+
+		/* goes through the vtable, like code written against ssde does */
+		for (; dis.dec(); dis.next())
+			++count;
+
+		return count;
+	});
+
+	double full = measure((string(name) + " dec()").c_str(), size, rounds, [&]() -> size_t
+	{
+		size_t count = 0;
+
+		for (arch dis(data, size); dis.dec(); dis.next())
+			++count;
+
+		return count;
+	});
+
+	/* a new disassembler per instruction, as a thread per request would do */
+	arch       owning(string(code, 0, size));
+	ssde_image image(data, size);
+
+	measure((string(name) + " copy per insn").c_str(), size, rounds, [&]() -> size_t
+	{
+		size_t count = 0;
+
+		for (size_t ip = 0; ip < size; ++count)
+		{
+			arch dis(owning);
+
+			dis.ip = ip;
+			dis.dec();
+
+			ip += dis.length;
+		}
+
+		return count;
+	});
+
+	measure((string(name) + " ssde_image per insn").c_str(), size, rounds, [&]() -> size_t
+	{
+		size_t count = 0;
+
+		for (size_t ip = 0; ip < size; ++count)
+		{
+			arch dis(image, ip);
+
+			dis.dec();
+
+			ip += dis.length;
+		}
+
+		return count;
+	});
+
+	measure((string(name) + " ssde_stream, 4 KB chunks").c_str(), size, rounds, [&]() -> size_t
+	{
+		size_t count = 0;
+
+		ssde_stream<arch> stream;
+
+		for (size_t at = 0; at < size; at += 4096)
+		{
+			stream.feed(data + at, min<size_t>(size - at, 4096));
+
+			while (stream.dec())
+				++count;
+		}
+
+		stream.finish();
+
+		while (stream.dec())
+			++count;
+
+		return count;
+	});
+
+	measure((string(name) + " ssde_pipeline").c_str(), size, rounds, [&]() -> size_t
+	{
+		size_t count = 0;
+
+		unique_ptr<ssde_pipeline<arch>> pipeline(new ssde_pipeline<arch>());
+
+		pipeline->run(data, size, [&](const ssde_record &)
+		{
+			++count;
+		});
+
+		return count;
+	});
+
+	measure((string(name) + " ssde_range").c_str(), size, rounds, [&]() -> size_t
+	{
+		arch dis(image);
+
+		ssde_range<arch> range(dis);
+
+		return distance(range.begin(), range.end());
+	});
+
+	measure((string(name) + " decode<length>()").c_str(), size, rounds, [&]() -> size_t
+	{
+		size_t count = 0;
+
+		for (arch dis(data, size); dis.template decode<ssde::fields::length>(); dis.next())
+			++count;
+
+		return count;
+	});
+
+	measure((string(name) + " decode<length|rel>()").c_str(), size, rounds, [&]() -> size_t
+	{
+		size_t count = 0;
+
+		for (arch dis(data, size); dis.template decode<ssde::fields::length | ssde::fields::rel>(); dis.next())
+			++count;
+
+		return count;
+	});
+
+	measure((string(name) + " decode<modrm|sib|disp>()").c_str(), size, rounds, [&]() -> size_t
+	{
+		size_t count = 0;
+
+		for (arch dis(data, size); dis.template decode<ssde::fields::modrm | ssde::fields::sib | ssde::fields::disp>(); dis.next())
+			++count;
+
+		return count;
+	});
+
+	size_t operands = 0;
+
+	measure((string(name) + " dec() + ssde_operands").c_str(), size, rounds, [&]() -> size_t
+	{
+		size_t count = 0;
+
+		for (arch dis(data, size); dis.dec(); dis.next(), ++count)
+			operands += ssde_operands<arch>(dis).size();
+
+		return count;
+	});
+
+	ssde_cache<arch> cache;
+
+	measure((string(name) + " ssde_cache::dec()").c_str(), size, rounds, [&]() -> size_t
+	{
+		size_t count = 0;
+
+		for (arch dis(data, size); cache.dec(dis); dis.next())
+			++count;
+
+		return count;
+	});
+
+	cout << name << " ssde_cache hit rate: " << setprecision(2)
+	     << 100.0 * cache.stats.hits / (cache.stats.hits + cache.stats.misses) << "%\n";
+
+	double fast = measure((string(name) + " length_at()").c_str(), size, rounds, [&]() -> size_t
+	{
+		size_t count = 0;
+
+		for (size_t ip = 0; ip < size; ip += arch::length_at(data + ip))
+			++count;
+
+		return count;
+	});
+
+	cout << name << " length_at() speedup: " << setprecision(2) << fast / full << "x\n";
+
+	double split = measure((string(name) + " ssde_sweep()").c_str(), size, rounds, [&]() -> size_t
+	{
+		return ssde_sweep(arch(data, size)).size();
+	});
+
+	cout << name << " ssde_sweep() speedup: " << setprecision(2) << split / full
+	     << "x on " << thread::hardware_concurrency() << " threads\n";
+
+	measure((string(name) + " ssde_chunks").c_str(), size, rounds, [&]() -> size_t
+	{
+		arch dis(image);
+
+		ssde_chunks<arch> chunks(dis);
+
+		atomic<size_t> next(0), count(0);
+
+		auto work = [&]()
+		{
+			for (size_t i; (i = next.fetch_add(1)) < chunks.size(); )
+				count += distance(chunks[i].begin(), chunks[i].end());
+		};
+
+		vector<thread> workers;
+
+		for (unsigned t = 1; t < thread::hardware_concurrency(); ++t)
+			workers.emplace_back(work);
+
+		work();
+
+		for (auto &worker : workers)
+			worker.join();
+
+		return count;
+	});
+
+	/* there are no symbols to go by, so every page is an entry */
+	vector<size_t> entries;
+
+	for (size_t ip = 0; ip < size; ip += 4096)
+		entries.push_back(ip);
+
+	measure((string(name) + " ssde_descent()").c_str(), size, rounds, [&]() -> size_t
+	{
+		return ssde_descent(arch(data, size), entries).size();
+	});
+
+	measure((string(name) + " ssde_functions()").c_str(), size, rounds, [&]() -> size_t
+	{
+		return ssde_functions(arch(data, size)).size();
+	});
+
+	/* every offset rather than a sweep, "insn" is an offset here */
+	vector<uint8_t> lengths(size);
+
+	double each = measure((string(name) + " dec() each offset").c_str(), size, rounds, [&]() -> size_t
+	{
+		arch dis(data, size);
+
+		for (size_t ip = 0; ip < size; ++ip)
+		{
+			dis.ip = ip;
+			dis.dec();
+			lengths[ip] = dis.length;
+		}
+
+		return size;
+	});
+
+	double map = measure((string(name) + " length_map()").c_str(), size, rounds, [&]() -> size_t
+	{
+		arch::length_map(data, size, lengths.data());
+
+		return size;
+	});
+
+	cout << name << " length_map() speedup: " << setprecision(2) << map / each << "x\n\n";
+}
+
+/* -- linear sweep of every executable section of a file, on threads ------ */
+template <class arch>
+static size_t sweep_sections(const ssde_file &file)
+{
+	std::atomic<size_t> count(0);
+
+	ssde_for_each_section<arch>(file, [&](arch &dis, const ssde_section &)
+	{
+		size_t n = 0;
+
+		for (; dis.dec(); dis.next())
+			++n;
+
+		count += n;
+	});
+
+	return count;
+}
+
+
+int main(int argc, const char *argv[])
+{
+	using namespace std;
+
+	ios_base::sync_with_stdio(false);
+
+	const char *path   = argc > 1 ? argv[1] : "/bin/ls";
+	int         rounds = argc > 2 ? atoi(argv[2]) : 10;
+
+	ifstream file(path, ios::binary);
+
+	if (!file)
+	{
+		cerr << "can't open " << path << '\n';
+		return 1;
+	}
+
+	stringstream ss;
+	ss << file.rdbuf();
+
+	string code = ss.str();
+	size_t size = code.size();
+
+	/* unchecked length_at() may read up to ssde::window bytes past the last instruction */
+	code.append(ssde::window, '\0');
+
+	cout << path << ": " << size << " bytes, " << rounds << " rounds\n\n";
+
+	bench_arch<ssde_x86>("x86", code, size, rounds);
+	bench_arch<ssde_x64>("x64", code, size, rounds);
+
+	ssde_file image(path);
+
+	if (image.format != ssde_file::format_none)
+		/* executable sections only, decoded in place at their addresses */
+	{
+		size_t text = 0;
+
+		for (auto &section : image.sections)
+			text += section.size;
+
+		cout << path << ": " << image.sections.size() << " executable sections, " << text << " bytes\n\n";
+
+		measure("ssde_for_each_section()", text, rounds, [&]() -> size_t
+		{
+			return image.x64 ? sweep_sections<ssde_x64>(image) : sweep_sections<ssde_x86>(image);
+		});
+	}
+
+	return 0;
+}
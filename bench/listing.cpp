@@ -0,0 +1,259 @@
+/*
+* Listing benchmark for SSDE (http://github.com/notnanocat/ssde): text of
+* every instruction of a file, against objdump -d of the same file.
+* This file is not a subject to license, feel free to use it in any way
+* You wish.
+*
+*   listing [--att] [--print] [rounds] [file]
+*
+* The file defaults to /bin/bash. Each round lists its executable
+* sections, address, bytes and text of an instruction a line as objdump
+* does, through one buffer that is written out to /dev/null (stdout with
+* --print) whenever it fills up; best of rounds is reported. objdump -d
+* of the file, with its output to /dev/null, is timed the same way when
+* it's there.
+*/
+#include "../ssde/ssde_x86.hpp"
+#include "../ssde/ssde_x64.hpp"
+#include "../ssde/ssde_file.hpp"
+#include "../ssde/ssde_format.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+
+
+static const size_t max_length = 15;    // Longest X86 instruction, in bytes.
+
+
+/* -- output buffer, written out once it fills up -------------------------- */
+struct listing_out
+{
+	enum : size_t { capacity = 1 << 16 };
+
+	FILE   *file;
+	char    buffer[capacity];
+	size_t  used  = 0;
+	size_t  total = 0;                      // Bytes written, for throughput.
+
+	explicit listing_out(FILE *file) :
+		file(file)
+	{
+	}
+
+	char *reserve(size_t size)              // Room for size more bytes.
+	{
+		if (capacity - used < size)
+			flush();
+
+		return buffer + used;
+	}
+
+	void commit(size_t size)
+	{
+		used  += size;
+		total += size;
+	}
+
+	void flush()
+	{
+		if (file != nullptr)
+			fwrite(buffer, 1, used, file);
+
+		used = 0;
+	}
+};
+
+/* 16 hex digits at most, without leading zeros, as objdump writes addresses */
+static size_t put_address(char *text, uint64_t address)
+{
+	static const char digits[] = "0123456789abcdef";
+
+	char   buffer[16];
+	size_t n = 0;
+
+	do
+	{
+		buffer[n++] = digits[address & 0x0f];
+		address >>= 4;
+	}
+	while (address != 0);
+
+	for (size_t i = 0; i < n; ++i)
+		text[i] = buffer[n - 1 - i];
+
+	return n;
+}
+
+template <class arch>
+static size_t list_section(const ssde_section &section, listing_out &out, uint8_t syntax)
+{
+	size_t lines = 0;
+
+	for (arch dis(section.image()); dis.dec(); dis.next())
+	{
+		/* "  address:\tbytes\ttext\n" */
+		char  *line = out.reserve(4 + 16 + 3 * max_length + ssde_format::max_text);
+		size_t n    = 0;
+
+		line[n++] = ' ';
+		line[n++] = ' ';
+		n += put_address(line + n, section.address + dis.ip);
+		line[n++] = ':';
+		line[n++] = '\t';
+		n += ssde_format::bytes(section.data + dis.ip, std::min<size_t>(dis.length, section.size - dis.ip), line + n, 3 * max_length);
+		line[n++] = '\t';
+		n += ssde_format::format(dis, line + n, ssde_format::max_text, syntax);
+		line[n++] = '\n';
+
+		out.commit(n);
+		++lines;
+	}
+
+	return lines;
+}
+
+static size_t list_file(const ssde_file &file, listing_out &out, uint8_t syntax)
+{
+	size_t lines = 0;
+
+	for (auto &section : file.sections)
+	{
+		lines += file.x64 ? list_section<ssde_x64>(section, out, syntax)
+		                  : list_section<ssde_x86>(section, out, syntax);
+	}
+
+	out.flush();
+
+	return lines;
+}
+
+
+int main(int argc, const char *argv[])
+{
+	using namespace std;
+	using namespace std::chrono;
+
+	ios_base::sync_with_stdio(false);
+
+	uint8_t syntax = ssde_format::syntax_intel;
+	bool    print  = false;
+	int     rounds = 5;
+	string  path   = "/bin/bash";
+
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "--att") == 0)
+			syntax = ssde_format::syntax_att;
+		else if (strcmp(argv[i], "--print") == 0)
+			print = true;
+		else if (atoi(argv[i]) > 0)
+			rounds = atoi(argv[i]);
+		else
+			path = argv[i];
+	}
+
+	ssde_file file;
+
+	if (!file.open(path.c_str()))
+	{
+		cerr << path << ": " << file.error << endl;
+		return 1;
+	}
+
+	if (print)
+	{
+		listing_out out(stdout);
+
+		list_file(file, out, syntax);
+		return 0;
+	}
+
+	FILE *null = fopen("/dev/null", "wb");
+
+	double best_text  = 0.0;                // Seconds, text into the buffer alone.
+	double best_write = 0.0;                // Seconds, written out to /dev/null.
+	size_t lines      = 0;
+	size_t bytes      = 0;
+
+	for (int round = 0; round < rounds; ++round)
+	{
+		for (int write = 0; write < 2; ++write)
+		{
+			listing_out out(write && null != nullptr ? null : nullptr);
+
+			auto start = steady_clock::now();
+
+			lines = list_file(file, out, syntax);
+			bytes = out.total;
+
+			double seconds = duration<double>(steady_clock::now() - start).count();
+			double &best   = write ? best_write : best_text;
+
+			if (round == 0 || seconds < best)
+				best = seconds;
+		}
+	}
+
+	if (null != nullptr)
+		fclose(null);
+
+	cout << fixed << setprecision(1);
+	cout << path << ": " << lines << " instructions, " << bytes / 1024 << " KiB of "
+	     << (syntax == ssde_format::syntax_att ? "AT&T" : "Intel") << " text, best of " << rounds << endl;
+
+	/* throughput of text is only told for ours, objdump writes its own */
+	auto report = [&](const char *what, double seconds, bool text)
+	{
+		cout << "  " << left << setw(24) << what << right
+		     << setw(10) << seconds * 1e3 << " ms"
+		     << setw(10) << lines / seconds / 1e6 << " M insn/s";
+
+		if (text)
+			cout << setw(10) << bytes / seconds / (1 << 20) << " MiB/s";
+
+		cout << endl;
+	};
+
+	report("ssde_format", best_text, true);
+	report("ssde_format > /dev/null", best_write, true);
+
+	/* objdump is run through the shell, with the same syntax */
+	string command = string("objdump -d -w ") + (syntax == ssde_format::syntax_att ? "" : "-M intel ") +
+	                 "'" + path + "' > /dev/null 2>&1";
+
+	if (system("objdump --version > /dev/null 2>&1") != 0)
+	{
+		cout << "  objdump is not there" << endl;
+		return 0;
+	}
+
+	double best_objdump = 0.0;
+
+	for (int round = 0; round < rounds; ++round)
+	{
+		auto start = steady_clock::now();
+
+		if (system(command.c_str()) != 0)
+			break;
+
+		double seconds = duration<double>(steady_clock::now() - start).count();
+
+		if (round == 0 || seconds < best_objdump)
+			best_objdump = seconds;
+	}
+
+	if (best_objdump > 0.0)
+	{
+		report("objdump -d > /dev/null", best_objdump, false);
+
+		cout << "  ssde_format is " << setprecision(1) << best_objdump / best_write << "x as fast" << endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,534 @@
+/*
+* Benchmark suite for SSDE (http://github.com/notnanocat/ssde): decoding
+* speed of synthetic instruction mixes and of code of real files.
+* This file is not a subject to license, feel free to use it in any way
+* You wish.
+*
+*   suite [--json] [rounds] [file...]
+*
+* Files default to a few of /bin and libc, their executable sections are
+* decoded by the disassembler of their architecture. Every corpus is run
+* through each decode stage, from length_at() up to a full dec(), best of
+* rounds is reported.
+*/
+#include "../ssde/ssde_x86.hpp"
+#include "../ssde/ssde_x64.hpp"
+#include "../ssde/ssde_file.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define SUITE_TSC
+#endif
+
+
+/* -- time stamp counter, 0 where there is none ---------------------------- */
+static uint64_t cycles()
+{
+#ifdef SUITE_TSC
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+
+/* -- xorshift, synthetic corpora are the same from run to run ------------- */
+struct random_bytes
+{
+	uint32_t state = 2463534242u;
+
+	uint32_t operator()(uint32_t n)         // Random number in [0, n).
+	{
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+
+		return state % n;
+	}
+};
+
+
+/* -- synthetic corpora, each a generator of one instruction --------------- */
+typedef void (*generator)(std::string &out, random_bytes &rnd, bool x64);
+
+static const uint8_t legacy_prefixes[] = { 0x66, 0x67, 0xf2, 0xf3, 0x2e, 0x3e, 0x26, 0x36, 0x64, 0x65 };
+
+static void put(std::string &out, uint8_t byte)
+{
+	out.push_back(static_cast<char>(byte));
+}
+
+static void put32(std::string &out, uint32_t value)
+{
+	for (int i = 0; i < 4; ++i)
+		put(out, static_cast<uint8_t>(value >> i*8));
+}
+
+/* 1 to 4 legacy prefixes on plain ALU and MOV instructions */
+static void gen_prefixes(std::string &out, random_bytes &rnd, bool)
+{
+	static const uint8_t ops[] = { 0x01, 0x03, 0x29, 0x31, 0x89, 0x8b };
+
+	for (uint32_t n = 1 + rnd(4); n != 0; --n)
+		put(out, legacy_prefixes[rnd(sizeof(legacy_prefixes))]);
+
+	if (rnd(8) == 0)
+	{
+		put(out, 0x90);
+		return;
+	}
+
+	put(out, ops[rnd(sizeof(ops))]);
+	put(out, static_cast<uint8_t>(0xc0 | rnd(64)));
+}
+
+/* AVX (2 and 3 byte VEX) and AVX-512 (EVEX) arithmetic on registers */
+static void gen_vex(std::string &out, random_bytes &rnd, bool)
+{
+	static const uint8_t ops[] = { 0x54, 0x57, 0x58, 0x59, 0x5c, 0x5e };
+
+	/* vvvv is inverted, registers 0-7 keep the top bits set, which X86 needs */
+	uint8_t vvvv = static_cast<uint8_t>(~rnd(8) & 0x0f);
+
+	switch (rnd(3))
+	{
+	case 0:
+		/* vaddps and co, C5 */
+		put(out, 0xc5);
+		put(out, static_cast<uint8_t>(0x80 | vvvv << 3 | rnd(2) << 2));
+		put(out, ops[rnd(sizeof(ops))]);
+		break;
+
+	case 1:
+		/* vfmadd231ps, C4 map 0F38 */
+		put(out, 0xc4);
+		put(out, 0xe2);
+		put(out, static_cast<uint8_t>(vvvv << 3 | rnd(2) << 2 | 0x01));
+		put(out, 0xb8);
+		break;
+
+	default:
+		/* vaddps and co on zmm with a mask, 62 */
+		put(out, 0x62);
+		put(out, 0xf1);
+		put(out, static_cast<uint8_t>(vvvv << 3 | 0x04));
+		put(out, static_cast<uint8_t>(rnd(3) << 5 | 0x08 | rnd(8)));
+		put(out, ops[rnd(sizeof(ops))]);
+		break;
+	}
+
+	put(out, static_cast<uint8_t>(0xc0 | rnd(64)));
+}
+
+/* memory operands with SIB and disp32 */
+static void gen_sib(std::string &out, random_bytes &rnd, bool)
+{
+	static const uint8_t ops[] = { 0x03, 0x2b, 0x89, 0x8b, 0x8d };
+
+	put(out, ops[rnd(sizeof(ops))]);
+	put(out, static_cast<uint8_t>(0x84 | rnd(8) << 3));
+	put(out, static_cast<uint8_t>(rnd(256)));
+	put32(out, rnd(0xffffffff));
+}
+
+/* wide immediates: MOV r64, imm64 in X86-64, MOV r32, imm32 and MOV m32, imm32 in X86 */
+static void gen_imm(std::string &out, random_bytes &rnd, bool x64)
+{
+	if (x64)
+	{
+		put(out, static_cast<uint8_t>(0x48 | rnd(2)));
+		put(out, static_cast<uint8_t>(0xb8 | rnd(8)));
+		put32(out, rnd(0xffffffff));
+		put32(out, rnd(0xffffffff));
+	}
+	else if (rnd(2) == 0)
+	{
+		put(out, static_cast<uint8_t>(0xb8 | rnd(8)));
+		put32(out, rnd(0xffffffff));
+	}
+	else
+	{
+		/* [reg + disp32], rm 4 would take a SIB */
+		uint8_t rm = static_cast<uint8_t>(rnd(8));
+
+		put(out, 0xc7);
+		put(out, static_cast<uint8_t>(0x80 | (rm == 4 ? 0 : rm)));
+		put32(out, rnd(0x10000));
+		put32(out, rnd(0xffffffff));
+	}
+}
+
+/* relative branches: CALL, JMP and Jcc, rel8 and rel32 */
+static void gen_rel(std::string &out, random_bytes &rnd, bool)
+{
+	switch (rnd(5))
+	{
+	case 0:
+		put(out, 0xe8);
+		put32(out, rnd(0x10000) - 0x8000);
+		break;
+
+	case 1:
+		put(out, 0xe9);
+		put32(out, rnd(0x10000) - 0x8000);
+		break;
+
+	case 2:
+		put(out, 0x0f);
+		put(out, static_cast<uint8_t>(0x80 | rnd(16)));
+		put32(out, rnd(0x10000) - 0x8000);
+		break;
+
+	case 3:
+		put(out, 0xeb);
+		put(out, static_cast<uint8_t>(rnd(256)));
+		break;
+
+	default:
+		put(out, static_cast<uint8_t>(0x70 | rnd(16)));
+		put(out, static_cast<uint8_t>(rnd(256)));
+		break;
+	}
+}
+
+/* 14 prefixes on a NOP, the longest valid instruction, every 4th one with a 15th making it invalid */
+static void gen_prefix14(std::string &out, random_bytes &rnd, bool)
+{
+	for (uint32_t n = rnd(4) == 0 ? 15 : 14; n != 0; --n)
+		put(out, legacy_prefixes[rnd(sizeof(legacy_prefixes))]);
+
+	put(out, 0x90);
+}
+
+static std::string synthesize(generator gen, bool x64, size_t size)
+{
+	std::string out;
+	random_bytes rnd;
+
+	out.reserve(size + 32);
+
+	while (out.size() < size)
+		gen(out, rnd, x64);
+
+	return out;
+}
+
+
+/* -- decode stages, each returns instructions decoded --------------------- */
+typedef size_t (*stage)(const uint8_t *data, size_t size);
+
+template <class arch>
+static size_t stage_length_at(const uint8_t *data, size_t size)
+{
+	size_t count = 0;
+
+	for (size_t ip = 0; ip < size; ip += arch::length_at(data + ip))
+		++count;
+
+	return count;
+}
+
+template <class arch, unsigned mask>
+static size_t stage_decode(const uint8_t *data, size_t size)
+{
+	size_t count = 0;
+
+	for (arch dis(data, size); dis.template decode<mask>(); dis.next())
+		++count;
+
+	return count;
+}
+
+template <class arch>
+static size_t stage_dec(const uint8_t *data, size_t size)
+{
+	size_t count = 0;
+
+	for (arch dis(data, size); dis.dec(); dis.next())
+		++count;
+
+	return count;
+}
+
+struct stage_info
+{
+	const char *name;
+	stage       x86;
+	stage       x64;
+};
+
+static const stage_info stages[] =
+{
+	{ "length_at()",
+	  stage_length_at<ssde_x86>,
+	  stage_length_at<ssde_x64> },
+	{ "decode<length>()",
+	  stage_decode<ssde_x86, ssde::fields::length>,
+	  stage_decode<ssde_x64, ssde::fields::length> },
+	{ "decode<length|rel>()",
+	  stage_decode<ssde_x86, ssde::fields::length | ssde::fields::rel>,
+	  stage_decode<ssde_x64, ssde::fields::length | ssde::fields::rel> },
+	{ "decode<modrm|sib|disp>()",
+	  stage_decode<ssde_x86, ssde::fields::modrm | ssde::fields::sib | ssde::fields::disp>,
+	  stage_decode<ssde_x64, ssde::fields::modrm | ssde::fields::sib | ssde::fields::disp> },
+	{ "dec()",
+	  stage_dec<ssde_x86>,
+	  stage_dec<ssde_x64> }
+};
+
+
+/* -- results -------------------------------------------------------------- */
+struct result
+{
+	std::string corpus;
+	const char *arch;
+	const char *stage;
+	size_t      bytes;
+	size_t      instructions;
+	double      seconds;                    // Best round.
+	uint64_t    cycles;                     // TSC cycles of the best round, 0 without a TSC.
+#if defined(SSDE_PROFILE)
+	ssde_counters counters;                 // Decoder counters of the best round.
+#endif
+};
+
+static result run(const std::string &corpus, bool x64, const std::string &code, size_t size, const stage_info &info, int rounds)
+{
+	const uint8_t *data = reinterpret_cast<const uint8_t *>(code.data());
+	stage          f    = x64 ? info.x64 : info.x86;
+
+	/* value initialized, counters included when they're there */
+	result r = result();
+
+	r.corpus = corpus;
+	r.arch   = x64 ? "x64" : "x86";
+	r.stage  = info.name;
+	r.bytes  = size;
+
+	for (int i = 0; i < rounds; ++i)
+	{
+#if defined(SSDE_PROFILE)
+		ssde_profile::reset();
+#endif
+
+		auto     start = std::chrono::steady_clock::now();
+		uint64_t tsc   = cycles();
+
+		size_t count = f(data, size);
+
+		uint64_t spent   = cycles() - tsc;
+		double   seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		if (i == 0 || seconds < r.seconds)
+		{
+			r.instructions = count;
+			r.seconds      = seconds;
+			r.cycles       = spent;
+#if defined(SSDE_PROFILE)
+			r.counters     = ssde_profile::collect();
+#endif
+		}
+	}
+
+	return r;
+}
+
+static void print_table(const result &r)
+{
+	using namespace std;
+
+	/* files by name, paths are in the JSON */
+	cout << left << setw(14) << r.corpus.substr(r.corpus.find_last_of('/') + 1)
+	     << setw(5) << r.arch
+	     << setw(26) << r.stage
+	     << right << fixed
+	     << setw(10) << setprecision(2) << r.instructions / r.seconds / 1e6 << " Minsn/s"
+	     << setw(9) << setprecision(2) << r.seconds * 1e9 / r.instructions << " ns/insn";
+
+	if (r.cycles != 0)
+		cout << setw(9) << setprecision(1) << double(r.cycles) / r.instructions << " cyc/insn";
+
+	cout << '\n';
+
+#if defined(SSDE_PROFILE)
+	if (strcmp(r.stage, "dec()") != 0)
+		return;
+
+	/* what a full decode came across, per instruction */
+	cout << "    ";
+
+	for (unsigned i = 1; i < ssde_counters::events; ++i)
+		if (r.counters.count[i] != 0)
+			cout << ' ' << ssde_counters::event_name(i) << ' ' << setprecision(2) << double(r.counters.count[i]) / r.instructions;
+
+	cout << '\n';
+
+#if defined(SSDE_PROFILE_TSC)
+	cout << "     cycles/insn:";
+
+	for (unsigned i = 0; i < ssde_counters::stages; ++i)
+		cout << ' ' << ssde_counters::stage_name(i) << ' ' << setprecision(1) << double(r.counters.cycles[i]) / r.instructions;
+
+	cout << '\n';
+#endif
+#endif
+}
+
+static void print_json_string(const std::string &s)
+{
+	std::cout << '"';
+
+	for (char c : s)
+	{
+		if (c == '"' || c == '\\')
+			std::cout << '\\' << c;
+		else if (static_cast<unsigned char>(c) < 0x20)
+			std::cout << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec << std::setfill(' ');
+		else
+			std::cout << c;
+	}
+
+	std::cout << '"';
+}
+
+static void print_json(const std::vector<result> &results)
+{
+	using namespace std;
+
+	cout << "[\n";
+
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const result &r = results[i];
+
+		cout << "  {\"corpus\": ";
+		print_json_string(r.corpus);
+		cout << ", \"arch\": \"" << r.arch << "\", \"stage\": \"" << r.stage << "\""
+		     << ", \"bytes\": " << r.bytes
+		     << ", \"instructions\": " << r.instructions
+		     << setprecision(6) << scientific
+		     << ", \"insn_per_second\": " << r.instructions / r.seconds
+		     << ", \"ns_per_insn\": " << r.seconds * 1e9 / r.instructions
+		     << ", \"cycles_per_insn\": ";
+
+		if (r.cycles != 0)
+			cout << double(r.cycles) / r.instructions;
+		else
+			cout << "null";
+
+#if defined(SSDE_PROFILE)
+		cout << ", \"counters\": {";
+
+		for (unsigned e = 0; e < ssde_counters::events; ++e)
+			cout << (e ? ", \"" : "\"") << ssde_counters::event_name(e) << "\": " << r.counters.count[e];
+
+		cout << "}, \"stage_cycles\": {";
+
+		for (unsigned t = 0; t < ssde_counters::stages; ++t)
+			cout << (t ? ", \"" : "\"") << ssde_counters::stage_name(t) << "\": " << r.counters.cycles[t];
+
+		cout << "}";
+#endif
+
+		cout << "}" << (i + 1 < results.size() ? ",\n" : "\n");
+	}
+
+	cout << "]\n";
+}
+
+
+int main(int argc, const char *argv[])
+{
+	using namespace std;
+
+	ios_base::sync_with_stdio(false);
+
+	bool           json   = false;
+	int            rounds = 5;
+	vector<string> files;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "--json") == 0)
+			json = true;
+		else if (atoi(argv[i]) > 0 && files.empty())
+			rounds = atoi(argv[i]);
+		else
+			files.push_back(argv[i]);
+	}
+
+	if (files.empty())
+		files = { "/bin/ls", "/bin/bash", "/lib/x86_64-linux-gnu/libc.so.6", "/lib64/libc.so.6", "/usr/lib/libc.so.6" };
+
+	static const struct
+	{
+		const char *name;
+		generator   gen;
+	}
+	synthetic[] =
+	{
+		{ "prefixes",   gen_prefixes },
+		{ "vex_evex",   gen_vex },
+		{ "sib_disp32", gen_sib },
+		{ "imm64",      gen_imm },
+		{ "rel",        gen_rel },
+		{ "prefix14",   gen_prefix14 }
+	};
+
+	vector<result> results;
+
+	auto bench = [&](const string &corpus, bool x64, string code)
+	{
+		size_t size = code.size();
+
+		/* unchecked length_at() may read up to ssde::window bytes past the last instruction */
+		code.append(ssde::window, '\0');
+
+		for (auto &info : stages)
+		{
+			results.push_back(run(corpus, x64, code, size, info, rounds));
+
+			if (!json)
+				print_table(results.back());
+		}
+	};
+
+	for (auto &corpus : synthetic)
+	{
+		bench(corpus.name, false, synthesize(corpus.gen, false, 1 << 20));
+		bench(corpus.name, true,  synthesize(corpus.gen, true,  1 << 20));
+	}
+
+	for (auto &path : files)
+	{
+		ssde_file file;
+
+		if (!file.open(path.c_str()))
+			/* defaults that aren't there on this system, or not X86 at all */
+			continue;
+
+		string text;
+
+		for (auto &section : file.sections)
+			text.append(reinterpret_cast<const char *>(section.data), section.size);
+
+		bench(path, file.x64, text);
+	}
+
+	if (json)
+		print_json(results);
+
+	return 0;
+}
@@ -1,66 +1,430 @@
 /*
-* This file is usage demo for SSDE (http://github.com/notnanocat/ssde).
+* ssde, a disassembler of ELF and PE/COFF files built on SSDE
+* (http://github.com/notnanocat/ssde), listing executable sections of a
+* file the way objdump -d does.
 * This file is not a subject to license, feel free to use it in any way
 * You wish.
+*
+*   ssde [-t | -x | -l] [-M intel | -M att] [-j threads] file
+*
+*   -t  address, bytes and text of each instruction (default)
+*   -x  address and bytes of each instruction
+*   -l  address and length of each instruction
+*   -M  syntax of text, Intel (default) or AT&T
+*   -j  threads to list with, 0 (default) for one per core
+*
+* The file is mapped and its sections are cut into chunks, which worker
+* threads list into buffers of their own while the main thread writes
+* them out in address order. A chunk is listed from its start as though
+* an instruction started there; where the last instruction before it
+* runs into the chunk, the main thread decodes on from its end until it
+* meets an instruction of the chunk, as ssde_sweep() stitches its chunks.
+* The listing is the very one a single linear sweep gives, whatever the
+* number of threads, and only a few chunks are held at once.
 */
 #include "../ssde/ssde_x86.hpp"
+#include "../ssde/ssde_x64.hpp"
+#include "../ssde/ssde_file.hpp"
+#include "../ssde/ssde_format.hpp"
 
-#include <iostream>
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
 #include <string>
-#include <fstream>
-#include <iomanip>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 
 
-int main(int argc, const char *argv[])
+enum : uint8_t
+{
+	mode_text   = 0,                        // Address, bytes and text.
+	mode_hex    = 1,                        // Address and bytes.
+	mode_length = 2                         // Address and length.
+};
+
+struct options
+{
+	uint8_t     mode    = mode_text;
+	uint8_t     syntax  = ssde_format::syntax_intel;
+	unsigned    threads = 0;
+	const char *path    = nullptr;
+};
+
+static const size_t chunk_size = 256*1024; // Bytes of code a worker lists at once.
+static const size_t max_length = 15;        // Longest X86 instruction, in bytes.
+
+
+/* -- a chunk of a section, and the listing of it --------------------------- */
+struct chunk
+{
+	const ssde_section *section;
+	size_t              begin;              // Offset in the section of the first byte.
+	size_t              end;                // Offset past the last byte.
+};
+
+struct listing
+{
+	enum : size_t { max_marks = 64 };
+
+	std::string text;                       // Lines of the chunk's instructions.
+	size_t      exit;                       // Offset the instruction after the chunk's last starts at.
+
+	size_t      marks;                      // Instructions marked, the first of the chunk.
+	size_t      offsets[max_marks];         // Offset of each of them.
+	size_t      lines[max_marks];           // Where its line starts in text.
+
+	bool        ready = false;              // Listed, the main thread can write it out.
+};
+
+
+/* -- lines ---------------------------------------------------------------- */
+static size_t put_hex(char *text, uint64_t value, size_t digits = 0)
+{
+	static const char hex[] = "0123456789abcdef";
+
+	char   buffer[16];
+	size_t n = 0;
+
+	do
+	{
+		buffer[n++] = hex[value & 0x0f];
+		value >>= 4;
+	}
+	while (value != 0 || n < digits);
+
+	for (size_t i = 0; i < n; ++i)
+		text[i] = buffer[n - 1 - i];
+
+	return n;
+}
+
+/*
+* Function symbols in address order, labels of the listing. The cursor
+* only goes forward, as instructions do.
+*/
+class labels
+{
+public:
+	labels(const std::vector<ssde_symbol> &symbols, uint64_t address) :
+		symbols(symbols)
+	{
+		at = std::lower_bound(symbols.begin(), symbols.end(), address, [](const ssde_symbol &symbol, uint64_t va)
+		{
+			return symbol.address < va;
+		}) - symbols.begin();
+	}
+
+	const ssde_symbol *find(uint64_t address) // Function symbol at address, nullptr if none.
+	{
+		for (; at < symbols.size() && symbols[at].address <= address; ++at)
+		{
+			if (symbols[at].address == address && symbols[at].function)
+				return &symbols[at++];
+		}
+
+		return nullptr;
+	}
+
+private:
+	const std::vector<ssde_symbol> &symbols;
+	size_t                          at;
+};
+
+template <class arch>
+static void put_line(std::string &text, const arch &dis, const ssde_section &section, labels &names, const options &opt)
 {
-	using namespace std;
-
-	ios_base::sync_with_stdio(false);
-
-
-	const string bc =
-		"\x55"
-		"\x31\xd2"
-		"\x89\xe5"
-		"\x8b\x45\x08"
-		"\x56"
-		"\x8b\x75\x0c"
-		"\x53"
-		"\x8d\x58\xff"
-		"\x0f\xb6\x0c\x16"
-		"\x88\x4c\x13\x01"
-		"\x83\xc2\x01"
-		"\x84\xc9"
-		"\x75\xf1"
-		"\x5b"
-		"\x5e"
-		"\x5d"
-		"\xc3";
-
-	for (ssde_x86 dis(bc); dis.dec(); dis.next())
-		/*
-		* call ::next() to iterate and ::dec() to
-		* decode and decide whether we have reached
-		* the end of the buffer or not
-		*/
+	char   line[256];
+	size_t n = 0;
+
+	uint64_t address = section.address + dis.ip;
+
+	if (opt.mode == mode_text)
+	{
+		if (const ssde_symbol *symbol = names.find(address))
+			/* 0000000000401000 <main>: */
+		{
+			text += '\n';
+			text.append(line, put_hex(line, address, arch::address_bits / 4));
+			text += " <";
+			text += symbol->name;
+			text += ">:\n";
+		}
+	}
+
+	line[n++] = ' ';
+	line[n++] = ' ';
+	n += put_hex(line + n, address);
+	line[n++] = ':';
+	line[n++] = '\t';
+
+	if (opt.mode == mode_length)
 	{
-		/* output address of the instruction */
-		cout << setfill('0') << setw(8) << hex << dis.ip << ": ";
+		/* 15 at most */
+		if (dis.length >= 10)
+			line[n++] = '1';
 
-		for (int i = 0; i < dis.length; ++i)
-			/* output instruction's bytes */
+		line[n++] = static_cast<char>('0' + dis.length % 10);
+	}
+	else
+	{
+		/* a truncated instruction has only those bytes the section has left */
+		n += ssde_format::bytes(section.data + dis.ip, std::min<size_t>(dis.length, section.size - dis.ip), line + n, 3 * max_length);
+
+		if (opt.mode == mode_text)
 		{
-			cout << setfill('0') << setw(2) << hex << (static_cast<unsigned int>(bc[dis.ip + i]) & 0xff);
+			line[n++] = '\t';
+			n += ssde_format::format(dis, line + n, ssde_format::max_text, opt.syntax);
 		}
+	}
+
+	line[n++] = '\n';
+
+	text.append(line, n);
+}
+
+/*
+* Lists a chunk from its start, marking its first instructions for the
+* main thread to stitch it on to the chunk before.
+*/
+template <class arch>
+static void list_chunk(const ssde_file &file, const chunk &part, listing &out, const options &opt)
+{
+	const ssde_section &section = *part.section;
 
-		if (dis.has_rel)
-			/* if this instruction has relative address, print where it points to */
+	arch   dis(section.image());
+	labels names(file.symbols, section.address + part.begin);
+
+	out.text.clear();
+	out.marks = 0;
+
+	for (dis.ip = part.begin; dis.ip < part.end && dis.dec(); dis.next())
+	{
+		if (out.marks < listing::max_marks)
 		{
-			cout << " ; -> " << setfill('0') << setw(8) << hex << dis.abs;
+			out.offsets[out.marks] = dis.ip;
+			out.lines[out.marks]   = out.text.size();
+			++out.marks;
 		}
 
-		cout << '\n';
+		put_line(out.text, dis, section, names, opt);
 	}
 
+	out.exit = std::max(dis.ip, part.end);
+}
+
+/*
+* Writes a listed chunk out, entered at offset entry by the instructions
+* before it, returns the offset the instruction after it starts at.
+*/
+template <class arch>
+static size_t write_chunk(const ssde_file &file, const chunk &part, const listing &out, size_t entry, const options &opt, std::string &fixed)
+{
+	const ssde_section &section = *part.section;
+
+	if (entry >= part.end)
+		/* the chunk is all within the instruction before it */
+		return entry;
+
+	arch   dis(section.image());
+	labels names(file.symbols, section.address + entry);
+	size_t mark = 0;
+
+	fixed.clear();
+
+	for (dis.ip = entry; dis.ip < part.end && dis.dec(); dis.next())
+	{
+		while (mark < out.marks && out.offsets[mark] < dis.ip)
+			++mark;
+
+		if (mark < out.marks && out.offsets[mark] == dis.ip)
+			/* in step with the chunk's own sweep, the rest of it is the same */
+		{
+			fwrite(fixed.data(), 1, fixed.size(), stdout);
+			fwrite(out.text.data() + out.lines[mark], 1, out.text.size() - out.lines[mark], stdout);
+
+			return out.exit;
+		}
+
+		/* not in step yet, or past the last mark and listing the chunk all over */
+		put_line(fixed, dis, section, names, opt);
+	}
+
+	fwrite(fixed.data(), 1, fixed.size(), stdout);
+
+	return std::max(dis.ip, part.end);
+}
+
+template <class arch>
+static void list_file(const ssde_file &file, const options &opt)
+{
+	std::vector<chunk> chunks;
+
+	for (auto &section : file.sections)
+	{
+		for (size_t begin = 0; begin < section.size; begin += chunk_size)
+		{
+			chunk part = { &section, begin, std::min(section.size, begin + chunk_size) };
+
+			chunks.push_back(part);
+		}
+	}
+
+	unsigned threads = opt.threads != 0 ? opt.threads : std::max(std::thread::hardware_concurrency(), 1u);
+
+	/* chunk i is listed into slot i % slots, once chunk i - slots is written out */
+	size_t slots = 2 * threads;
+
+	std::vector<listing>    listings(slots);
+	std::mutex              lock;
+	std::condition_variable changed;
+	size_t                  next    = 0;    // Chunk to be listed next.
+	size_t                  written = 0;    // Chunks written out.
+
+	auto work = [&]()
+	{
+		for (;;)
+		{
+			size_t i;
+
+			{
+				std::unique_lock<std::mutex> hold(lock);
+
+				changed.wait(hold, [&]() { return next >= chunks.size() || next < written + slots; });
+
+				if (next >= chunks.size())
+					return;
+
+				i = next++;
+			}
+
+			list_chunk<arch>(file, chunks[i], listings[i % slots], opt);
+
+			{
+				std::lock_guard<std::mutex> hold(lock);
+
+				listings[i % slots].ready = true;
+			}
+
+			changed.notify_all();
+		}
+	};
+
+	std::vector<std::thread> workers;
+
+	for (unsigned t = 0; t < threads && t < chunks.size(); ++t)
+		workers.emplace_back(work);
+
+	std::string fixed;
+	size_t      entry = 0;
+
+	for (size_t i = 0; i < chunks.size(); ++i)
+	{
+		const chunk &part = chunks[i];
+		listing     &out  = listings[i % slots];
+
+		{
+			std::unique_lock<std::mutex> hold(lock);
+
+			changed.wait(hold, [&]() { return out.ready; });
+		}
+
+		if (part.begin == 0)
+			/* a section starts with an instruction */
+		{
+			entry = 0;
+
+			if (opt.mode == mode_text)
+				printf("\nDisassembly of section %s:\n", part.section->name.c_str());
+		}
+
+		entry = write_chunk<arch>(file, part, out, entry, opt, fixed);
+
+		{
+			std::lock_guard<std::mutex> hold(lock);
+
+			out.ready = false;
+			++written;
+		}
+
+		changed.notify_all();
+	}
+
+	for (auto &worker : workers)
+		worker.join();
+}
+
+
+static int usage()
+{
+	fprintf(stderr, "usage: ssde [-t | -x | -l] [-M intel | -M att] [-j threads] file\n");
+	return 2;
+}
+
+int main(int argc, const char *argv[])
+{
+	options opt;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "-t") == 0)
+			opt.mode = mode_text;
+		else if (strcmp(argv[i], "-x") == 0)
+			opt.mode = mode_hex;
+		else if (strcmp(argv[i], "-l") == 0)
+			opt.mode = mode_length;
+		else if (strcmp(argv[i], "-M") == 0 && i + 1 < argc && strcmp(argv[i + 1], "intel") == 0)
+			opt.syntax = ssde_format::syntax_intel, ++i;
+		else if (strcmp(argv[i], "-M") == 0 && i + 1 < argc && strcmp(argv[i + 1], "att") == 0)
+			opt.syntax = ssde_format::syntax_att, ++i;
+		else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+			opt.threads = static_cast<unsigned>(atoi(argv[++i]));
+		else if (strncmp(argv[i], "-j", 2) == 0 && argv[i][2] != '\0')
+			opt.threads = static_cast<unsigned>(atoi(argv[i] + 2));
+		else if (argv[i][0] != '-' && opt.path == nullptr)
+			opt.path = argv[i];
+		else
+			return usage();
+	}
+
+	if (opt.path == nullptr)
+		return usage();
+
+	ssde_file file;
+
+	if (!file.open(opt.path))
+	{
+		fprintf(stderr, "ssde: %s: %s\n", opt.path, file.error);
+		return 1;
+	}
+
+	/* lines are written out a chunk at a time, not a line */
+	static char buffer[1 << 20];
+
+	setvbuf(stdout, buffer, _IOFBF, sizeof(buffer));
+
+	if (opt.mode == mode_text)
+	{
+		const char *format;
+
+		switch (file.format)
+		{
+		case ssde_file::format_pe:   format = file.x64 ? "pei-x86-64"   : "pei-i386";   break;
+		case ssde_file::format_coff: format = file.x64 ? "pe-x86-64"    : "pe-i386";    break;
+		default:                     format = file.x64 ? "elf64-x86-64" : "elf32-i386"; break;
+		}
+
+		printf("\n%s:     file format %s\n", opt.path, format);
+	}
+
+	if (file.x64)
+		list_file<ssde_x64>(file, opt);
+	else
+		list_file<ssde_x86>(file, opt);
+
+	fflush(stdout);
+
 	return 0;
 }
@@ -5,25 +5,384 @@
 #pragma once
 
 #include <string>
+#include <vector>
+#include <memory>
+#include <utility>
 
 #include <stdint.h>
+#include <stddef.h>
+#include <string.h>
 
 
-class ssde
+/*
+* Structure-of-arrays storage for instructions decoded by decode_batch().
+* Columns only ever grow, so a batch reused between calls doesn't allocate.
+*/
+struct ssde_batch
+{
+	/*
+	* Bits of the flags column.
+	*/
+	enum : uint16_t
+	{
+		f_error = 1 << 0,                   // Decoding error.
+		f_modrm = 1 << 1,                   // Has Mod R/M byte.
+		f_sib   = 1 << 2,                   // Has SIB byte.
+		f_disp  = 1 << 3,                   // Has address displacement.
+		f_imm   = 1 << 4,                   // Has immediate value.
+		f_imm2  = 1 << 5,                   // Has 2 immediate values.
+		f_rel   = 1 << 6,                   // Has relative address, target is valid.
+		f_vex   = 1 << 7,                   // Has VEX prefix.
+		f_rex   = 1 << 8,                   // Has REX prefix.
+		f_lock  = 1 << 9,                   // Has LOCK prefix.
+	};
+
+	void resize(size_t n)                   // Make room for at least n instructions.
+	{
+		if (offset.size() < n)
+		{
+			offset.resize(n);
+			length.resize(n);
+			opcode1.resize(n);
+			opcode2.resize(n);
+			opcode3.resize(n);
+			flags.resize(n);
+			flow.resize(n);
+			target.resize(n);
+		}
+	}
+
+	size_t count = 0;                       // Number of valid rows.
+
+	std::vector<uint64_t> offset;           // Offset of the instruction in the buffer.
+	std::vector<uint8_t>  length;           // Instruction length, in bytes.
+	std::vector<uint8_t>  opcode1;          // 1st opcode byte.
+	std::vector<uint8_t>  opcode2;          // 2nd opcode byte.
+	std::vector<uint8_t>  opcode3;          // 3rd opcode byte.
+	std::vector<uint16_t> flags;            // f_* bits.
+	std::vector<uint8_t>  flow;             // Flow control class, ssde_insn::flow_*.
+	std::vector<uint64_t> target;           // Absolute address of relative branch, 0 if none.
+};
+
+
+/*
+* Packed record of a decoded instruction, 32 bytes. It's the per-instruction
+* state of every disassembler (copy it out by slicing, e.g.
+* "ssde_insn insn = dis;") and is meant to be stored in bulk.
+*
+* Fields that can't be valid at the same time share storage: imm is only
+* valid without has_rel and abs only with it, disp is only valid with a
+* Mod R/M byte and rel only without one.
+*/
+struct ssde_insn
+{
+	/*
+	* EVEX rounding modes.
+	*/
+	enum : uint8_t
+	{
+		rnd_rne = 0x00,                     //
+		rnd_rd  = 0x01,                     //
+		rnd_ru  = 0x02,                     //
+		rnd_rz  = 0x03,                     //
+
+		rnd_off = 0x07                      // 
+	};
+
+	/*
+	* Flow control classes, what flow is set to.
+	*/
+	enum : uint8_t
+	{
+		flow_none          = 0,             // Flow goes on to the next instruction.
+		flow_jcc           = 1,             // Conditional branch, target is in abs.
+		flow_jmp           = 2,             // Unconditional branch, target is in abs.
+		flow_call          = 3,             // Call, target is in abs.
+		flow_ret           = 4,             // Return, also from interrupts and system calls.
+		flow_jmp_indirect  = 5,             // Jump through a register or memory, or a far jump.
+		flow_call_indirect = 6,             // Call through a register or memory, or a far call.
+		flow_syscall       = 7,             // System call, flow goes on once it returns.
+		flow_interrupt     = 8,             // Software interrupt or breakpoint.
+		flow_halt          = 9              // HLT or UD*, flow doesn't go on.
+	};
+
+	ssde_insn()
+	{
+		reset();
+	}
+
+	void reset()                            // Clear the record, a couple of stores.
+	{
+		memset(static_cast<void *>(this), 0, sizeof(ssde_insn));
+
+		vex_round = rnd_off;
+	}
+
+	union
+	{
+		uint64_t imm;                       // First immediate value.
+		uint64_t abs;                       // Absolute address value.
+	};
+
+	union
+	{
+		int32_t disp;                       // Displacement value.
+		int32_t rel;                        // Relative address value.
+	};
+
+	uint16_t imm2;                          // Second immediate value.
+
+	uint8_t group1;                         // Opcode prefix in 1st group, 0 if none. 1st group includes LOCK, REPNZ and REPZ prefixes.
+	uint8_t group2;                         // Opcode prefix in 2nd group, 0 if none. 2nd group includes segment prefixes and/or branch hints.
+	uint8_t group3;                         // Opcode prefix in 3rd group, 0 if none. 3rd group includes operand-size override prefix (p_66)
+	uint8_t group4;                         // Opcode prefix in 4th group, 0 if none. 4th group includes address-size override prefix (p_67)
+
+	uint8_t opcode1;                        // 1st opcode byte.
+	uint8_t opcode2;                        // 2nd opcode byte.
+	uint8_t opcode3;                        // 3rd opcode byte.
+
+	uint8_t length        : 4;              // Instruction length, in bytes. Can be manually overriden.
+	bool    error         : 1;              // Decoding error.
+	bool    error_opcode  : 1;              // Bad opcode.
+	bool    error_operand : 1;              // Bad operand(s).
+	bool    error_length  : 1;              // Instruction is too long.
+
+	bool    error_lock    : 1;              // LOCK prefix is not allowed.
+	bool    error_novex   : 1;              // Instruction is only allowed to be VEX encoded.
+	bool    has_rex       : 1;              // Has REX prefix.
+	bool    rex_w         : 1;              // REX.W field, also set from VEX.W.
+	bool    rex_r         : 1;              // REX.R field, also set from VEX.R.
+	bool    rex_x         : 1;              // REX.X field, also set from VEX.X.
+	bool    rex_b         : 1;              // REX.B field, also set from VEX.B.
+	bool    has_vex       : 1;              // Has VEX prefix.
+
+	bool    vex_w         : 1;              // VEX.W field.
+	bool    vex_r         : 1;              // VEX.R field.
+	bool    vex_x         : 1;              // VEX.X field.
+	bool    vex_b         : 1;              // VEX.B field.
+	bool    vex_zero      : 1;              // Should zero or merge?; z field.
+	bool    vex_rr        : 1;              // VEX R' field.
+	bool    vex_sae       : 1;              // Suppress exceptions.
+	bool    vex_rc        : 1;              // Rounding control, same as vex_sae.
+
+	bool    vex_broadcast : 1;              // Broadcast single element across the destination register, same as vex_sae.
+	bool    has_modrm     : 1;              // Has Mod R/M byte.
+	bool    has_sib       : 1;              // Has SIB byte.
+	bool    has_disp      : 1;              // Has address displacement.
+	bool    has_imm       : 1;              // Has immediate value.
+	bool    has_imm2      : 1;              // Has 2 immediate values.
+	bool    has_rel       : 1;              // Has relative address.
+	bool    error_truncated : 1;            // Instruction runs past the end of the code.
+
+	uint8_t modrm_mod     : 2;              // Mod R/M address mode.
+	uint8_t imm2_size     : 2;              // Size of the second immediate value, in bytes.
+	uint8_t modrm_reg     : 4;              // Register number or opcode information.
+
+	uint8_t modrm_rm      : 4;              // Operand register.
+	uint8_t sib_scale     : 4;              // Index scale factor.
+
+	uint8_t sib_index     : 4;              // Index register.
+	uint8_t sib_base      : 4;              // Base register.
+
+	uint8_t vex_reg       : 5;              // VEX register specifier.
+	uint8_t vex_round     : 3;              // Rounding mode.
+
+	uint8_t vex_size      : 3;              // Size of VEX prefix (usually 2 or 3 bytes).
+	uint8_t vex_opmask    : 3;              // VEX opmask register specifier.
+	uint8_t vex_l         : 2;              // VEX L field.
+
+	uint8_t disp_size     : 3;              // Size of address displacement, in bytes.
+	uint8_t rel_size      : 3;              // Size of relative address, in bytes.
+	uint8_t               : 2;
+
+	uint8_t imm_size      : 4;              // Size of the first immediate value, in bytes.
+	uint8_t flow          : 4;              // Flow control class, one of flow_*.
+};
+
+static_assert(sizeof(ssde_insn) == 32, "ssde_insn is expected to be packed into 32 bytes");
+
+
+/*
+* Code shared between threads: its bytes, and the address they are loaded
+* at. An image doesn't change once constructed, so any number of threads
+* can construct disassemblers on it at once. Those borrow the image and
+* only hold the state of the instruction being decoded, so constructing
+* one is a handful of stores. The image has to outlive them.
+*
+* The mode (e.g. X86 or X86-64) is the type of the disassembler.
+*/
+class ssde_image
 {
 public:
+	/*
+	* Borrowing constructor, data has to outlive the image.
+	*/
+	ssde_image(const uint8_t *data, size_t size, uint64_t base = 0) :
+		buffer(data),
+		buffer_size(size),
+		origin(base)
+	{
+	}
+
+	/*
+	* Owning constructor, the data is moved into the image.
+	*/
+	ssde_image(std::string &&data, uint64_t base = 0) :
+		origin(base),
+		owner(std::make_shared<const std::string>(std::move(data)))
+	{
+		buffer      = reinterpret_cast<const uint8_t *>(owner->data());
+		buffer_size = owner->size();
+	}
+
+	const uint8_t *data() const             // Code of the image.
+	{
+		return buffer;
+	}
+
+	size_t size() const                     // Size of the code, in bytes.
+	{
+		return buffer_size;
+	}
+
+	uint64_t base_address() const           // Address the code is loaded at.
+	{
+		return origin;
+	}
+
+private:
+	const uint8_t *buffer      = nullptr;   // Code of the image.
+	size_t         buffer_size = 0;         // Size of the code, in bytes.
+	uint64_t       origin      = 0;         // Address the code is loaded at.
+
+	std::shared_ptr<const std::string> owner; // Set if the code is owned by the image.
+};
+
+
+class ssde : public ssde_insn
+{
+public:
+	/*
+	* Borrowing constructor. Code is decoded in place, the caller has to
+	* keep it alive for as long as the disassembler (and its copies) live.
+	* This is what mmap'ed images, JIT arenas and process memory should use.
+	*/
+	ssde(const uint8_t *data, size_t size, size_t pos = 0) :
+		ip(pos),
+		buffer(data),
+		buffer_size(size)
+	{
+	}
+
+	/*
+	* Borrowing constructor for std::string lvalues, same rules apply.
+	*/
 	ssde(const std::string &data, size_t pos = 0) :
 		ip(pos),
-		buffer(data)
+		buffer(reinterpret_cast<const uint8_t *>(data.data())),
+		buffer_size(data.size())
+	{
+	}
+
+	/*
+	* Owning constructor. Rvalue strings (temporaries included) are moved
+	* into a buffer that is shared between the disassembler and its copies.
+	*/
+	ssde(std::string &&data, size_t pos = 0) :
+		ip(pos),
+		owner(std::make_shared<const std::string>(std::move(data)))
+	{
+		buffer      = reinterpret_cast<const uint8_t *>(owner->data());
+		buffer_size = owner->size();
+	}
+
+	/*
+	* Disassembler on a shared image, IP being an offset into its code.
+	* Nothing is allocated nor reference counted, see ssde_image.
+	*/
+	ssde(const ssde_image &image, size_t pos = 0) :
+		ip(pos),
+		buffer(image.data()),
+		buffer_size(image.size()),
+		origin(image.base_address())
 	{
 	}
 
+	/*
+	* Copies share the code, an owned buffer included, but not the state
+	* of the instruction being decoded, which starts out cleared.
+	*/
 	ssde(const ssde &from) :
+		ssde_insn(),
 		ip(from.ip),
-		buffer(from.buffer)
+		buffer(from.buffer),
+		buffer_size(from.buffer_size),
+		origin(from.origin),
+		owner(from.owner)
 	{
 	}
 
+	ssde &operator=(const ssde &from)
+	{
+		if (this != &from)
+		{
+			reset();
+
+			ip          = from.ip;
+			buffer      = from.buffer;
+			buffer_size = from.buffer_size;
+			origin      = from.origin;
+			bytes       = nullptr;
+			owner       = from.owner;
+		}
+
+		return *this;
+	}
+
+	/*
+	* Points the disassembler at the code of image, same as constructing
+	* a new one on it, without giving up the decoder.
+	*/
+	void assign(const ssde_image &image, size_t pos = 0)
+	{
+		ip          = pos;
+		buffer      = image.data();
+		buffer_size = image.size();
+		origin      = image.base_address();
+
+		owner.reset();
+	}
+
+
+	/*
+	* Field selection policy for decode<mask>() of architecture modules.
+	* Length, errors, prefixes, opcode bytes and has_* fields are always
+	* valid, other fields are only filled in if their group is requested,
+	* otherwise they are left cleared.
+	*/
+	struct fields
+	{
+		enum : unsigned
+		{
+			length = 0,                     // Nothing but the always valid fields.
+			modrm  = 1 << 0,                // modrm_mod, modrm_reg, modrm_rm.
+			sib    = 1 << 1,                // sib_scale, sib_index, sib_base.
+			disp   = 1 << 2,                // disp.
+			imm    = 1 << 3,                // imm, imm2.
+			rel    = 1 << 4,                // rel, abs.
+			vex    = 1 << 5,                // vex_reg, vex_opmask, vex_zero, vex_rr.
+
+			all    = (unsigned)-1           // Every field, what dec() fills in.
+		};
+	};
+
+
+	/*
+	* Number of bytes past IP the decoders may look at. Overlong encodings
+	* are decoded to the end before being rejected, so it's well past 15,
+	* and wide loads of disp and imm may read up to 7 bytes over that.
+	*/
+	enum : size_t { window = 48 };
 
 	virtual bool dec() = 0;                 // Decode instruction pointed by IP.
 
@@ -32,15 +391,134 @@ public:
 		ip += length;
 	}
 
-public:
-	bool error         = false;             // Decoding error.
-	bool error_opcode  = false;             // Bad opcode.
-	bool error_operand = false;             // Bad operand(s).
-	bool error_length  = false;             // Instruction is too long.
+	const uint8_t *data() const             // Code being decoded.
+	{
+		return buffer;
+	}
 
+	size_t size() const                     // Size of the code, in bytes.
+	{
+		return buffer_size;
+	}
+
+	uint64_t base_address() const           // Address the code is loaded at, abs includes it.
+	{
+		return origin;
+	}
+
+public:
 	size_t ip;                              // Instruction pointer. Can be manually overriden.
-	int    length  = 0;                     // Instruction length, in bytes. Can be manually overriden.
 
 protected:
-	const std::string &buffer;
-};
\ No newline at end of file
+	/*
+	* Points bytes at the instruction at IP. The fast path decodes straight
+	* from the buffer without bounds checks. Within window bytes of its end,
+	* what's left is copied into a zero-padded tail so that the same
+	* unchecked decoder can run; check_truncated() then tells whether the
+	* instruction actually fit.
+	*/
+	bool fetch()
+	{
+		if (ip >= buffer_size)
+			return false;
+
+		size_t left = buffer_size - ip;
+
+		if (left >= window)
+			/* fast path, at least window bytes are readable */
+		{
+			bytes = buffer + ip;
+		}
+		else
+		{
+			memset(tail, 0, window);
+			memcpy(tail, buffer + ip, left);
+
+			bytes = tail;
+		}
+
+		return true;
+	}
+
+	void check_truncated()                  // Flag instructions running past the end of the code.
+	{
+		if (length > buffer_size - ip)
+		{
+			error = true;
+			error_truncated = true;
+		}
+	}
+
+	/*
+	* Reads a little-endian value size bytes long (up to 8). Always loads
+	* 8 bytes at once, so 8 bytes at p have to be readable.
+	*/
+	static uint64_t load(const uint8_t *p, int size)
+	{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+		uint64_t value = 0;
+
+		for (int i = 0; i < size; ++i)
+			value |= static_cast<uint64_t>(p[i]) << i*8;
+
+		return value;
+#else
+		uint64_t value;
+
+		memcpy(&value, p, 8);
+
+		return size < 8 ? value & ((1ull << size*8) - 1) : value;
+#endif
+	}
+
+	const uint8_t *buffer      = nullptr;   // Code being decoded.
+	size_t         buffer_size = 0;         // Size of the code, in bytes.
+	uint64_t       origin      = 0;         // Address the code is loaded at.
+	const uint8_t *bytes       = nullptr;   // Instruction at IP, see fetch().
+
+private:
+	uint8_t tail[window];                   // Zero-padded copy of the end of the code.
+
+
+	std::shared_ptr<const std::string> owner; // Set if the code is owned by the disassembler.
+};
+
+
+/*
+* Base of architecture modules. arch is the module itself and has to
+* implement non-virtual decode(). dec() is only a thin virtual adapter
+* for code written against ssde, calls made on the module itself resolve
+* at compile time and let decode() be inlined into the caller's loop.
+* base is what the module builds on, modules sharing a decoder engine
+* (e.g. ssde_x86 and ssde_x64) pass the engine, which derives from ssde.
+*/
+template <class arch, class base = ssde>
+class ssde_impl : public base
+{
+public:
+	using base::base;
+
+	bool dec() override final               // Decode instruction pointed by IP.
+	{
+		return static_cast<arch *>(this)->decode();
+	}
+
+	/*
+	* Bounds checked length_at() for the last bytes of a buffer, size is
+	* the number of bytes left at code. Returns 0 if the instruction
+	* doesn't fit into them.
+	*/
+	static int length_at(const uint8_t *code, size_t size)
+	{
+		if (size >= ssde::window)
+			return arch::length_at(code);
+
+		uint8_t tail[ssde::window] = {};
+
+		memcpy(tail, code, size);
+
+		int length = arch::length_at(tail);
+
+		return static_cast<size_t>(length) > size ? 0 : length;
+	}
+};
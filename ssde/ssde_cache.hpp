@@ -0,0 +1,336 @@
+/*
+* The SSDE header file for caching decoded instructions.
+* Copyright (C) 2015, Constantine Shablya. See Copyright Notice in LICENSE.md
+*/
+#pragma once
+#include "ssde.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+
+/*
+* Hit and miss counters of decode caches.
+*/
+struct ssde_cache_stats
+{
+	size_t hits   = 0;                      // Instructions taken from the cache.
+	size_t misses = 0;                      // Instructions decoded, cached or not.
+};
+
+
+/*
+* Base of decode caches. Instructions are keyed by their bytes: the slot
+* is picked by a hash of the first 4 bytes at IP, and a hit needs the
+* bytes of the cached instruction (length of them) to be there. As an
+* instruction is only decoded from its own bytes, any such record is
+* right, wherever it was decoded. The relative target is the only field
+* depending on IP, it's recomputed on a hit, arch has to tell the width
+* of addresses in address_bits for that.
+*
+* Only instructions with at least ssde::window bytes after them and
+* without errors are cached, the rest go straight to the decoder.
+*
+* A hit is several times cheaper than decoding as long as the slots stay
+* in the CPU cache, so more slots isn't always faster. 4096 slots (192 KB)
+* hit on half of instructions of a large libstdc++ .text, 65536 slots on
+* 70% of them.
+*/
+template <class arch>
+class ssde_cache_base
+{
+protected:
+	/*
+	* Number of slots, a power of two no greater than slots but at least 1.
+	*/
+	static size_t round_slots(size_t slots)
+	{
+		size_t n = 1;
+
+		while (n * 2 <= slots)
+			n *= 2;
+
+		return n;
+	}
+
+	/*
+	* Bytes of the instruction at code, length of them, as two words.
+	* Bytes past length are zeroed, so records of shorter instructions
+	* never match longer ones by accident.
+	*/
+	static void key_of(const uint8_t *code, int length, uint64_t key[2])
+	{
+		memcpy(key, code, 16);
+
+		if (length < 8)
+		{
+			key[0] &= (1ull << length*8) - 1;
+			key[1]  = 0;
+		}
+		else if (length < 16)
+		{
+			key[1] &= length == 8 ? 0 : (1ull << (length - 8)*8) - 1;
+		}
+	}
+
+	static size_t slot_of(const uint8_t *code, size_t mask)
+	{
+		uint32_t head;
+
+		/* most instructions are longer than 3 bytes, few differ in their first 4 bytes only */
+		memcpy(&head, code, 4);
+
+		return static_cast<size_t>((head * 0x9e3779b97f4a7c15ull) >> 32) & mask;
+	}
+
+	/*
+	* Fills dis in from a cached record, rel and length being the ones of
+	* the instruction at its IP.
+	*/
+	static void restore(arch &dis, const ssde_insn &insn)
+	{
+		static_cast<ssde_insn &>(dis) = insn;
+
+		if (insn.has_rel)
+			/* abs is the only field depending on IP */
+		{
+			uint64_t abs = dis.base_address() + dis.ip + insn.length + static_cast<int64_t>(insn.rel);
+
+			dis.abs = arch::address_bits < 64 ? abs & ((1ull << arch::address_bits) - 1) : abs;
+		}
+	}
+};
+
+
+/*
+* Decode cache for a single thread. slots records of 48 bytes are kept,
+* rounded down to a power of two. An instruction hashed to an occupied
+* slot replaces what's there.
+*/
+template <class arch>
+class ssde_cache : public ssde_cache_base<arch>
+{
+public:
+	explicit ssde_cache(size_t slots = 1 << 12) :
+		mask(this->round_slots(slots) - 1),
+		entries(mask + 1)
+	{
+	}
+
+	/*
+	* Decodes the instruction at IP of dis, same as dis.dec().
+	*/
+	bool dec(arch &dis)
+	{
+		if (dis.ip >= dis.size() || dis.size() - dis.ip < ssde::window)
+			/* too close to the end to compare bytes */
+		{
+			++stats.misses;
+			return dis.dec();
+		}
+
+		const uint8_t *code = dis.data() + dis.ip;
+
+		entry &slot = entries[this->slot_of(code, mask)];
+
+		if (slot.insn.length != 0)
+		{
+			uint64_t key[2];
+
+			this->key_of(code, slot.insn.length, key);
+
+			if (key[0] == slot.key[0] && key[1] == slot.key[1])
+			{
+				++stats.hits;
+
+				this->restore(dis, slot.insn);
+				return true;
+			}
+		}
+
+		++stats.misses;
+
+		dis.dec();
+
+		if (!dis.error)
+		{
+			this->key_of(code, dis.length, slot.key);
+			slot.insn = dis;
+		}
+
+		return true;
+	}
+
+	void clear()                            // Drop every record, counters are kept.
+	{
+		std::fill(entries.begin(), entries.end(), entry());
+	}
+
+	size_t slots() const                    // Number of records kept at most.
+	{
+		return entries.size();
+	}
+
+	ssde_cache_stats stats;                 // Hits and misses so far.
+
+private:
+	struct entry
+	{
+		uint64_t  key[2] = {};              // Bytes of the instruction.
+		ssde_insn insn;                     // Its record, length 0 if the slot is free.
+
+		entry()
+		{
+			insn.length = 0;
+		}
+	};
+
+	size_t             mask;
+	std::vector<entry> entries;
+};
+
+
+/*
+* Decode cache shared by threads, for code they all go through. Reads
+* don't lock nor write anything shared: every slot has a sequence
+* number, odd while the slot is being written, and a reader retries
+* the decoder if it changed under it. A writer finding a slot busy
+* leaves it be. Slots are 56 bytes, their number is rounded down to a
+* power of two. Counters are kept by each thread, in stats given to
+* dec().
+*/
+template <class arch>
+class ssde_shared_cache : public ssde_cache_base<arch>
+{
+public:
+	explicit ssde_shared_cache(size_t slots = 1 << 14) :
+		mask(this->round_slots(slots) - 1),
+		entries(new entry[mask + 1])
+	{
+		clear();
+	}
+
+	/*
+	* Decodes the instruction at IP of dis, same as dis.dec(). Safe to
+	* call from several threads at once, each with its own dis.
+	*/
+	bool dec(arch &dis, ssde_cache_stats &stats)
+	{
+		if (dis.ip >= dis.size() || dis.size() - dis.ip < ssde::window)
+			/* too close to the end to compare bytes */
+		{
+			++stats.misses;
+			return dis.dec();
+		}
+
+		const uint8_t *code = dis.data() + dis.ip;
+
+		entry &slot = entries[this->slot_of(code, mask)];
+
+		uint64_t seq = slot.seq.load(std::memory_order_acquire);
+
+		if (!(seq & 1))
+		{
+			uint64_t words[words_per_insn];
+			uint64_t key[2];
+
+			key[0] = slot.key[0].load(std::memory_order_relaxed);
+			key[1] = slot.key[1].load(std::memory_order_relaxed);
+
+			for (size_t i = 0; i < words_per_insn; ++i)
+				words[i] = slot.insn[i].load(std::memory_order_relaxed);
+
+			/* pairs with the fence of the writer, loads above aren't done after seq is read again */
+			std::atomic_thread_fence(std::memory_order_acquire);
+
+			if (slot.seq.load(std::memory_order_relaxed) == seq)
+				/* nobody wrote the slot while it was read */
+			{
+				ssde_insn insn;
+
+				memcpy(static_cast<void *>(&insn), words, sizeof(ssde_insn));
+
+				if (insn.length != 0)
+				{
+					uint64_t want[2];
+
+					this->key_of(code, insn.length, want);
+
+					if (want[0] == key[0] && want[1] == key[1])
+					{
+						++stats.hits;
+
+						this->restore(dis, insn);
+						return true;
+					}
+				}
+			}
+		}
+
+		++stats.misses;
+
+		dis.dec();
+
+		if (!dis.error && !(seq & 1) && slot.seq.compare_exchange_strong(seq, seq + 1, std::memory_order_acquire))
+			/* the slot is ours until seq is even again */
+		{
+			/* the odd seq is seen before any store below, as readers check it after theirs */
+			std::atomic_thread_fence(std::memory_order_release);
+
+			uint64_t words[words_per_insn];
+			uint64_t key[2];
+
+			const ssde_insn &insn = dis;
+
+			memcpy(words, static_cast<const void *>(&insn), sizeof(ssde_insn));
+			this->key_of(code, dis.length, key);
+
+			slot.key[0].store(key[0], std::memory_order_relaxed);
+			slot.key[1].store(key[1], std::memory_order_relaxed);
+
+			for (size_t i = 0; i < words_per_insn; ++i)
+				slot.insn[i].store(words[i], std::memory_order_relaxed);
+
+			slot.seq.store(seq + 2, std::memory_order_release);
+		}
+
+		return true;
+	}
+
+	void clear()                            // Drop every record, not to be called while in use.
+	{
+		for (size_t i = 0; i <= mask; ++i)
+		{
+			entries[i].seq.store(0, std::memory_order_relaxed);
+			entries[i].key[0].store(0, std::memory_order_relaxed);
+			entries[i].key[1].store(0, std::memory_order_relaxed);
+
+			for (size_t w = 0; w < words_per_insn; ++w)
+				entries[i].insn[w].store(0, std::memory_order_relaxed);
+		}
+	}
+
+	size_t slots() const                    // Number of records kept at most.
+	{
+		return mask + 1;
+	}
+
+private:
+	enum : size_t { words_per_insn = sizeof(ssde_insn) / 8 };
+
+	/*
+	* A record as atomic words, so that reading one that is being written
+	* is a retry and not a data race.
+	*/
+	struct entry
+	{
+		std::atomic<uint64_t> seq;          // Odd while the slot is written.
+		std::atomic<uint64_t> key[2];       // Bytes of the instruction.
+		std::atomic<uint64_t> insn[words_per_insn]; // Its record, length 0 if the slot is free.
+	};
+
+	size_t                   mask;
+	std::unique_ptr<entry[]> entries;
+};
@@ -0,0 +1,370 @@
+/*
+* The SSDE header file for basic blocks and control flow graphs.
+* Copyright (C) 2015, Constantine Shablya. See Copyright Notice in LICENSE.md
+*/
+#pragma once
+#include "ssde.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+
+/*
+* Control flow graph of a function, stored flat: blocks and edges are rows
+* of a few columns each, edges of a block are a contiguous range of the
+* edge columns (compressed sparse rows). A graph reused between build()
+* calls doesn't allocate once its columns are large enough, its scratch
+* included: a bit per byte of code for instructions seen, which is
+* cleared by the instructions found rather than a whole code size over.
+*
+* Blocks are sorted by offset. A block ends with a terminator, or right
+* before an instruction that is a branch target itself. Calls end blocks
+* as well, their targets are kept as e_call edges but not followed, the
+* callee is a graph on its own.
+*/
+struct ssde_cfg
+{
+	/*
+	* Kinds of block terminators, the same as flow control classes.
+	*/
+	enum : uint8_t
+	{
+		k_none          = ssde_insn::flow_none,          // Not a terminator, the next instruction is a branch target.
+		k_jcc           = ssde_insn::flow_jcc,           // Conditional branch.
+		k_jmp           = ssde_insn::flow_jmp,           // Direct jump.
+		k_call          = ssde_insn::flow_call,          // Direct call.
+		k_ret           = ssde_insn::flow_ret,           // Return.
+		k_jmp_indirect  = ssde_insn::flow_jmp_indirect,  // Jump through a register or memory, or a far jump.
+		k_call_indirect = ssde_insn::flow_call_indirect, // Call through a register or memory, or a far call.
+		k_stop          = ssde_insn::flow_halt           // HLT, UD* or a decoding error, flow doesn't go on.
+	};
+
+	/*
+	* Kinds of edges.
+	*/
+	enum : uint8_t
+	{
+		e_fall  = 0,                        // To the next block, also past calls.
+		e_taken = 1,                        // To the target of a branch.
+		e_call  = 2                         // To the callee, never in the graph.
+	};
+
+	enum : uint32_t { outside = 0xffffffff }; // Block index of targets outside of the graph.
+
+	static uint8_t kind_of(const ssde_insn &insn) // Kind of terminator insn is, k_none if it isn't one.
+	{
+		if (insn.error)
+			return k_stop;
+
+		if (insn.flow == ssde_insn::flow_syscall || insn.flow == ssde_insn::flow_interrupt)
+			/* these return right past themselves */
+		{
+			return k_none;
+		}
+
+		return insn.flow;
+	}
+
+	/*
+	* Builds the graph of the function at entry, an offset into the code of
+	* dis. Doesn't touch dis, so graphs of different functions can be built
+	* from the same disassembler on different threads.
+	*/
+	template <class arch>
+	void build(const arch &dis, size_t entry);
+
+	size_t blocks() const                   // Number of blocks.
+	{
+		return block_start.size();
+	}
+
+	size_t edges() const                    // Number of edges.
+	{
+		return edge_to.size();
+	}
+
+	uint32_t block_at(uint64_t offset) const // Index of the block starting at offset, outside if none.
+	{
+		auto it = std::lower_bound(block_start.begin(), block_start.end(), offset);
+
+		if (it == block_start.end() || *it != offset)
+			return outside;
+
+		return static_cast<uint32_t>(it - block_start.begin());
+	}
+
+	/*
+	* Takes the blocks and edges of another graph, but not its scratch,
+	* so that one graph can build many while each keeps only its own.
+	*/
+	void assign(const ssde_cfg &graph)
+	{
+		entry       = graph.entry;
+		block_start = graph.block_start;
+		block_end   = graph.block_end;
+		block_kind  = graph.block_kind;
+		block_edges = graph.block_edges;
+		edge_to     = graph.edge_to;
+		edge_target = graph.edge_target;
+		edge_kind   = graph.edge_kind;
+	}
+
+	uint32_t entry = outside;               // Index of the entry block.
+
+	std::vector<uint64_t> block_start;      // Offset of the first instruction.
+	std::vector<uint64_t> block_end;        // Offset past the last instruction.
+	std::vector<uint8_t>  block_kind;       // k_* kind of the last instruction.
+	std::vector<uint32_t> block_edges;      // Edges of block b are block_edges[b] to block_edges[b + 1].
+
+	std::vector<uint32_t> edge_to;          // Index of the block the edge leads to, outside if none.
+	std::vector<uint64_t> edge_target;      // Offset the edge leads to.
+	std::vector<uint8_t>  edge_kind;        // e_* kind of the edge.
+
+private:
+	struct insn_row                         // An instruction found while building.
+	{
+		uint64_t offset;
+		uint64_t target;
+		uint8_t  length;
+		uint8_t  kind;
+		bool     leader;
+		bool     placed;
+	};
+
+	std::vector<insn_row> insns;            // Scratch, kept to be reused.
+	std::vector<uint64_t> work;             // Offsets yet to be followed.
+	std::vector<uint64_t> leaders;          // Offsets blocks start at.
+	std::vector<uint64_t> seen;             // Bit per byte of code, set where an instruction was decoded.
+
+	void add_edge(uint64_t target, uint8_t kind)
+	{
+		/* a callee is another graph, even where its code is in this one (recursion, call/pop) */
+		edge_to.push_back(kind == e_call ? outside : block_at(target));
+		edge_target.push_back(target);
+		edge_kind.push_back(kind);
+	}
+};
+
+template <class arch>
+void ssde_cfg::build(const arch &dis, size_t entry)
+{
+	block_start.clear();
+	block_end.clear();
+	block_kind.clear();
+	block_edges.clear();
+	edge_to.clear();
+	edge_target.clear();
+	edge_kind.clear();
+	insns.clear();
+	work.clear();
+	leaders.clear();
+
+	this->entry = outside;
+
+	/* bits are all clear between builds, only more code needs more of them */
+	if (seen.size() < (dis.size() + 63) / 64)
+		seen.resize((dis.size() + 63) / 64);
+
+	/* -- find the instructions of the function ---------------------------- */
+	work.push_back(entry);
+	leaders.push_back(entry);
+
+	arch flow(dis);
+
+	while (!work.empty())
+	{
+		flow.ip = static_cast<size_t>(work.back());
+		work.pop_back();
+
+		for (;;)
+		{
+			if (flow.ip >= flow.size())
+				break;
+
+			uint64_t &word = seen[flow.ip / 64];
+			uint64_t  bit  = 1ull << (flow.ip % 64);
+
+			if (word & bit)
+				/* ran into known code, which now has another way in */
+			{
+				leaders.push_back(flow.ip);
+				break;
+			}
+
+			word |= bit;
+
+			flow.dec();
+
+			uint8_t kind = kind_of(flow);
+
+			/* targets are offsets as well, wrapping around at the width of addresses */
+			uint64_t target = flow.has_rel ? flow.abs - flow.base_address() : 0;
+
+			if (arch::address_bits < 64)
+				target &= (1ull << (arch::address_bits % 64)) - 1;
+
+			insn_row row = { flow.ip, target, flow.length, kind, false, false };
+			insns.push_back(row);
+
+			if (kind == k_none)
+			{
+				flow.next();
+				continue;
+			}
+
+			if (kind == k_jcc || kind == k_jmp)
+				/* calls aren't followed, the callee is another graph */
+			{
+				work.push_back(row.target);
+				leaders.push_back(row.target);
+			}
+
+			if (kind == k_jcc || kind == k_call || kind == k_call_indirect)
+				/* flow goes on past the branch, in a new block */
+			{
+				work.push_back(flow.ip + flow.length);
+				leaders.push_back(flow.ip + flow.length);
+			}
+
+			break;
+		}
+	}
+
+	/* every bit set is an instruction found, those are all there is to clear */
+	for (const insn_row &row : insns)
+		seen[row.offset / 64] &= ~(1ull << (row.offset % 64));
+
+	if (insns.empty())
+		return;
+
+	auto by_offset = [](const insn_row &a, const insn_row &b)
+	{
+		return a.offset < b.offset;
+	};
+
+	auto find = [&](uint64_t offset) -> insn_row *
+	{
+		insn_row key = { offset, 0, 0, 0, false, false };
+
+		auto it = std::lower_bound(insns.begin(), insns.end(), key, by_offset);
+
+		return it != insns.end() && it->offset == offset ? &*it : nullptr;
+	};
+
+	std::sort(insns.begin(), insns.end(), by_offset);
+
+	for (uint64_t offset : leaders)
+	{
+		if (insn_row *row = find(offset))
+			row->leader = true;
+	}
+
+	/* -- cut them into blocks, in order of their offsets ------------------ */
+	for (insn_row &first : insns)
+	{
+		if (first.placed)
+			continue;
+
+		insn_row *last = &first;
+
+		for (;;)
+		{
+			last->placed = true;
+
+			if (last->kind != k_none)
+				break;
+
+			insn_row *next = find(last->offset + last->length);
+
+			if (!next || next->leader || next->placed)
+				break;
+
+			last = next;
+		}
+
+		block_start.push_back(first.offset);
+		block_end.push_back(last->offset + last->length);
+		block_kind.push_back(last->kind);
+
+		/* index of the last instruction until edges are added */
+		block_edges.push_back(static_cast<uint32_t>(last - &insns[0]));
+	}
+
+	/* -- edges, now that every block is known ----------------------------- */
+	for (size_t b = 0; b < blocks(); ++b)
+	{
+		const insn_row &last = insns[block_edges[b]];
+
+		block_edges[b] = static_cast<uint32_t>(edges());
+
+		switch (last.kind)
+		{
+		case k_jcc:
+			add_edge(last.target, e_taken);
+			add_edge(block_end[b], e_fall);
+			break;
+
+		case k_jmp:
+			add_edge(last.target, e_taken);
+			break;
+
+		case k_call:
+			add_edge(last.target, e_call);
+			add_edge(block_end[b], e_fall);
+			break;
+
+		case k_call_indirect:
+		case k_none:
+			add_edge(block_end[b], e_fall);
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	block_edges.push_back(static_cast<uint32_t>(edges()));
+
+	this->entry = block_at(entry);
+}
+
+
+/*
+* Graphs of functions at entries, one per entry, built on threads
+* (0 for one per core) which take the next entry once done with one.
+*/
+template <class arch>
+std::vector<ssde_cfg> ssde_cfg_build(const arch &dis, const std::vector<size_t> &entries, unsigned threads = 0)
+{
+	std::vector<ssde_cfg> graphs(entries.size());
+	std::atomic<size_t>   next(0);
+
+	if (threads == 0)
+		threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+	auto work = [&]()
+	{
+		/* graphs are built here, so that scratch is one per thread rather than per graph */
+		ssde_cfg graph;
+
+		for (size_t i; (i = next.fetch_add(1)) < entries.size(); )
+		{
+			graph.build(dis, entries[i]);
+			graphs[i].assign(graph);
+		}
+	};
+
+	std::vector<std::thread> workers;
+
+	for (unsigned t = 1; t < threads && t < entries.size(); ++t)
+		workers.emplace_back(work);
+
+	work();
+
+	for (auto &worker : workers)
+		worker.join();
+
+	return graphs;
+}
@@ -0,0 +1,193 @@
+/*
+* The SSDE header file for recursive descent split between threads.
+* Copyright (C) 2015, Constantine Shablya. See Copyright Notice in LICENSE.md
+*/
+#pragma once
+#include "ssde.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/*
+* Whether execution may go on to the instruction following insn, i.e.
+* insn isn't an unconditional jump, return, HLT or UD*. Calls are assumed
+* to return. Decoding errors end the flow as well.
+*/
+inline bool ssde_falls_through(const ssde_insn &insn)
+{
+	if (insn.error)
+		return false;
+
+	switch (insn.flow)
+	{
+	case ssde_insn::flow_jmp:
+	case ssde_insn::flow_ret:
+	case ssde_insn::flow_jmp_indirect:
+	case ssde_insn::flow_halt:
+		return false;
+
+	default:
+		return true;
+	}
+}
+
+
+/*
+* Recursive descent of the code of dis, starting from entries (offsets
+* into the code). Instructions are decoded one after another until flow
+* can't go on (see ssde_falls_through()), targets of direct jumps,
+* branches and calls (abs less the base address) are queued and followed
+* as well. Returns offsets of every instruction reached, sorted.
+*
+* Queued targets are spread between threads, each thread works off its
+* own queue and steals from the others once it runs dry. Instructions
+* are claimed in a bitmap shared by all threads with an atomic OR before
+* they are decoded, so no offset is decoded twice and a thread running
+* into code someone else went through stops right there.
+*
+* threads is the number of threads to use, 0 for one per core.
+*/
+template <class arch>
+std::vector<size_t> ssde_descent(const arch &dis, const std::vector<size_t> &entries, unsigned threads = 0)
+{
+	struct queue
+	{
+		std::mutex         lock;
+		std::deque<size_t> tasks;
+	};
+
+	size_t size = dis.size();
+
+	if (threads == 0)
+		threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+	/* bit per offset, set once an instruction there is claimed */
+	std::unique_ptr<std::atomic<uint64_t>[]> visited(new std::atomic<uint64_t>[size / 64 + 1]);
+
+	for (size_t i = 0; i <= size / 64; ++i)
+		visited[i].store(0, std::memory_order_relaxed);
+
+	std::unique_ptr<queue[]> queues(new queue[threads]);
+	std::atomic<size_t>      pending(0);
+
+	auto push = [&](unsigned self, size_t ip)
+	{
+		if (ip >= size || visited[ip / 64].load(std::memory_order_relaxed) & 1ull << ip % 64)
+			return;
+
+		pending.fetch_add(1);
+
+		std::lock_guard<std::mutex> guard(queues[self].lock);
+		queues[self].tasks.push_back(ip);
+	};
+
+	auto pop = [&](unsigned self, size_t &ip) -> bool
+	{
+		for (unsigned i = 0; i < threads; ++i)
+		{
+			/* own queue is worked off LIFO, others are stolen from FIFO */
+			queue &victim = queues[(self + i) % threads];
+
+			std::lock_guard<std::mutex> guard(victim.lock);
+
+			if (victim.tasks.empty())
+				continue;
+
+			if (i == 0)
+			{
+				ip = victim.tasks.back();
+				victim.tasks.pop_back();
+			}
+			else
+			{
+				ip = victim.tasks.front();
+				victim.tasks.pop_front();
+			}
+
+			return true;
+		}
+
+		return false;
+	};
+
+	auto work = [&](unsigned self)
+	{
+		arch walk(dis);
+
+		for (;;)
+		{
+			if (!pop(self, walk.ip))
+			{
+				if (pending.load() == 0)
+					break;
+
+				std::this_thread::yield();
+				continue;
+			}
+
+			for (;;)
+			{
+				uint64_t bit = 1ull << walk.ip % 64;
+
+				if (visited[walk.ip / 64].fetch_or(bit) & bit)
+					/* someone got here first */
+				{
+					break;
+				}
+
+				walk.dec();
+
+				if (walk.has_rel && !walk.error &&
+				    (walk.flow == ssde_insn::flow_jcc || walk.flow == ssde_insn::flow_jmp || walk.flow == ssde_insn::flow_call))
+					/* branch targets */
+				{
+					push(self, static_cast<size_t>(walk.abs - walk.base_address()));
+				}
+
+				if (!ssde_falls_through(walk))
+					break;
+
+				walk.next();
+
+				if (walk.ip >= size)
+					break;
+			}
+
+			pending.fetch_sub(1);
+		}
+	};
+
+	for (size_t ip : entries)
+		push(0, ip);
+
+	std::vector<std::thread> workers;
+
+	for (unsigned t = 1; t < threads; ++t)
+		workers.emplace_back(work, t);
+
+	work(0);
+
+	for (auto &worker : workers)
+		worker.join();
+
+	std::vector<size_t> offsets;
+
+	for (size_t i = 0; i <= size / 64; ++i)
+	{
+		uint64_t word = visited[i].load(std::memory_order_relaxed);
+
+		for (size_t bit = 0; bit < 64; ++bit)
+		{
+			if (word >> bit & 1)
+				offsets.push_back(i*64 + bit);
+		}
+	}
+
+	return offsets;
+}
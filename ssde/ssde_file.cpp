@@ -0,0 +1,670 @@
+/*
+* The SSDE implementation for loading code out of ELF and PE/COFF files.
+* Copyright (C) 2015, Constantine Shablya. See Copyright Notice in LICENSE.md
+*/
+#include "ssde_file.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+/* files are mapped rather than read where there is mmap */
+#define SSDE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*
+* Layouts are taken from the "System V Application Binary Interface"
+* (ELF) and the "Microsoft Portable Executable and Common Object File
+* Format Specification" (PE/COFF). Both store integers little endian,
+* as X86 does, so fields are copied out as they are.
+*/
+
+/*
+* Reads a T at offset at of the file, false if it's past the end.
+*/
+template <class T>
+static bool read_at(const uint8_t *data, size_t size, uint64_t at, T &value)
+{
+	if (at > size || size - at < sizeof(T))
+		return false;
+
+	memcpy(&value, data + at, sizeof(T));
+	return true;
+}
+
+/*
+* NUL terminated string at offset at of the file, cut at the end of it.
+*/
+static std::string read_string(const uint8_t *data, size_t size, uint64_t at, size_t max = ~size_t(0))
+{
+	if (at >= size)
+		return std::string();
+
+	const char *s = reinterpret_cast<const char *>(data + at);
+
+	size_t n = std::min<uint64_t>(size - at, max);
+
+	return std::string(s, std::find(s, s + n, '\0'));
+}
+
+
+bool ssde_file::open(const char *path)
+{
+	close();
+
+#if defined(SSDE_MMAP)
+	int fd = ::open(path, O_RDONLY);
+
+	if (fd < 0)
+	{
+		error = "can't open the file";
+		return false;
+	}
+
+	struct stat st;
+
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0)
+	{
+		::close(fd);
+
+		error = "the file is empty or not a regular file";
+		return false;
+	}
+
+	void *mapping = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+	/* the mapping keeps the file open */
+	::close(fd);
+
+	if (mapping == MAP_FAILED)
+	{
+		error = "can't map the file";
+		return false;
+	}
+
+	buffer      = static_cast<const uint8_t *>(mapping);
+	buffer_size = static_cast<size_t>(st.st_size);
+#else
+	std::ifstream file(path, std::ios::binary);
+
+	if (!file)
+	{
+		error = "can't open the file";
+		return false;
+	}
+
+	std::stringstream ss;
+	ss << file.rdbuf();
+
+	contents = ss.str();
+
+	if (contents.empty())
+	{
+		error = "the file is empty or not a regular file";
+		return false;
+	}
+
+	buffer      = reinterpret_cast<const uint8_t *>(contents.data());
+	buffer_size = contents.size();
+#endif
+
+	bool loaded;
+
+	if (buffer_size >= 4 && memcmp(buffer, "\x7f" "ELF", 4) == 0)
+		loaded = load_elf();
+	else if (buffer_size >= 2 && memcmp(buffer, "MZ", 2) == 0)
+		loaded = load_pe();
+	else
+		loaded = load_coff(0, 0);
+
+	if (!loaded)
+	{
+		const char *why = error;
+
+		close();
+
+		error = why;
+		return false;
+	}
+
+	std::stable_sort(sections.begin(), sections.end(), [](const ssde_section &a, const ssde_section &b)
+	{
+		return a.address < b.address;
+	});
+
+	std::sort(symbols.begin(), symbols.end(), [](const ssde_symbol &a, const ssde_symbol &b)
+	{
+		return a.address != b.address ? a.address < b.address : a.name < b.name;
+	});
+
+	/* ELF has most dynamic symbols in the static symbol table as well */
+	auto same = [](const ssde_symbol &a, const ssde_symbol &b)
+	{
+		return a.address == b.address && a.name == b.name;
+	};
+
+	symbols.erase(std::unique(symbols.begin(), symbols.end(), same), symbols.end());
+
+	error = nullptr;
+	return true;
+}
+
+void ssde_file::close()
+{
+#if defined(SSDE_MMAP)
+	if (buffer)
+		munmap(const_cast<uint8_t *>(buffer), buffer_size);
+#endif
+
+	std::string().swap(contents);
+
+	buffer      = nullptr;
+	buffer_size = 0;
+
+	format = format_none;
+	x64    = false;
+	entry  = 0;
+	error  = nullptr;
+
+	sections.clear();
+	symbols.clear();
+}
+
+const ssde_section *ssde_file::section_at(uint64_t va) const
+{
+	/* few files have more than a few dozen sections */
+	for (const ssde_section &section : sections)
+	{
+		if (section.contains(va))
+			return &section;
+	}
+
+	return nullptr;
+}
+
+
+/* -- ELF ------------------------------------------------------------------ */
+bool ssde_file::load_elf()
+{
+	enum : uint16_t { em_386 = 3, em_x86_64 = 62 };
+
+	enum : uint32_t
+	{
+		sht_symtab    = 2,
+		sht_nobits    = 8,
+		sht_dynsym    = 11,
+		shf_execinstr = 0x4,
+		pt_load       = 1,
+		pf_x          = 0x1,
+		stt_func      = 2
+	};
+
+	const uint8_t *data = buffer;
+	size_t         size = buffer_size;
+
+	uint8_t elf_class = 0, elf_data = 0;
+
+	read_at(data, size, 4, elf_class);
+	read_at(data, size, 5, elf_data);
+
+	if ((elf_class != 1 && elf_class != 2) || elf_data != 1)
+	{
+		error = "not a little endian ELF32 or ELF64 file";
+		return false;
+	}
+
+	bool wide = elf_class == 2;
+
+	/* ELF32 and ELF64 fields are the same, save for their offsets and widths */
+	auto word = [&](uint64_t at, uint64_t &value) -> bool
+	{
+		if (wide)
+			return read_at(data, size, at, value);
+
+		uint32_t narrow;
+
+		if (!read_at(data, size, at, narrow))
+			return false;
+
+		value = narrow;
+		return true;
+	};
+
+	uint16_t machine, shentsize, shnum, shstrndx, phentsize, phnum;
+	uint64_t shoff, phoff;
+
+	bool ok = read_at(data, size, 18, machine) &&
+	          word(24, entry) &&
+	          word(wide ? 32 : 28, phoff) &&
+	          word(wide ? 40 : 32, shoff) &&
+	          read_at(data, size, wide ? 54 : 42, phentsize) &&
+	          read_at(data, size, wide ? 56 : 44, phnum) &&
+	          read_at(data, size, wide ? 58 : 46, shentsize) &&
+	          read_at(data, size, wide ? 60 : 48, shnum) &&
+	          read_at(data, size, wide ? 62 : 50, shstrndx);
+
+	if (!ok)
+	{
+		error = "truncated ELF header";
+		return false;
+	}
+
+	if (machine != em_386 && machine != em_x86_64)
+	{
+		error = "not X86 or X86-64 code";
+		return false;
+	}
+
+	format = format_elf;
+	x64    = machine == em_x86_64;
+
+	struct section_header
+	{
+		uint32_t name, type;
+		uint64_t flags, address, offset, size;
+		uint32_t link;
+		uint64_t entsize;
+	};
+
+	auto section = [&](uint16_t i, section_header &sh) -> bool
+	{
+		uint64_t at = shoff + uint64_t(i) * shentsize;
+
+		return read_at(data, size, at, sh.name) &&
+		       read_at(data, size, at + 4, sh.type) &&
+		       word(at + 8, sh.flags) &&
+		       word(wide ? at + 16 : at + 12, sh.address) &&
+		       word(wide ? at + 24 : at + 16, sh.offset) &&
+		       word(wide ? at + 32 : at + 20, sh.size) &&
+		       read_at(data, size, wide ? at + 40 : at + 24, sh.link) &&
+		       word(wide ? at + 56 : at + 36, sh.entsize);
+	};
+
+	if (shoff == 0 || shnum == 0)
+		/* no section headers (stripped by sstrip and such), executable segments then */
+	{
+		for (uint16_t i = 0; i < phnum; ++i)
+		{
+			uint64_t at = phoff + uint64_t(i) * phentsize;
+
+			uint32_t type, flags;
+			uint64_t offset, address, filesz;
+
+			ok = read_at(data, size, at, type) &&
+			     read_at(data, size, wide ? at + 4 : at + 24, flags) &&
+			     word(wide ? at + 8 : at + 4, offset) &&
+			     word(wide ? at + 16 : at + 8, address) &&
+			     word(wide ? at + 32 : at + 16, filesz);
+
+			if (!ok)
+			{
+				error = "truncated ELF program headers";
+				return false;
+			}
+
+			if (type != pt_load || !(flags & pf_x) || offset > size)
+				continue;
+
+			ssde_section code = { "", address, data + offset, static_cast<size_t>(std::min<uint64_t>(filesz, size - offset)) };
+			sections.push_back(code);
+		}
+
+		return true;
+	}
+
+	section_header names;
+
+	if (shstrndx >= shnum || !section(shstrndx, names))
+	{
+		error = "truncated ELF section headers";
+		return false;
+	}
+
+	for (uint16_t i = 0; i < shnum; ++i)
+	{
+		section_header sh;
+
+		if (!section(i, sh))
+		{
+			error = "truncated ELF section headers";
+			return false;
+		}
+
+		if (sh.type == sht_symtab || sh.type == sht_dynsym)
+		{
+			section_header strings;
+
+			if (sh.link >= shnum || !section(static_cast<uint16_t>(sh.link), strings) || sh.entsize == 0)
+				continue;
+
+			for (uint64_t at = sh.offset; at - sh.offset + sh.entsize <= sh.size; at += sh.entsize)
+			{
+				uint32_t name;
+				uint8_t  info;
+				uint16_t shndx;
+				uint64_t value, length;
+
+				ok = read_at(data, size, at, name) &&
+				     read_at(data, size, wide ? at + 4 : at + 12, info) &&
+				     read_at(data, size, wide ? at + 6 : at + 14, shndx) &&
+				     word(wide ? at + 8 : at + 4, value) &&
+				     word(wide ? at + 16 : at + 8, length);
+
+				if (!ok)
+					break;
+
+				if (shndx == 0 || shndx >= 0xff00 || name == 0)
+					/* undefined, absolute, common, or the null symbol */
+				{
+					continue;
+				}
+
+				ssde_symbol symbol = { read_string(data, size, strings.offset + name, strings.size - std::min<uint64_t>(name, strings.size)), value, length, (info & 0xf) == stt_func };
+				symbols.push_back(symbol);
+			}
+		}
+
+		if (!(sh.flags & shf_execinstr) || sh.type == sht_nobits || sh.offset > size)
+			continue;
+
+		std::string name = read_string(data, size, names.offset + sh.name, names.size - std::min<uint64_t>(sh.name, names.size));
+
+		ssde_section code = { name, sh.address, data + sh.offset, static_cast<size_t>(std::min<uint64_t>(sh.size, size - sh.offset)) };
+		sections.push_back(code);
+	}
+
+	return true;
+}
+
+
+/* -- PE/COFF -------------------------------------------------------------- */
+bool ssde_file::load_pe()
+{
+	enum : uint16_t { pe32 = 0x10b, pe32_plus = 0x20b };
+
+	const uint8_t *data = buffer;
+	size_t         size = buffer_size;
+
+	uint32_t lfanew;
+	uint32_t signature;
+
+	if (!read_at(data, size, 0x3c, lfanew) || !read_at(data, size, lfanew, signature) || memcmp(&signature, "PE\0\0", 4) != 0)
+	{
+		error = "MZ file without a PE header";
+		return false;
+	}
+
+	size_t   optional = lfanew + 24;
+	uint16_t magic;
+	uint32_t entry_rva;
+	uint64_t image_base;
+
+	if (!read_at(data, size, optional, magic) || !read_at(data, size, optional + 16, entry_rva))
+	{
+		error = "truncated PE optional header";
+		return false;
+	}
+
+	if (magic == pe32)
+	{
+		uint32_t narrow;
+
+		if (!read_at(data, size, optional + 28, narrow))
+		{
+			error = "truncated PE optional header";
+			return false;
+		}
+
+		image_base = narrow;
+	}
+	else if (magic == pe32_plus)
+	{
+		if (!read_at(data, size, optional + 24, image_base))
+		{
+			error = "truncated PE optional header";
+			return false;
+		}
+	}
+	else
+	{
+		error = "unknown PE optional header";
+		return false;
+	}
+
+	if (!load_coff(lfanew + 4, image_base))
+		return false;
+
+	format = format_pe;
+	entry  = entry_rva ? image_base + entry_rva : 0;
+
+	/* -- exports, which are the only symbols most images have ------------- */
+	uint32_t directories;
+	uint32_t export_rva, export_size;
+
+	size_t directory = optional + (magic == pe32 ? 92 : 108);
+
+	if (!read_at(data, size, directory, directories) || directories == 0 ||
+	    !read_at(data, size, directory + 4, export_rva) ||
+	    !read_at(data, size, directory + 8, export_size) || export_rva == 0)
+	{
+		return true;
+	}
+
+	/* RVAs are looked up in the raw section headers, data sections included */
+	uint16_t sections_count = 0, optional_size = 0;
+
+	read_at(data, size, lfanew + 6, sections_count);
+	read_at(data, size, lfanew + 20, optional_size);
+
+	auto offset_of = [&](uint32_t rva, uint64_t &offset) -> bool
+	{
+		for (uint16_t i = 0; i < sections_count; ++i)
+		{
+			size_t   at = optional + optional_size + i*40u;
+			uint32_t virtual_size, address, raw_size, raw;
+
+			if (!read_at(data, size, at + 8, virtual_size) || !read_at(data, size, at + 12, address) ||
+			    !read_at(data, size, at + 16, raw_size) || !read_at(data, size, at + 20, raw))
+			{
+				return false;
+			}
+
+			if (rva >= address && rva - address < std::max(virtual_size, raw_size))
+			{
+				offset = uint64_t(raw) + (rva - address);
+				return rva - address < raw_size;
+			}
+		}
+
+		return false;
+	};
+
+	uint64_t exports;
+	uint32_t functions_count, names_count, functions, names, ordinals;
+
+	if (!offset_of(export_rva, exports) ||
+	    !read_at(data, size, exports + 20, functions_count) ||
+	    !read_at(data, size, exports + 24, names_count) ||
+	    !read_at(data, size, exports + 28, functions) ||
+	    !read_at(data, size, exports + 32, names) ||
+	    !read_at(data, size, exports + 36, ordinals))
+	{
+		return true;
+	}
+
+	uint64_t functions_at, names_at, ordinals_at;
+
+	if (!offset_of(functions, functions_at) || !offset_of(names, names_at) || !offset_of(ordinals, ordinals_at))
+		return true;
+
+	for (uint32_t i = 0; i < names_count; ++i)
+	{
+		uint32_t name, rva;
+		uint16_t ordinal;
+		uint64_t name_at;
+
+		if (!read_at(data, size, names_at + i*4ull, name) || !read_at(data, size, ordinals_at + i*2ull, ordinal) ||
+		    ordinal >= functions_count || !read_at(data, size, functions_at + ordinal*4ull, rva) ||
+		    !offset_of(name, name_at))
+		{
+			break;
+		}
+
+		if (rva >= export_rva && rva - export_rva < export_size)
+			/* forwarded to another DLL */
+		{
+			continue;
+		}
+
+		uint64_t address = image_base + rva;
+
+		ssde_symbol symbol = { read_string(data, size, name_at), address, 0, section_at(address) != nullptr };
+		symbols.push_back(symbol);
+	}
+
+	return true;
+}
+
+/*
+* COFF file header at offset header, followed by the optional header (of
+* images) and section headers. Objects start with it right away.
+*/
+bool ssde_file::load_coff(size_t header, uint64_t image_base)
+{
+	enum : uint16_t { machine_i386 = 0x14c, machine_amd64 = 0x8664 };
+
+	enum : uint32_t
+	{
+		scn_cnt_code    = 0x00000020,
+		scn_mem_execute = 0x20000000
+	};
+
+	const uint8_t *data = buffer;
+	size_t         size = buffer_size;
+
+	uint16_t machine, sections_count, optional_size;
+	uint32_t symbols_at, symbols_count;
+
+	bool ok = read_at(data, size, header, machine) &&
+	          read_at(data, size, header + 2, sections_count) &&
+	          read_at(data, size, header + 8, symbols_at) &&
+	          read_at(data, size, header + 12, symbols_count) &&
+	          read_at(data, size, header + 16, optional_size);
+
+	if (!ok || (machine != machine_i386 && machine != machine_amd64))
+	{
+		error = header == 0 ? "not an ELF, PE or COFF file" : "not X86 or X86-64 code";
+		return false;
+	}
+
+	if (header == 0 && optional_size != 0)
+	{
+		error = "not an ELF, PE or COFF file";
+		return false;
+	}
+
+	format = format_coff;
+	x64    = machine == machine_amd64;
+
+	/* names longer than 8 bytes are in the string table, right past the symbols */
+	uint64_t strings = symbols_at + uint64_t(symbols_count) * 18;
+
+	auto name_of = [&](uint64_t at, size_t max) -> std::string
+	{
+		uint32_t zeroes, offset;
+
+		if (read_at(data, size, at, zeroes) && zeroes == 0 && read_at(data, size, at + 4, offset) && symbols_at != 0)
+			return read_string(data, size, strings + offset);
+
+		return read_string(data, size, at, max);
+	};
+
+	std::vector<uint32_t> addresses(sections_count);
+
+	for (uint16_t i = 0; i < sections_count; ++i)
+	{
+		size_t   at = header + 20 + optional_size + i*40u;
+		uint32_t virtual_size, address, raw_size, raw, characteristics;
+
+		ok = read_at(data, size, at + 8, virtual_size) &&
+		     read_at(data, size, at + 12, address) &&
+		     read_at(data, size, at + 16, raw_size) &&
+		     read_at(data, size, at + 20, raw) &&
+		     read_at(data, size, at + 36, characteristics);
+
+		if (!ok)
+		{
+			error = "truncated COFF section headers";
+			return false;
+		}
+
+		addresses[i] = address;
+
+		if (!(characteristics & (scn_cnt_code | scn_mem_execute)) || raw == 0 || raw > size)
+			continue;
+
+		std::string name = read_string(data, size, at, 8);
+
+		if (name.size() > 1 && name[0] == '/' && symbols_at != 0)
+			/* "/n", n being the offset of the name in the string table */
+		{
+			name = read_string(data, size, strings + strtoul(name.c_str() + 1, nullptr, 10));
+		}
+
+		/* raw data of images is padded to the file alignment, the virtual size is the real one */
+		size_t length = raw_size;
+
+		if (header != 0 && virtual_size != 0)
+			length = std::min(virtual_size, raw_size);
+
+		ssde_section code = { name, image_base + address, data + raw, std::min<size_t>(length, size - raw) };
+		sections.push_back(code);
+	}
+
+	for (uint32_t i = 0; symbols_at != 0 && i < symbols_count; ++i)
+	{
+		uint64_t at = symbols_at + uint64_t(i) * 18;
+
+		uint32_t value;
+		int16_t  section;
+		uint16_t type;
+		uint8_t  storage, aux;
+
+		if (!read_at(data, size, at + 8, value) || !read_at(data, size, at + 12, section) ||
+		    !read_at(data, size, at + 14, type) || !read_at(data, size, at + 16, storage) ||
+		    !read_at(data, size, at + 17, aux))
+		{
+			break;
+		}
+
+		/* auxiliary records follow the symbol they belong to */
+		i += aux;
+
+		if (section <= 0 || section > sections_count)
+			/* undefined, absolute or debugging symbol */
+		{
+			continue;
+		}
+
+		if (storage == 3 && type == 0 && aux != 0)
+			/* static with a section definition record, the section itself */
+		{
+			continue;
+		}
+
+		ssde_symbol symbol = { name_of(at, 8), image_base + addresses[section - 1] + value, 0, (type >> 4 & 3) == 2 };
+		symbols.push_back(symbol);
+	}
+
+	return true;
+}
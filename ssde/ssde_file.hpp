@@ -0,0 +1,174 @@
+/*
+* The SSDE header file for loading code out of ELF and PE/COFF files.
+* Copyright (C) 2015, Constantine Shablya. See Copyright Notice in LICENSE.md
+*/
+#pragma once
+#include "ssde.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+/*
+* An executable section of a file. Its bytes are those of the mapped
+* file, so they live as long as the ssde_file does.
+*/
+struct ssde_section
+{
+	std::string    name;                    // Name, "" if the file has none (ELF without section headers).
+	uint64_t       address;                 // Virtual address of the first byte.
+	const uint8_t *data;                    // Bytes of the section in the file.
+	size_t         size;                    // Bytes in the file, memory past them is zeroed by loaders and not decoded.
+
+	ssde_image image() const                // Code of the section at its address, abs of disassemblers on it is a virtual address.
+	{
+		return ssde_image(data, size, address);
+	}
+
+	bool contains(uint64_t va) const        // Whether virtual address va is within the section.
+	{
+		return va >= address && va - address < size;
+	}
+};
+
+
+/*
+* A symbol of a file.
+*/
+struct ssde_symbol
+{
+	std::string name;
+	uint64_t    address;                    // Virtual address.
+	uint64_t    size;                       // Size in bytes, 0 if unknown (always so for PE/COFF).
+	bool        function;                   // Whether it is code rather than data.
+};
+
+
+/*
+* ELF (32 and 64 bit) or PE/COFF (images and objects) file of X86 or
+* X86-64 code, mapped into memory read only. Nothing is copied: sections
+* point into the mapping and disassemblers made from them decode it in
+* place, e.g.:
+*
+*   ssde_file file("a.out");
+*
+*   for (auto &section : file.sections)
+*     for (ssde_x64 dis(section.image()); dis.dec(); dis.next())
+*       ...
+*
+* with abs of relative branches being virtual addresses. Mapping doesn't
+* change once a file is open, so threads can share it.
+*
+* Files that can't be loaded (not there, truncated, not X86) leave
+* format at format_none and error saying why.
+*/
+class ssde_file
+{
+public:
+	enum : uint8_t
+	{
+		format_none = 0,                    // Nothing loaded.
+		format_elf  = 1,                    // ELF executable, shared or relocatable object.
+		format_pe   = 2,                    // PE image (EXE, DLL etc).
+		format_coff = 3                     // COFF object.
+	};
+
+	ssde_file()
+	{
+	}
+
+	explicit ssde_file(const char *path)
+	{
+		open(path);
+	}
+
+	ssde_file(const ssde_file &) = delete;
+	ssde_file &operator=(const ssde_file &) = delete;
+
+	~ssde_file()
+	{
+		close();
+	}
+
+	/*
+	* Maps the file at path, closing the one open before. Returns false,
+	* with error set, if it couldn't be loaded.
+	*/
+	bool open(const char *path);
+
+	/*
+	* Unmaps the file, sections and symbols are dropped.
+	*/
+	void close();
+
+	const ssde_section *section_at(uint64_t va) const; // Section with virtual address va in it, nullptr if none.
+
+	const uint8_t *data() const             // Whole file.
+	{
+		return buffer;
+	}
+
+	size_t size() const                     // Size of the file, in bytes.
+	{
+		return buffer_size;
+	}
+
+	uint8_t     format = format_none;       // format_* of the file.
+	bool        x64    = false;             // X86-64 code, to be decoded with ssde_x64 rather than ssde_x86.
+	uint64_t    entry  = 0;                 // Virtual address of the entry point, 0 if none.
+	const char *error  = nullptr;           // Why open() failed.
+
+	std::vector<ssde_section> sections;     // Executable sections, sorted by address.
+	std::vector<ssde_symbol>  symbols;      // Symbols with addresses, sorted by address.
+
+private:
+	bool load_elf();
+	bool load_pe();
+	bool load_coff(size_t header, uint64_t image_base);
+
+	const uint8_t *buffer      = nullptr;   // Mapping of the file.
+	size_t         buffer_size = 0;         // Size of the file, in bytes.
+	std::string    contents;                // The file, where it is read rather than mapped.
+};
+
+
+/*
+* Calls f(dis, section) for every executable section of file, dis being
+* an arch disassembler at the start of the section. Sections are spread
+* between threads (0 for one per core), which take the next section once
+* done with one. A single large section is better split by ssde_sweep()
+* given the disassembler.
+*/
+template <class arch, class function>
+void ssde_for_each_section(const ssde_file &file, function f, unsigned threads = 0)
+{
+	const std::vector<ssde_section> &sections = file.sections;
+
+	std::atomic<size_t> next(0);
+
+	if (threads == 0)
+		threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+	auto work = [&]()
+	{
+		for (size_t i; (i = next.fetch_add(1)) < sections.size(); )
+		{
+			arch dis(sections[i].image());
+
+			f(dis, sections[i]);
+		}
+	};
+
+	std::vector<std::thread> workers;
+
+	for (unsigned t = 1; t < threads && t < sections.size(); ++t)
+		workers.emplace_back(work);
+
+	work();
+
+	for (auto &worker : workers)
+		worker.join();
+}
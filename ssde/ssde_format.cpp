@@ -0,0 +1,2924 @@
+/*
+* The SSDE implementation for text of X86 and X86-64 instructions.
+* Copyright (C) 2015, Constantine Shablya. See Copyright Notice in LICENSE.md
+*/
+#include "ssde_format.hpp"
+
+#include <stdint.h>
+#include <string.h>
+
+/*
+* Mnemonics are those of the "Intel(R) 64 and IA-32 Architectures Software
+* Developer's Manual", lowercase. Where one encoding has several names
+* (JE and JZ, SAL and SHL) the one GNU and LLVM tools print is used.
+* The tables are laid out like those of ssde_x86.cpp: opcodes in rows of
+* eight, octal row numbers on the right.
+*/
+
+/* mnemonics, m_bad is an opcode nothing is known of */
+enum : uint16_t
+{
+	m_bad, m_aaa, m_aad, m_aam, m_aas, m_adc, m_adcx, m_add, m_addpd, m_addps, m_addsd, m_addss,
+	m_addsubpd, m_addsubps, m_adox, m_aesdec, m_aesdec128kl, m_aesdec256kl, m_aesdeclast,
+	m_aesdecwide128kl, m_aesdecwide256kl, m_aesenc, m_aesenc128kl, m_aesenc256kl, m_aesenclast,
+	m_aesencwide128kl, m_aesencwide256kl, m_aesimc, m_aeskeygenassist, m_and, m_andn, m_andnpd,
+	m_andnps, m_andpd, m_andps, m_arpl, m_bextr, m_blendpd, m_blendps, m_blendvpd, m_blendvps,
+	m_blsi, m_blsmsk, m_blsr, m_bound, m_bsf, m_bsr, m_bswap, m_bt, m_btc, m_btr, m_bts, m_bzhi,
+	m_call, m_cbw, m_cdq, m_cdqe, m_clac, m_clc, m_cld, m_cldemote, m_clflush, m_clflushopt,
+	m_clgi, m_cli, m_clrssbsy, m_clts, m_clui, m_clwb, m_clzero, m_cmc, m_cmova, m_cmovae, m_cmovb,
+	m_cmovbe, m_cmove, m_cmovg, m_cmovge, m_cmovl, m_cmovle, m_cmovne, m_cmovno, m_cmovnp,
+	m_cmovns, m_cmovo, m_cmovp, m_cmovs, m_cmp, m_cmppd, m_cmpps, m_cmpsb, m_cmpsd, m_cmpsq,
+	m_cmpss, m_cmpsw, m_cmpxchg, m_cmpxchg16b, m_cmpxchg8b, m_comisd, m_comiss, m_cpuid, m_cqo,
+	m_crc32, m_cvtdq2pd, m_cvtdq2ps, m_cvtpd2dq, m_cvtpd2pi, m_cvtpd2ps, m_cvtpi2pd, m_cvtpi2ps,
+	m_cvtps2dq, m_cvtps2pd, m_cvtps2pi, m_cvtsd2si, m_cvtsd2ss, m_cvtsi2sd, m_cvtsi2ss, m_cvtss2sd,
+	m_cvtss2si, m_cvttpd2dq, m_cvttpd2pi, m_cvttps2dq, m_cvttps2pi, m_cvttsd2si, m_cvttss2si,
+	m_cwd, m_cwde, m_daa, m_das, m_dec, m_div, m_divpd, m_divps, m_divsd, m_divss, m_dppd, m_dpps,
+	m_emms, m_encls, m_enclu, m_enclv, m_encodekey128, m_encodekey256, m_endbr32, m_endbr64,
+	m_enqcmd, m_enqcmds, m_enter, m_extractps, m_extrq, m_f2xm1, m_fabs, m_fadd, m_faddp, m_fbld,
+	m_fbstp, m_fchs, m_fcmovb, m_fcmovbe, m_fcmove, m_fcmovnb, m_fcmovnbe, m_fcmovne, m_fcmovnu,
+	m_fcmovu, m_fcom, m_fcomi, m_fcomip, m_fcomp, m_fcompp, m_fcos, m_fdecstp, m_fdiv, m_fdivp,
+	m_fdivr, m_fdivrp, m_femms, m_ffree, m_ffreep, m_fiadd, m_ficom, m_ficomp, m_fidiv, m_fidivr,
+	m_fild, m_fimul, m_fincstp, m_fist, m_fistp, m_fisttp, m_fisub, m_fisubr, m_fld, m_fld1,
+	m_fldcw, m_fldenv, m_fldl2e, m_fldl2t, m_fldlg2, m_fldln2, m_fldpi, m_fldz, m_fmul, m_fmulp,
+	m_fnclex, m_fninit, m_fnop, m_fnsave, m_fnstcw, m_fnstenv, m_fnstsw, m_fpatan, m_fprem,
+	m_fprem1, m_fptan, m_frndint, m_frstor, m_fscale, m_fsin, m_fsincos, m_fsqrt, m_fst, m_fstp,
+	m_fsub, m_fsubp, m_fsubr, m_fsubrp, m_ftst, m_fucom, m_fucomi, m_fucomip, m_fucomp, m_fucompp,
+	m_fwait, m_fxam, m_fxch, m_fxrstor, m_fxrstor64, m_fxsave, m_fxsave64, m_fxtract, m_fyl2x, m_fyl2xp1,
+	m_getsec, m_gf2p8affineinvqb, m_gf2p8affineqb, m_gf2p8mulb, m_haddpd, m_haddps, m_hlt,
+	m_hreset, m_hsubpd, m_hsubps, m_idiv, m_imul, m_in, m_inc, m_incsspd, m_incsspq, m_insb,
+	m_insd, m_insertps, m_insertq, m_insw, m_int, m_int3, m_into, m_invd, m_invept, m_invlpg,
+	m_invlpga, m_invlpgb, m_invpcid, m_invvpid, m_iret, m_iretd, m_iretq, m_ja, m_jae, m_jb, m_jbe,
+	m_jcxz, m_je, m_jecxz, m_jg, m_jge, m_jl, m_jle, m_jmp, m_jne, m_jno, m_jnp, m_jns, m_jo, m_jp,
+	m_jrcxz, m_js, m_kaddb, m_kaddd, m_kaddq, m_kaddw, m_kandb, m_kandd, m_kandnb, m_kandnd,
+	m_kandnq, m_kandnw, m_kandq, m_kandw, m_kmovb, m_kmovd, m_kmovq, m_kmovw, m_knotb, m_knotd,
+	m_knotq, m_knotw, m_korb, m_kord, m_korq, m_kortestb, m_kortestd, m_kortestq, m_kortestw,
+	m_korw, m_kshiftlb, m_kshiftld, m_kshiftlq, m_kshiftlw, m_kshiftrb, m_kshiftrd, m_kshiftrq,
+	m_kshiftrw, m_ktestb, m_ktestd, m_ktestq, m_ktestw, m_kunpckbw, m_kunpckdq, m_kunpckwd,
+	m_kxnorb, m_kxnord, m_kxnorq, m_kxnorw, m_kxorb, m_kxord, m_kxorq, m_kxorw, m_lahf, m_lar,
+	m_lcall, m_lddqu, m_ldmxcsr, m_lds, m_ldtilecfg, m_lea, m_leave, m_les, m_lfence, m_lfs,
+	m_lgdt, m_lgs, m_lidt, m_ljmp, m_lldt, m_lmsw, m_loadiwkey, m_lodsb, m_lodsd, m_lodsq, m_lodsw,
+	m_loop, m_loope, m_loopne, m_lsl, m_lss, m_ltr, m_lzcnt, m_maskmovdqu, m_maskmovq, m_maxpd,
+	m_maxps, m_maxsd, m_maxss, m_mfence, m_minpd, m_minps, m_minsd, m_minss, m_monitor, m_monitorx,
+	m_montmul, m_mov, m_movabs, m_movapd, m_movaps, m_movbe, m_movd, m_movddup, m_movdir64b,
+	m_movdiri, m_movdq2q, m_movdqa, m_movdqu, m_movhlps, m_movhpd, m_movhps, m_movlhps, m_movlpd,
+	m_movlps, m_movmskpd, m_movmskps, m_movntdq, m_movntdqa, m_movnti, m_movntpd, m_movntps,
+	m_movntq, m_movntsd, m_movntss, m_movq, m_movq2dq, m_movsb, m_movsd, m_movshdup, m_movsldup,
+	m_movsq, m_movss, m_movsw, m_movsx, m_movsxd, m_movupd, m_movups, m_movzx, m_mpsadbw, m_mul,
+	m_mulpd, m_mulps, m_mulsd, m_mulss, m_mulx, m_mwait, m_mwaitx, m_neg, m_nop, m_not, m_or,
+	m_orpd, m_orps, m_out, m_outsb, m_outsd, m_outsw, m_pabsb, m_pabsd, m_pabsw, m_packssdw,
+	m_packsswb, m_packusdw, m_packuswb, m_paddb, m_paddd, m_paddq, m_paddsb, m_paddsw, m_paddusb,
+	m_paddusw, m_paddw, m_palignr, m_pand, m_pandn, m_pause, m_pavgb, m_pavgw, m_pblendvb,
+	m_pblendw, m_pclmulqdq, m_pcmpeqb, m_pcmpeqd, m_pcmpeqq, m_pcmpeqw, m_pcmpestri, m_pcmpestrm,
+	m_pcmpgtb, m_pcmpgtd, m_pcmpgtq, m_pcmpgtw, m_pcmpistri, m_pcmpistrm, m_pconfig, m_pdep,
+	m_pext, m_pextrb, m_pextrd, m_pextrq, m_pextrw, m_pfcmpge, m_phaddd, m_phaddsw, m_phaddw,
+	m_phminposuw, m_phsubd, m_phsubsw, m_phsubw, m_pinsrb, m_pinsrd, m_pinsrq, m_pinsrw,
+	m_pmaddubsw, m_pmaddwd, m_pmaxsb, m_pmaxsd, m_pmaxsw, m_pmaxub, m_pmaxud, m_pmaxuw, m_pminsb,
+	m_pminsd, m_pminsw, m_pminub, m_pminud, m_pminuw, m_pmovmskb, m_pmovsxbd, m_pmovsxbq,
+	m_pmovsxbw, m_pmovsxdq, m_pmovsxwd, m_pmovsxwq, m_pmovzxbd, m_pmovzxbq, m_pmovzxbw, m_pmovzxdq,
+	m_pmovzxwd, m_pmovzxwq, m_pmuldq, m_pmulhrsw, m_pmulhuw, m_pmulhw, m_pmulld, m_pmullw,
+	m_pmuludq, m_pop, m_popa, m_popad, m_popcnt, m_popf, m_popfd, m_popfq, m_por, m_prefetch,
+	m_prefetchnta, m_prefetcht0, m_prefetcht1, m_prefetcht2, m_prefetchw, m_prefetchwt1, m_psadbw,
+	m_pshufb, m_pshufd, m_pshufhw, m_pshuflw, m_pshufw, m_psignb, m_psignd, m_psignw, m_pslld,
+	m_pslldq, m_psllq, m_psllw, m_psmash, m_psrad, m_psraw, m_psrld, m_psrldq, m_psrlq, m_psrlw,
+	m_psubb, m_psubd, m_psubq, m_psubsb, m_psubsw, m_psubusb, m_psubusw, m_psubw, m_ptest,
+	m_ptwrite, m_punpckhbw, m_punpckhdq, m_punpckhqdq, m_punpckhwd, m_punpcklbw, m_punpckldq,
+	m_punpcklqdq, m_punpcklwd, m_push, m_pusha, m_pushad, m_pushf, m_pushfd, m_pushfq, m_pvalidate,
+	m_pxor, m_rcl, m_rcpps, m_rcpss, m_rcr, m_rdfsbase, m_rdgsbase, m_rdmsr, m_rdpid, m_rdpkru,
+	m_rdpmc, m_rdrand, m_rdseed, m_rdsspd, m_rdsspq, m_rdtsc, m_rdtscp, m_ret, m_retf, m_retfq,
+	m_rmpadjust, m_rmpupdate, m_rol, m_ror, m_rorx, m_roundpd, m_roundps, m_roundsd, m_roundss,
+	m_rsm, m_rsqrtps, m_rsqrtss, m_rstorssp, m_sahf, m_salc, m_sar, m_sarx, m_saveprevssp, m_sbb,
+	m_scasb, m_scasd, m_scasq, m_scasw, m_seamcall, m_seamops, m_seamret, m_senduipi, m_serialize,
+	m_seta, m_setae, m_setb, m_setbe, m_sete, m_setg, m_setge, m_setl, m_setle, m_setne, m_setno,
+	m_setnp, m_setns, m_seto, m_setp, m_sets, m_setssbsy, m_sfence, m_sgdt, m_sha1msg1, m_sha1msg2,
+	m_sha1nexte, m_sha1rnds4, m_sha256msg1, m_sha256msg2, m_sha256rnds2, m_shl, m_shld, m_shlx,
+	m_shr, m_shrd, m_shrx, m_shufpd, m_shufps, m_sidt, m_skinit, m_sldt, m_smsw, m_sqrtpd,
+	m_sqrtps, m_sqrtsd, m_sqrtss, m_stac, m_stc, m_std, m_stgi, m_sti, m_stmxcsr, m_stosb, m_stosd,
+	m_stosq, m_stosw, m_str, m_sttilecfg, m_stui, m_sub, m_subpd, m_subps, m_subsd, m_subss,
+	m_swapgs, m_syscall, m_sysenter, m_sysexit, m_sysexitq, m_sysret, m_sysretq, m_tdcall,
+	m_tdpbf16ps, m_tdpbssd, m_tdpbsud, m_tdpbusd, m_tdpbuud, m_test, m_testui, m_tileloadd,
+	m_tileloaddt1, m_tilerelease, m_tilestored, m_tilezero, m_tlbsync, m_tpause, m_tzcnt,
+	m_ucomisd, m_ucomiss, m_ud1, m_ud2, m_uiret, m_umonitor, m_umwait, m_unpckhpd, m_unpckhps,
+	m_unpcklpd, m_unpcklps, m_v4fmaddps, m_v4fmaddss, m_v4fnmaddps, m_v4fnmaddss, m_vaddpd,
+	m_vaddps, m_vaddsd, m_vaddss, m_vaddsubpd, m_vaddsubps, m_vaesdec, m_vaesdeclast, m_vaesenc,
+	m_vaesenclast, m_vaesimc, m_vaeskeygenassist, m_valignd, m_valignq, m_vandnpd, m_vandnps,
+	m_vandpd, m_vandps, m_vblendmpd, m_vblendmps, m_vblendpd, m_vblendps, m_vblendvpd, m_vblendvps,
+	m_vbroadcastf128, m_vbroadcastf32x2, m_vbroadcastf32x4, m_vbroadcastf32x8, m_vbroadcastf64x2,
+	m_vbroadcastf64x4, m_vbroadcasti128, m_vbroadcasti32x2, m_vbroadcasti32x4, m_vbroadcasti32x8,
+	m_vbroadcasti64x2, m_vbroadcasti64x4, m_vbroadcastsd, m_vbroadcastss, m_vcmppd, m_vcmpph,
+	m_vcmpps, m_vcmpsd, m_vcmpsh, m_vcmpss, m_vcomisd, m_vcomiss, m_vcompresspd, m_vcompressps,
+	m_vcvtdq2pd, m_vcvtdq2ps, m_vcvtne2ps2bf16, m_vcvtneps2bf16, m_vcvtpd2dq, m_vcvtpd2ps,
+	m_vcvtpd2qq, m_vcvtpd2udq, m_vcvtpd2uqq, m_vcvtph2ps, m_vcvtps2dq, m_vcvtps2pd, m_vcvtps2ph,
+	m_vcvtps2qq, m_vcvtps2udq, m_vcvtps2uqq, m_vcvtqq2pd, m_vcvtqq2ps, m_vcvtsd2si, m_vcvtsd2ss,
+	m_vcvtsd2usi, m_vcvtsi2sd, m_vcvtsi2ss, m_vcvtss2sd, m_vcvtss2si, m_vcvtss2usi, m_vcvttpd2dq,
+	m_vcvttpd2qq, m_vcvttpd2udq, m_vcvttpd2uqq, m_vcvttps2dq, m_vcvttps2qq, m_vcvttps2udq,
+	m_vcvttps2uqq, m_vcvttsd2si, m_vcvttsd2usi, m_vcvttss2si, m_vcvttss2usi, m_vcvtudq2pd,
+	m_vcvtudq2ps, m_vcvtuqq2pd, m_vcvtuqq2ps, m_vcvtusi2sd, m_vcvtusi2ss, m_vdbpsadbw, m_vdivpd,
+	m_vdivps, m_vdivsd, m_vdivss, m_vdpbf16ps, m_vdppd, m_vdpps, m_verr, m_verw, m_vexp2pd,
+	m_vexp2ps, m_vexpandpd, m_vexpandps, m_vextractf128, m_vextractf32x4, m_vextractf32x8,
+	m_vextractf64x2, m_vextractf64x4, m_vextracti128, m_vextracti32x4, m_vextracti32x8,
+	m_vextracti64x2, m_vextracti64x4, m_vextractps, m_vfixupimmpd, m_vfixupimmps, m_vfixupimmsd,
+	m_vfixupimmss, m_vfmadd132pd, m_vfmadd132ps, m_vfmadd132sd, m_vfmadd132ss, m_vfmadd213pd,
+	m_vfmadd213ps, m_vfmadd213sd, m_vfmadd213ss, m_vfmadd231pd, m_vfmadd231ps, m_vfmadd231sd,
+	m_vfmadd231ss, m_vfmaddpd, m_vfmaddps, m_vfmaddsd, m_vfmaddss, m_vfmaddsub132pd,
+	m_vfmaddsub132ps, m_vfmaddsub213pd, m_vfmaddsub213ps, m_vfmaddsub231pd, m_vfmaddsub231ps,
+	m_vfmaddsubpd, m_vfmaddsubps, m_vfmsub132pd, m_vfmsub132ps, m_vfmsub132sd, m_vfmsub132ss,
+	m_vfmsub213pd, m_vfmsub213ps, m_vfmsub213sd, m_vfmsub213ss, m_vfmsub231pd, m_vfmsub231ps,
+	m_vfmsub231sd, m_vfmsub231ss, m_vfmsubadd132pd, m_vfmsubadd132ps, m_vfmsubadd213pd,
+	m_vfmsubadd213ps, m_vfmsubadd231pd, m_vfmsubadd231ps, m_vfmsubaddpd, m_vfmsubaddps, m_vfmsubpd,
+	m_vfmsubps, m_vfmsubsd, m_vfmsubss, m_vfnmadd132pd, m_vfnmadd132ps, m_vfnmadd132sd,
+	m_vfnmadd132ss, m_vfnmadd213pd, m_vfnmadd213ps, m_vfnmadd213sd, m_vfnmadd213ss, m_vfnmadd231pd,
+	m_vfnmadd231ps, m_vfnmadd231sd, m_vfnmadd231ss, m_vfnmaddpd, m_vfnmaddps, m_vfnmaddsd,
+	m_vfnmaddss, m_vfnmsub132pd, m_vfnmsub132ps, m_vfnmsub132sd, m_vfnmsub132ss, m_vfnmsub213pd,
+	m_vfnmsub213ps, m_vfnmsub213sd, m_vfnmsub213ss, m_vfnmsub231pd, m_vfnmsub231ps, m_vfnmsub231sd,
+	m_vfnmsub231ss, m_vfnmsubpd, m_vfnmsubps, m_vfnmsubsd, m_vfnmsubss, m_vfpclasspd, m_vfpclassph,
+	m_vfpclassps, m_vfpclasssd, m_vfpclasssh, m_vfpclassss, m_vgatherdpd, m_vgatherdps,
+	m_vgatherpf0dpd, m_vgatherpf0dps, m_vgatherpf0qpd, m_vgatherpf0qps, m_vgatherpf1dpd,
+	m_vgatherpf1dps, m_vgatherpf1qpd, m_vgatherpf1qps, m_vgatherqpd, m_vgatherqps, m_vgetexppd,
+	m_vgetexpps, m_vgetexpsd, m_vgetexpss, m_vgetmantpd, m_vgetmantph, m_vgetmantps, m_vgetmantsd,
+	m_vgetmantsh, m_vgetmantss, m_vgf2p8affineinvqb, m_vgf2p8affineqb, m_vgf2p8mulb, m_vhaddpd,
+	m_vhaddps, m_vhsubpd, m_vhsubps, m_vinsertf128, m_vinsertf32x4, m_vinsertf32x8, m_vinsertf64x2,
+	m_vinsertf64x4, m_vinserti128, m_vinserti32x4, m_vinserti32x8, m_vinserti64x2, m_vinserti64x4,
+	m_vinsertps, m_vlddqu, m_vldmxcsr, m_vmaskmovdqu, m_vmaskmovpd, m_vmaskmovps, m_vmaxpd,
+	m_vmaxps, m_vmaxsd, m_vmaxss, m_vmcall, m_vmclear, m_vmfunc, m_vminpd, m_vminps, m_vminsd,
+	m_vminss, m_vmlaunch, m_vmload, m_vmmcall, m_vmovapd, m_vmovaps, m_vmovd, m_vmovddup,
+	m_vmovdqa, m_vmovdqa32, m_vmovdqa64, m_vmovdqu, m_vmovdqu16, m_vmovdqu32, m_vmovdqu64,
+	m_vmovdqu8, m_vmovhlps, m_vmovhpd, m_vmovhps, m_vmovlhps, m_vmovlpd, m_vmovlps, m_vmovmskpd,
+	m_vmovmskps, m_vmovntdq, m_vmovntdqa, m_vmovntpd, m_vmovntps, m_vmovq, m_vmovsd, m_vmovshdup,
+	m_vmovsldup, m_vmovss, m_vmovupd, m_vmovups, m_vmpsadbw, m_vmptrld, m_vmptrst, m_vmread,
+	m_vmresume, m_vmrun, m_vmsave, m_vmulpd, m_vmulps, m_vmulsd, m_vmulss, m_vmwrite, m_vmxoff,
+	m_vmxon, m_vorpd, m_vorps, m_vp2intersectd, m_vp2intersectq, m_vp4dpwssd, m_vp4dpwssds,
+	m_vpabsb, m_vpabsd, m_vpabsq, m_vpabsw, m_vpackssdw, m_vpacksswb, m_vpackusdw, m_vpackuswb,
+	m_vpaddb, m_vpaddd, m_vpaddq, m_vpaddsb, m_vpaddsw, m_vpaddusb, m_vpaddusw, m_vpaddw,
+	m_vpalignr, m_vpand, m_vpandd, m_vpandn, m_vpandnd, m_vpandnq, m_vpandq, m_vpavgb, m_vpavgw,
+	m_vpblendd, m_vpblendmb, m_vpblendmd, m_vpblendmq, m_vpblendmw, m_vpblendvb, m_vpblendw,
+	m_vpbroadcastb, m_vpbroadcastd, m_vpbroadcastmb2q, m_vpbroadcastmw2d, m_vpbroadcastq,
+	m_vpbroadcastw, m_vpclmulqdq, m_vpcmpb, m_vpcmpd, m_vpcmpeqb, m_vpcmpeqd, m_vpcmpeqq,
+	m_vpcmpeqw, m_vpcmpestri, m_vpcmpestrm, m_vpcmpgtb, m_vpcmpgtd, m_vpcmpgtq, m_vpcmpgtw,
+	m_vpcmpistri, m_vpcmpistrm, m_vpcmpq, m_vpcmpub, m_vpcmpud, m_vpcmpuq, m_vpcmpuw, m_vpcmpw,
+	m_vpcompressb, m_vpcompressd, m_vpcompressq, m_vpcompressw, m_vpconflictd, m_vpconflictq,
+	m_vpdpbusd, m_vpdpbusds, m_vpdpwssd, m_vpdpwssds, m_vperm2f128, m_vperm2i128, m_vpermb,
+	m_vpermd, m_vpermi2b, m_vpermi2d, m_vpermi2pd, m_vpermi2ps, m_vpermi2q, m_vpermi2w,
+	m_vpermil2pd, m_vpermil2ps, m_vpermilpd, m_vpermilps, m_vpermpd, m_vpermps, m_vpermq,
+	m_vpermt2b, m_vpermt2d, m_vpermt2pd, m_vpermt2ps, m_vpermt2q, m_vpermt2w, m_vpermw,
+	m_vpexpandb, m_vpexpandd, m_vpexpandq, m_vpexpandw, m_vpextrb, m_vpextrd, m_vpextrq, m_vpextrw,
+	m_vpgatherdd, m_vpgatherdq, m_vpgatherqd, m_vpgatherqq, m_vphaddd, m_vphaddsw, m_vphaddw,
+	m_vphminposuw, m_vphsubd, m_vphsubsw, m_vphsubw, m_vpinsrb, m_vpinsrd, m_vpinsrq, m_vpinsrw,
+	m_vplzcntd, m_vplzcntq, m_vpmadd52huq, m_vpmadd52luq, m_vpmaddubsw, m_vpmaddwd, m_vpmaskmovd,
+	m_vpmaskmovq, m_vpmaxsb, m_vpmaxsd, m_vpmaxsq, m_vpmaxsw, m_vpmaxub, m_vpmaxud, m_vpmaxuq,
+	m_vpmaxuw, m_vpminsb, m_vpminsd, m_vpminsq, m_vpminsw, m_vpminub, m_vpminud, m_vpminuq,
+	m_vpminuw, m_vpmovb2m, m_vpmovd2m, m_vpmovdb, m_vpmovdw, m_vpmovm2b, m_vpmovm2d, m_vpmovm2q,
+	m_vpmovm2w, m_vpmovmskb, m_vpmovq2m, m_vpmovqb, m_vpmovqd, m_vpmovqw, m_vpmovsdb, m_vpmovsdw,
+	m_vpmovsqb, m_vpmovsqd, m_vpmovsqw, m_vpmovswb, m_vpmovsxbd, m_vpmovsxbq, m_vpmovsxbw,
+	m_vpmovsxdq, m_vpmovsxwd, m_vpmovsxwq, m_vpmovusdb, m_vpmovusdw, m_vpmovusqb, m_vpmovusqd,
+	m_vpmovusqw, m_vpmovuswb, m_vpmovw2m, m_vpmovwb, m_vpmovzxbd, m_vpmovzxbq, m_vpmovzxbw,
+	m_vpmovzxdq, m_vpmovzxwd, m_vpmovzxwq, m_vpmuldq, m_vpmulhrsw, m_vpmulhuw, m_vpmulhw,
+	m_vpmulld, m_vpmullq, m_vpmullw, m_vpmultishiftqb, m_vpmuludq, m_vpopcntb, m_vpopcntd,
+	m_vpopcntq, m_vpopcntw, m_vpor, m_vpord, m_vporq, m_vprold, m_vprolq, m_vprolvd, m_vprolvq,
+	m_vprord, m_vprorq, m_vprorvd, m_vprorvq, m_vpsadbw, m_vpscatterdd, m_vpscatterdq,
+	m_vpscatterqd, m_vpscatterqq, m_vpshldd, m_vpshldq, m_vpshldvd, m_vpshldvq, m_vpshldvw,
+	m_vpshldw, m_vpshrdd, m_vpshrdq, m_vpshrdvd, m_vpshrdvq, m_vpshrdvw, m_vpshrdw, m_vpshufb,
+	m_vpshufbitqmb, m_vpshufd, m_vpshufhw, m_vpshuflw, m_vpsignb, m_vpsignd, m_vpsignw, m_vpslld,
+	m_vpslldq, m_vpsllq, m_vpsllvd, m_vpsllvq, m_vpsllvw, m_vpsllw, m_vpsrad, m_vpsraq, m_vpsravd,
+	m_vpsravq, m_vpsravw, m_vpsraw, m_vpsrld, m_vpsrldq, m_vpsrlq, m_vpsrlvd, m_vpsrlvq, m_vpsrlvw,
+	m_vpsrlw, m_vpsubb, m_vpsubd, m_vpsubq, m_vpsubsb, m_vpsubsw, m_vpsubusb, m_vpsubusw, m_vpsubw,
+	m_vpternlogd, m_vpternlogq, m_vptest, m_vptestmb, m_vptestmd, m_vptestmq, m_vptestmw,
+	m_vptestnmb, m_vptestnmd, m_vptestnmq, m_vptestnmw, m_vpunpckhbw, m_vpunpckhdq, m_vpunpckhqdq,
+	m_vpunpckhwd, m_vpunpcklbw, m_vpunpckldq, m_vpunpcklqdq, m_vpunpcklwd, m_vpxor, m_vpxord,
+	m_vpxorq, m_vrangepd, m_vrangeps, m_vrangesd, m_vrangess, m_vrcp14pd, m_vrcp14ps, m_vrcp14sd,
+	m_vrcp14ss, m_vrcp28pd, m_vrcp28ps, m_vrcp28sd, m_vrcp28ss, m_vrcpps, m_vrcpss, m_vreducepd,
+	m_vreduceph, m_vreduceps, m_vreducesd, m_vreducesh, m_vreducess, m_vrndscalepd, m_vrndscaleph,
+	m_vrndscaleps, m_vrndscalesd, m_vrndscalesh, m_vrndscaless, m_vroundpd, m_vroundps, m_vroundsd,
+	m_vroundss, m_vrsqrt14pd, m_vrsqrt14ps, m_vrsqrt14sd, m_vrsqrt14ss, m_vrsqrt28pd, m_vrsqrt28ps,
+	m_vrsqrt28sd, m_vrsqrt28ss, m_vrsqrtps, m_vrsqrtss, m_vscalefpd, m_vscalefps, m_vscalefsd,
+	m_vscalefss, m_vscatterdpd, m_vscatterdps, m_vscatterpf0dpd, m_vscatterpf0dps,
+	m_vscatterpf0qpd, m_vscatterpf0qps, m_vscatterpf1dpd, m_vscatterpf1dps, m_vscatterpf1qpd,
+	m_vscatterpf1qps, m_vscatterqpd, m_vscatterqps, m_vshuff32x4, m_vshuff64x2, m_vshufi32x4,
+	m_vshufi64x2, m_vshufpd, m_vshufps, m_vsqrtpd, m_vsqrtps, m_vsqrtsd, m_vsqrtss, m_vstmxcsr,
+	m_vsubpd, m_vsubps, m_vsubsd, m_vsubss, m_vtestpd, m_vtestps, m_vucomisd, m_vucomiss,
+	m_vunpckhpd, m_vunpckhps, m_vunpcklpd, m_vunpcklps, m_vxorpd, m_vxorps, m_vzeroall,
+	m_vzeroupper, m_wbinvd, m_wbnoinvd, m_wrfsbase, m_wrgsbase, m_wrmsr, m_wrpkru, m_wrssd,
+	m_wrssq, m_wrussd, m_wrussq, m_xabort, m_xadd, m_xbegin, m_xchg, m_xcryptcbc, m_xcryptcfb,
+	m_xcryptctr, m_xcryptecb, m_xcryptofb, m_xend, m_xgetbv, m_xlatb, m_xor, m_xorpd, m_xorps,
+	m_xresldtrk, m_xrstor, m_xrstor64, m_xrstors, m_xrstors64, m_xsave, m_xsave64, m_xsavec,
+	m_xsavec64, m_xsaveopt, m_xsaveopt64, m_xsaves, m_xsaves64, m_xsetbv, m_xsha1, m_xsha256,
+	m_xstorerng, m_xsusldtrk, m_xtest,
+
+	mnemonics
+};
+
+/* text of each mnemonic */
+const char *const ssde_x86_names::names[mnemonics] =
+{
+	"(bad)",
+	"aaa", "aad", "aam", "aas", "adc", "adcx", "add", "addpd", "addps", "addsd", "addss",
+	"addsubpd", "addsubps", "adox", "aesdec", "aesdec128kl", "aesdec256kl", "aesdeclast",
+	"aesdecwide128kl", "aesdecwide256kl", "aesenc", "aesenc128kl", "aesenc256kl", "aesenclast",
+	"aesencwide128kl", "aesencwide256kl", "aesimc", "aeskeygenassist", "and", "andn", "andnpd",
+	"andnps", "andpd", "andps", "arpl", "bextr", "blendpd", "blendps", "blendvpd", "blendvps",
+	"blsi", "blsmsk", "blsr", "bound", "bsf", "bsr", "bswap", "bt", "btc", "btr", "bts", "bzhi",
+	"call", "cbw", "cdq", "cdqe", "clac", "clc", "cld", "cldemote", "clflush", "clflushopt",
+	"clgi", "cli", "clrssbsy", "clts", "clui", "clwb", "clzero", "cmc", "cmova", "cmovae", "cmovb",
+	"cmovbe", "cmove", "cmovg", "cmovge", "cmovl", "cmovle", "cmovne", "cmovno", "cmovnp",
+	"cmovns", "cmovo", "cmovp", "cmovs", "cmp", "cmppd", "cmpps", "cmpsb", "cmpsd", "cmpsq",
+	"cmpss", "cmpsw", "cmpxchg", "cmpxchg16b", "cmpxchg8b", "comisd", "comiss", "cpuid", "cqo",
+	"crc32", "cvtdq2pd", "cvtdq2ps", "cvtpd2dq", "cvtpd2pi", "cvtpd2ps", "cvtpi2pd", "cvtpi2ps",
+	"cvtps2dq", "cvtps2pd", "cvtps2pi", "cvtsd2si", "cvtsd2ss", "cvtsi2sd", "cvtsi2ss", "cvtss2sd",
+	"cvtss2si", "cvttpd2dq", "cvttpd2pi", "cvttps2dq", "cvttps2pi", "cvttsd2si", "cvttss2si",
+	"cwd", "cwde", "daa", "das", "dec", "div", "divpd", "divps", "divsd", "divss", "dppd", "dpps",
+	"emms", "encls", "enclu", "enclv", "encodekey128", "encodekey256", "endbr32", "endbr64",
+	"enqcmd", "enqcmds", "enter", "extractps", "extrq", "f2xm1", "fabs", "fadd", "faddp", "fbld",
+	"fbstp", "fchs", "fcmovb", "fcmovbe", "fcmove", "fcmovnb", "fcmovnbe", "fcmovne", "fcmovnu",
+	"fcmovu", "fcom", "fcomi", "fcomip", "fcomp", "fcompp", "fcos", "fdecstp", "fdiv", "fdivp",
+	"fdivr", "fdivrp", "femms", "ffree", "ffreep", "fiadd", "ficom", "ficomp", "fidiv", "fidivr",
+	"fild", "fimul", "fincstp", "fist", "fistp", "fisttp", "fisub", "fisubr", "fld", "fld1",
+	"fldcw", "fldenv", "fldl2e", "fldl2t", "fldlg2", "fldln2", "fldpi", "fldz", "fmul", "fmulp",
+	"fnclex", "fninit", "fnop", "fnsave", "fnstcw", "fnstenv", "fnstsw", "fpatan", "fprem",
+	"fprem1", "fptan", "frndint", "frstor", "fscale", "fsin", "fsincos", "fsqrt", "fst", "fstp",
+	"fsub", "fsubp", "fsubr", "fsubrp", "ftst", "fucom", "fucomi", "fucomip", "fucomp", "fucompp",
+	"fwait", "fxam", "fxch", "fxrstor", "fxrstor64", "fxsave", "fxsave64", "fxtract", "fyl2x", "fyl2xp1",
+	"getsec", "gf2p8affineinvqb", "gf2p8affineqb", "gf2p8mulb", "haddpd", "haddps", "hlt",
+	"hreset", "hsubpd", "hsubps", "idiv", "imul", "in", "inc", "incsspd", "incsspq", "insb",
+	"insd", "insertps", "insertq", "insw", "int", "int3", "into", "invd", "invept", "invlpg",
+	"invlpga", "invlpgb", "invpcid", "invvpid", "iret", "iretd", "iretq", "ja", "jae", "jb", "jbe",
+	"jcxz", "je", "jecxz", "jg", "jge", "jl", "jle", "jmp", "jne", "jno", "jnp", "jns", "jo", "jp",
+	"jrcxz", "js", "kaddb", "kaddd", "kaddq", "kaddw", "kandb", "kandd", "kandnb", "kandnd",
+	"kandnq", "kandnw", "kandq", "kandw", "kmovb", "kmovd", "kmovq", "kmovw", "knotb", "knotd",
+	"knotq", "knotw", "korb", "kord", "korq", "kortestb", "kortestd", "kortestq", "kortestw",
+	"korw", "kshiftlb", "kshiftld", "kshiftlq", "kshiftlw", "kshiftrb", "kshiftrd", "kshiftrq",
+	"kshiftrw", "ktestb", "ktestd", "ktestq", "ktestw", "kunpckbw", "kunpckdq", "kunpckwd",
+	"kxnorb", "kxnord", "kxnorq", "kxnorw", "kxorb", "kxord", "kxorq", "kxorw", "lahf", "lar",
+	"lcall", "lddqu", "ldmxcsr", "lds", "ldtilecfg", "lea", "leave", "les", "lfence", "lfs",
+	"lgdt", "lgs", "lidt", "ljmp", "lldt", "lmsw", "loadiwkey", "lodsb", "lodsd", "lodsq", "lodsw",
+	"loop", "loope", "loopne", "lsl", "lss", "ltr", "lzcnt", "maskmovdqu", "maskmovq", "maxpd",
+	"maxps", "maxsd", "maxss", "mfence", "minpd", "minps", "minsd", "minss", "monitor", "monitorx",
+	"montmul", "mov", "movabs", "movapd", "movaps", "movbe", "movd", "movddup", "movdir64b",
+	"movdiri", "movdq2q", "movdqa", "movdqu", "movhlps", "movhpd", "movhps", "movlhps", "movlpd",
+	"movlps", "movmskpd", "movmskps", "movntdq", "movntdqa", "movnti", "movntpd", "movntps",
+	"movntq", "movntsd", "movntss", "movq", "movq2dq", "movsb", "movsd", "movshdup", "movsldup",
+	"movsq", "movss", "movsw", "movsx", "movsxd", "movupd", "movups", "movzx", "mpsadbw", "mul",
+	"mulpd", "mulps", "mulsd", "mulss", "mulx", "mwait", "mwaitx", "neg", "nop", "not", "or",
+	"orpd", "orps", "out", "outsb", "outsd", "outsw", "pabsb", "pabsd", "pabsw", "packssdw",
+	"packsswb", "packusdw", "packuswb", "paddb", "paddd", "paddq", "paddsb", "paddsw", "paddusb",
+	"paddusw", "paddw", "palignr", "pand", "pandn", "pause", "pavgb", "pavgw", "pblendvb",
+	"pblendw", "pclmulqdq", "pcmpeqb", "pcmpeqd", "pcmpeqq", "pcmpeqw", "pcmpestri", "pcmpestrm",
+	"pcmpgtb", "pcmpgtd", "pcmpgtq", "pcmpgtw", "pcmpistri", "pcmpistrm", "pconfig", "pdep",
+	"pext", "pextrb", "pextrd", "pextrq", "pextrw", "pfcmpge", "phaddd", "phaddsw", "phaddw",
+	"phminposuw", "phsubd", "phsubsw", "phsubw", "pinsrb", "pinsrd", "pinsrq", "pinsrw",
+	"pmaddubsw", "pmaddwd", "pmaxsb", "pmaxsd", "pmaxsw", "pmaxub", "pmaxud", "pmaxuw", "pminsb",
+	"pminsd", "pminsw", "pminub", "pminud", "pminuw", "pmovmskb", "pmovsxbd", "pmovsxbq",
+	"pmovsxbw", "pmovsxdq", "pmovsxwd", "pmovsxwq", "pmovzxbd", "pmovzxbq", "pmovzxbw", "pmovzxdq",
+	"pmovzxwd", "pmovzxwq", "pmuldq", "pmulhrsw", "pmulhuw", "pmulhw", "pmulld", "pmullw",
+	"pmuludq", "pop", "popa", "popad", "popcnt", "popf", "popfd", "popfq", "por", "prefetch",
+	"prefetchnta", "prefetcht0", "prefetcht1", "prefetcht2", "prefetchw", "prefetchwt1", "psadbw",
+	"pshufb", "pshufd", "pshufhw", "pshuflw", "pshufw", "psignb", "psignd", "psignw", "pslld",
+	"pslldq", "psllq", "psllw", "psmash", "psrad", "psraw", "psrld", "psrldq", "psrlq", "psrlw",
+	"psubb", "psubd", "psubq", "psubsb", "psubsw", "psubusb", "psubusw", "psubw", "ptest",
+	"ptwrite", "punpckhbw", "punpckhdq", "punpckhqdq", "punpckhwd", "punpcklbw", "punpckldq",
+	"punpcklqdq", "punpcklwd", "push", "pusha", "pushad", "pushf", "pushfd", "pushfq", "pvalidate",
+	"pxor", "rcl", "rcpps", "rcpss", "rcr", "rdfsbase", "rdgsbase", "rdmsr", "rdpid", "rdpkru",
+	"rdpmc", "rdrand", "rdseed", "rdsspd", "rdsspq", "rdtsc", "rdtscp", "ret", "retf", "retfq",
+	"rmpadjust", "rmpupdate", "rol", "ror", "rorx", "roundpd", "roundps", "roundsd", "roundss",
+	"rsm", "rsqrtps", "rsqrtss", "rstorssp", "sahf", "salc", "sar", "sarx", "saveprevssp", "sbb",
+	"scasb", "scasd", "scasq", "scasw", "seamcall", "seamops", "seamret", "senduipi", "serialize",
+	"seta", "setae", "setb", "setbe", "sete", "setg", "setge", "setl", "setle", "setne", "setno",
+	"setnp", "setns", "seto", "setp", "sets", "setssbsy", "sfence", "sgdt", "sha1msg1", "sha1msg2",
+	"sha1nexte", "sha1rnds4", "sha256msg1", "sha256msg2", "sha256rnds2", "shl", "shld", "shlx",
+	"shr", "shrd", "shrx", "shufpd", "shufps", "sidt", "skinit", "sldt", "smsw", "sqrtpd",
+	"sqrtps", "sqrtsd", "sqrtss", "stac", "stc", "std", "stgi", "sti", "stmxcsr", "stosb", "stosd",
+	"stosq", "stosw", "str", "sttilecfg", "stui", "sub", "subpd", "subps", "subsd", "subss",
+	"swapgs", "syscall", "sysenter", "sysexit", "sysexitq", "sysret", "sysretq", "tdcall",
+	"tdpbf16ps", "tdpbssd", "tdpbsud", "tdpbusd", "tdpbuud", "test", "testui", "tileloadd",
+	"tileloaddt1", "tilerelease", "tilestored", "tilezero", "tlbsync", "tpause", "tzcnt",
+	"ucomisd", "ucomiss", "ud1", "ud2", "uiret", "umonitor", "umwait", "unpckhpd", "unpckhps",
+	"unpcklpd", "unpcklps", "v4fmaddps", "v4fmaddss", "v4fnmaddps", "v4fnmaddss", "vaddpd",
+	"vaddps", "vaddsd", "vaddss", "vaddsubpd", "vaddsubps", "vaesdec", "vaesdeclast", "vaesenc",
+	"vaesenclast", "vaesimc", "vaeskeygenassist", "valignd", "valignq", "vandnpd", "vandnps",
+	"vandpd", "vandps", "vblendmpd", "vblendmps", "vblendpd", "vblendps", "vblendvpd", "vblendvps",
+	"vbroadcastf128", "vbroadcastf32x2", "vbroadcastf32x4", "vbroadcastf32x8", "vbroadcastf64x2",
+	"vbroadcastf64x4", "vbroadcasti128", "vbroadcasti32x2", "vbroadcasti32x4", "vbroadcasti32x8",
+	"vbroadcasti64x2", "vbroadcasti64x4", "vbroadcastsd", "vbroadcastss", "vcmppd", "vcmpph",
+	"vcmpps", "vcmpsd", "vcmpsh", "vcmpss", "vcomisd", "vcomiss", "vcompresspd", "vcompressps",
+	"vcvtdq2pd", "vcvtdq2ps", "vcvtne2ps2bf16", "vcvtneps2bf16", "vcvtpd2dq", "vcvtpd2ps",
+	"vcvtpd2qq", "vcvtpd2udq", "vcvtpd2uqq", "vcvtph2ps", "vcvtps2dq", "vcvtps2pd", "vcvtps2ph",
+	"vcvtps2qq", "vcvtps2udq", "vcvtps2uqq", "vcvtqq2pd", "vcvtqq2ps", "vcvtsd2si", "vcvtsd2ss",
+	"vcvtsd2usi", "vcvtsi2sd", "vcvtsi2ss", "vcvtss2sd", "vcvtss2si", "vcvtss2usi", "vcvttpd2dq",
+	"vcvttpd2qq", "vcvttpd2udq", "vcvttpd2uqq", "vcvttps2dq", "vcvttps2qq", "vcvttps2udq",
+	"vcvttps2uqq", "vcvttsd2si", "vcvttsd2usi", "vcvttss2si", "vcvttss2usi", "vcvtudq2pd",
+	"vcvtudq2ps", "vcvtuqq2pd", "vcvtuqq2ps", "vcvtusi2sd", "vcvtusi2ss", "vdbpsadbw", "vdivpd",
+	"vdivps", "vdivsd", "vdivss", "vdpbf16ps", "vdppd", "vdpps", "verr", "verw", "vexp2pd",
+	"vexp2ps", "vexpandpd", "vexpandps", "vextractf128", "vextractf32x4", "vextractf32x8",
+	"vextractf64x2", "vextractf64x4", "vextracti128", "vextracti32x4", "vextracti32x8",
+	"vextracti64x2", "vextracti64x4", "vextractps", "vfixupimmpd", "vfixupimmps", "vfixupimmsd",
+	"vfixupimmss", "vfmadd132pd", "vfmadd132ps", "vfmadd132sd", "vfmadd132ss", "vfmadd213pd",
+	"vfmadd213ps", "vfmadd213sd", "vfmadd213ss", "vfmadd231pd", "vfmadd231ps", "vfmadd231sd",
+	"vfmadd231ss", "vfmaddpd", "vfmaddps", "vfmaddsd", "vfmaddss", "vfmaddsub132pd",
+	"vfmaddsub132ps", "vfmaddsub213pd", "vfmaddsub213ps", "vfmaddsub231pd", "vfmaddsub231ps",
+	"vfmaddsubpd", "vfmaddsubps", "vfmsub132pd", "vfmsub132ps", "vfmsub132sd", "vfmsub132ss",
+	"vfmsub213pd", "vfmsub213ps", "vfmsub213sd", "vfmsub213ss", "vfmsub231pd", "vfmsub231ps",
+	"vfmsub231sd", "vfmsub231ss", "vfmsubadd132pd", "vfmsubadd132ps", "vfmsubadd213pd",
+	"vfmsubadd213ps", "vfmsubadd231pd", "vfmsubadd231ps", "vfmsubaddpd", "vfmsubaddps", "vfmsubpd",
+	"vfmsubps", "vfmsubsd", "vfmsubss", "vfnmadd132pd", "vfnmadd132ps", "vfnmadd132sd",
+	"vfnmadd132ss", "vfnmadd213pd", "vfnmadd213ps", "vfnmadd213sd", "vfnmadd213ss", "vfnmadd231pd",
+	"vfnmadd231ps", "vfnmadd231sd", "vfnmadd231ss", "vfnmaddpd", "vfnmaddps", "vfnmaddsd",
+	"vfnmaddss", "vfnmsub132pd", "vfnmsub132ps", "vfnmsub132sd", "vfnmsub132ss", "vfnmsub213pd",
+	"vfnmsub213ps", "vfnmsub213sd", "vfnmsub213ss", "vfnmsub231pd", "vfnmsub231ps", "vfnmsub231sd",
+	"vfnmsub231ss", "vfnmsubpd", "vfnmsubps", "vfnmsubsd", "vfnmsubss", "vfpclasspd", "vfpclassph",
+	"vfpclassps", "vfpclasssd", "vfpclasssh", "vfpclassss", "vgatherdpd", "vgatherdps",
+	"vgatherpf0dpd", "vgatherpf0dps", "vgatherpf0qpd", "vgatherpf0qps", "vgatherpf1dpd",
+	"vgatherpf1dps", "vgatherpf1qpd", "vgatherpf1qps", "vgatherqpd", "vgatherqps", "vgetexppd",
+	"vgetexpps", "vgetexpsd", "vgetexpss", "vgetmantpd", "vgetmantph", "vgetmantps", "vgetmantsd",
+	"vgetmantsh", "vgetmantss", "vgf2p8affineinvqb", "vgf2p8affineqb", "vgf2p8mulb", "vhaddpd",
+	"vhaddps", "vhsubpd", "vhsubps", "vinsertf128", "vinsertf32x4", "vinsertf32x8", "vinsertf64x2",
+	"vinsertf64x4", "vinserti128", "vinserti32x4", "vinserti32x8", "vinserti64x2", "vinserti64x4",
+	"vinsertps", "vlddqu", "vldmxcsr", "vmaskmovdqu", "vmaskmovpd", "vmaskmovps", "vmaxpd",
+	"vmaxps", "vmaxsd", "vmaxss", "vmcall", "vmclear", "vmfunc", "vminpd", "vminps", "vminsd",
+	"vminss", "vmlaunch", "vmload", "vmmcall", "vmovapd", "vmovaps", "vmovd", "vmovddup",
+	"vmovdqa", "vmovdqa32", "vmovdqa64", "vmovdqu", "vmovdqu16", "vmovdqu32", "vmovdqu64",
+	"vmovdqu8", "vmovhlps", "vmovhpd", "vmovhps", "vmovlhps", "vmovlpd", "vmovlps", "vmovmskpd",
+	"vmovmskps", "vmovntdq", "vmovntdqa", "vmovntpd", "vmovntps", "vmovq", "vmovsd", "vmovshdup",
+	"vmovsldup", "vmovss", "vmovupd", "vmovups", "vmpsadbw", "vmptrld", "vmptrst", "vmread",
+	"vmresume", "vmrun", "vmsave", "vmulpd", "vmulps", "vmulsd", "vmulss", "vmwrite", "vmxoff",
+	"vmxon", "vorpd", "vorps", "vp2intersectd", "vp2intersectq", "vp4dpwssd", "vp4dpwssds",
+	"vpabsb", "vpabsd", "vpabsq", "vpabsw", "vpackssdw", "vpacksswb", "vpackusdw", "vpackuswb",
+	"vpaddb", "vpaddd", "vpaddq", "vpaddsb", "vpaddsw", "vpaddusb", "vpaddusw", "vpaddw",
+	"vpalignr", "vpand", "vpandd", "vpandn", "vpandnd", "vpandnq", "vpandq", "vpavgb", "vpavgw",
+	"vpblendd", "vpblendmb", "vpblendmd", "vpblendmq", "vpblendmw", "vpblendvb", "vpblendw",
+	"vpbroadcastb", "vpbroadcastd", "vpbroadcastmb2q", "vpbroadcastmw2d", "vpbroadcastq",
+	"vpbroadcastw", "vpclmulqdq", "vpcmpb", "vpcmpd", "vpcmpeqb", "vpcmpeqd", "vpcmpeqq",
+	"vpcmpeqw", "vpcmpestri", "vpcmpestrm", "vpcmpgtb", "vpcmpgtd", "vpcmpgtq", "vpcmpgtw",
+	"vpcmpistri", "vpcmpistrm", "vpcmpq", "vpcmpub", "vpcmpud", "vpcmpuq", "vpcmpuw", "vpcmpw",
+	"vpcompressb", "vpcompressd", "vpcompressq", "vpcompressw", "vpconflictd", "vpconflictq",
+	"vpdpbusd", "vpdpbusds", "vpdpwssd", "vpdpwssds", "vperm2f128", "vperm2i128", "vpermb",
+	"vpermd", "vpermi2b", "vpermi2d", "vpermi2pd", "vpermi2ps", "vpermi2q", "vpermi2w",
+	"vpermil2pd", "vpermil2ps", "vpermilpd", "vpermilps", "vpermpd", "vpermps", "vpermq",
+	"vpermt2b", "vpermt2d", "vpermt2pd", "vpermt2ps", "vpermt2q", "vpermt2w", "vpermw",
+	"vpexpandb", "vpexpandd", "vpexpandq", "vpexpandw", "vpextrb", "vpextrd", "vpextrq", "vpextrw",
+	"vpgatherdd", "vpgatherdq", "vpgatherqd", "vpgatherqq", "vphaddd", "vphaddsw", "vphaddw",
+	"vphminposuw", "vphsubd", "vphsubsw", "vphsubw", "vpinsrb", "vpinsrd", "vpinsrq", "vpinsrw",
+	"vplzcntd", "vplzcntq", "vpmadd52huq", "vpmadd52luq", "vpmaddubsw", "vpmaddwd", "vpmaskmovd",
+	"vpmaskmovq", "vpmaxsb", "vpmaxsd", "vpmaxsq", "vpmaxsw", "vpmaxub", "vpmaxud", "vpmaxuq",
+	"vpmaxuw", "vpminsb", "vpminsd", "vpminsq", "vpminsw", "vpminub", "vpminud", "vpminuq",
+	"vpminuw", "vpmovb2m", "vpmovd2m", "vpmovdb", "vpmovdw", "vpmovm2b", "vpmovm2d", "vpmovm2q",
+	"vpmovm2w", "vpmovmskb", "vpmovq2m", "vpmovqb", "vpmovqd", "vpmovqw", "vpmovsdb", "vpmovsdw",
+	"vpmovsqb", "vpmovsqd", "vpmovsqw", "vpmovswb", "vpmovsxbd", "vpmovsxbq", "vpmovsxbw",
+	"vpmovsxdq", "vpmovsxwd", "vpmovsxwq", "vpmovusdb", "vpmovusdw", "vpmovusqb", "vpmovusqd",
+	"vpmovusqw", "vpmovuswb", "vpmovw2m", "vpmovwb", "vpmovzxbd", "vpmovzxbq", "vpmovzxbw",
+	"vpmovzxdq", "vpmovzxwd", "vpmovzxwq", "vpmuldq", "vpmulhrsw", "vpmulhuw", "vpmulhw",
+	"vpmulld", "vpmullq", "vpmullw", "vpmultishiftqb", "vpmuludq", "vpopcntb", "vpopcntd",
+	"vpopcntq", "vpopcntw", "vpor", "vpord", "vporq", "vprold", "vprolq", "vprolvd", "vprolvq",
+	"vprord", "vprorq", "vprorvd", "vprorvq", "vpsadbw", "vpscatterdd", "vpscatterdq",
+	"vpscatterqd", "vpscatterqq", "vpshldd", "vpshldq", "vpshldvd", "vpshldvq", "vpshldvw",
+	"vpshldw", "vpshrdd", "vpshrdq", "vpshrdvd", "vpshrdvq", "vpshrdvw", "vpshrdw", "vpshufb",
+	"vpshufbitqmb", "vpshufd", "vpshufhw", "vpshuflw", "vpsignb", "vpsignd", "vpsignw", "vpslld",
+	"vpslldq", "vpsllq", "vpsllvd", "vpsllvq", "vpsllvw", "vpsllw", "vpsrad", "vpsraq", "vpsravd",
+	"vpsravq", "vpsravw", "vpsraw", "vpsrld", "vpsrldq", "vpsrlq", "vpsrlvd", "vpsrlvq", "vpsrlvw",
+	"vpsrlw", "vpsubb", "vpsubd", "vpsubq", "vpsubsb", "vpsubsw", "vpsubusb", "vpsubusw", "vpsubw",
+	"vpternlogd", "vpternlogq", "vptest", "vptestmb", "vptestmd", "vptestmq", "vptestmw",
+	"vptestnmb", "vptestnmd", "vptestnmq", "vptestnmw", "vpunpckhbw", "vpunpckhdq", "vpunpckhqdq",
+	"vpunpckhwd", "vpunpcklbw", "vpunpckldq", "vpunpcklqdq", "vpunpcklwd", "vpxor", "vpxord",
+	"vpxorq", "vrangepd", "vrangeps", "vrangesd", "vrangess", "vrcp14pd", "vrcp14ps", "vrcp14sd",
+	"vrcp14ss", "vrcp28pd", "vrcp28ps", "vrcp28sd", "vrcp28ss", "vrcpps", "vrcpss", "vreducepd",
+	"vreduceph", "vreduceps", "vreducesd", "vreducesh", "vreducess", "vrndscalepd", "vrndscaleph",
+	"vrndscaleps", "vrndscalesd", "vrndscalesh", "vrndscaless", "vroundpd", "vroundps", "vroundsd",
+	"vroundss", "vrsqrt14pd", "vrsqrt14ps", "vrsqrt14sd", "vrsqrt14ss", "vrsqrt28pd", "vrsqrt28ps",
+	"vrsqrt28sd", "vrsqrt28ss", "vrsqrtps", "vrsqrtss", "vscalefpd", "vscalefps", "vscalefsd",
+	"vscalefss", "vscatterdpd", "vscatterdps", "vscatterpf0dpd", "vscatterpf0dps",
+	"vscatterpf0qpd", "vscatterpf0qps", "vscatterpf1dpd", "vscatterpf1dps", "vscatterpf1qpd",
+	"vscatterpf1qps", "vscatterqpd", "vscatterqps", "vshuff32x4", "vshuff64x2", "vshufi32x4",
+	"vshufi64x2", "vshufpd", "vshufps", "vsqrtpd", "vsqrtps", "vsqrtsd", "vsqrtss", "vstmxcsr",
+	"vsubpd", "vsubps", "vsubsd", "vsubss", "vtestpd", "vtestps", "vucomisd", "vucomiss",
+	"vunpckhpd", "vunpckhps", "vunpcklpd", "vunpcklps", "vxorpd", "vxorps", "vzeroall",
+	"vzeroupper", "wbinvd", "wbnoinvd", "wrfsbase", "wrgsbase", "wrmsr", "wrpkru", "wrssd",
+	"wrssq", "wrussd", "wrussq", "xabort", "xadd", "xbegin", "xchg", "xcryptcbc", "xcryptcfb",
+	"xcryptctr", "xcryptecb", "xcryptofb", "xend", "xgetbv", "xlatb", "xor", "xorpd", "xorps",
+	"xresldtrk", "xrstor", "xrstor64", "xrstors", "xrstors64", "xsave", "xsave64", "xsavec",
+	"xsavec64", "xsaveopt", "xsaveopt64", "xsaves", "xsaves64", "xsetbv", "xsha1", "xsha256",
+	"xstorerng", "xsusldtrk", "xtest"
+};
+
+/* one byte opcodes */
+const uint16_t ssde_x86_names::one[256] =
+{
+	/*      x0      |       x1      |       x2      |       x3      |       x4      |       x5      |       x6      |       x7       */
+	    m_add     ,    m_add     ,    m_add     ,    m_add     ,    m_add     ,    m_add     ,    m_push    ,    m_pop     , /* 00x */
+	     m_or     ,     m_or     ,     m_or     ,     m_or     ,     m_or     ,     m_or     ,    m_push    ,    m_bad     , /* 01x */
+	    m_adc     ,    m_adc     ,    m_adc     ,    m_adc     ,    m_adc     ,    m_adc     ,    m_push    ,    m_pop     , /* 02x */
+	    m_sbb     ,    m_sbb     ,    m_sbb     ,    m_sbb     ,    m_sbb     ,    m_sbb     ,    m_push    ,    m_pop     , /* 03x */
+	    m_and     ,    m_and     ,    m_and     ,    m_and     ,    m_and     ,    m_and     ,    m_bad     ,    m_daa     , /* 04x */
+	    m_sub     ,    m_sub     ,    m_sub     ,    m_sub     ,    m_sub     ,    m_sub     ,    m_bad     ,    m_das     , /* 05x */
+	    m_xor     ,    m_xor     ,    m_xor     ,    m_xor     ,    m_xor     ,    m_xor     ,    m_bad     ,    m_aaa     , /* 06x */
+	    m_cmp     ,    m_cmp     ,    m_cmp     ,    m_cmp     ,    m_cmp     ,    m_cmp     ,    m_bad     ,    m_aas     , /* 07x */
+	    m_inc     ,    m_inc     ,    m_inc     ,    m_inc     ,    m_inc     ,    m_inc     ,    m_inc     ,    m_inc     , /* 10x */
+	    m_dec     ,    m_dec     ,    m_dec     ,    m_dec     ,    m_dec     ,    m_dec     ,    m_dec     ,    m_dec     , /* 11x */
+	    m_push    ,    m_push    ,    m_push    ,    m_push    ,    m_push    ,    m_push    ,    m_push    ,    m_push    , /* 12x */
+	    m_pop     ,    m_pop     ,    m_pop     ,    m_pop     ,    m_pop     ,    m_pop     ,    m_pop     ,    m_pop     , /* 13x */
+	 variant | 0  , variant | 1  ,   m_bound    , variant | 2  ,    m_bad     ,    m_bad     ,    m_bad     ,    m_bad     , /* 14x */
+	    m_push    ,    m_imul    ,    m_push    ,    m_imul    ,    m_insb    , variant | 3  ,   m_outsb    , variant | 4  , /* 15x */
+	     m_jo     ,    m_jno     ,     m_jb     ,    m_jae     ,     m_je     ,    m_jne     ,    m_jbe     ,     m_ja     , /* 16x */
+	     m_js     ,    m_jns     ,     m_jp     ,    m_jnp     ,     m_jl     ,    m_jge     ,    m_jle     ,     m_jg     , /* 17x */
+	 variant | 5  , variant | 5  , variant | 5  , variant | 5  ,    m_test    ,    m_test    ,    m_xchg    ,    m_xchg    , /* 20x */
+	    m_mov     ,    m_mov     ,    m_mov     ,    m_mov     ,    m_mov     ,    m_lea     ,    m_mov     ,    m_pop     , /* 21x */
+	 variant | 6  ,    m_xchg    ,    m_xchg    ,    m_xchg    ,    m_xchg    ,    m_xchg    ,    m_xchg    ,    m_xchg    , /* 22x */
+	 variant | 7  , variant | 8  ,   m_lcall    ,    m_fwait   , variant | 9  , variant | 10 ,    m_sahf    ,    m_lahf    , /* 23x */
+	 variant | 11 , variant | 11 , variant | 11 , variant | 11 ,   m_movsb    , variant | 12 ,   m_cmpsb    , variant | 13 , /* 24x */
+	    m_test    ,    m_test    ,   m_stosb    , variant | 14 ,   m_lodsb    , variant | 15 ,   m_scasb    , variant | 16 , /* 25x */
+	    m_mov     ,    m_mov     ,    m_mov     ,    m_mov     ,    m_mov     ,    m_mov     ,    m_mov     ,    m_mov     , /* 26x */
+	 variant | 17 , variant | 17 , variant | 17 , variant | 17 , variant | 17 , variant | 17 , variant | 17 , variant | 17 , /* 27x */
+	 variant | 18 , variant | 18 ,    m_ret     ,    m_ret     ,    m_les     , variant | 19 , variant | 20 , variant | 21 , /* 30x */
+	   m_enter    ,   m_leave    , variant | 22 , variant | 22 ,    m_int3    ,    m_int     ,    m_into    , variant | 23 , /* 31x */
+	 variant | 18 , variant | 18 , variant | 18 , variant | 18 ,    m_aam     ,    m_aad     ,    m_salc    ,   m_xlatb    , /* 32x */
+	 variant | 24 , variant | 25 , variant | 26 , variant | 27 , variant | 28 , variant | 29 , variant | 30 , variant | 31 , /* 33x */
+	   m_loopne   ,   m_loope    ,    m_loop    , variant | 32 ,     m_in     ,     m_in     ,    m_out     ,    m_out     , /* 34x */
+	    m_call    ,    m_jmp     ,    m_ljmp    ,    m_jmp     ,     m_in     ,     m_in     ,    m_out     ,    m_out     , /* 35x */
+	    m_bad     ,    m_bad     ,    m_bad     ,    m_bad     ,    m_hlt     ,    m_cmc     , variant | 33 , variant | 33 , /* 36x */
+	    m_clc     ,    m_stc     ,    m_cli     ,    m_sti     ,    m_cld     ,    m_std     , variant | 34 , variant | 35 , /* 37x */
+};
+
+/* 0F xx */
+const uint16_t ssde_x86_names::map_0f[256] =
+{
+	/*      x0      |       x1      |       x2      |       x3      |       x4      |       x5      |       x6      |       x7       */
+	 variant | 36 , variant | 37 ,    m_lar     ,    m_lsl     ,    m_bad     ,  m_syscall   ,    m_clts    , variant | 38 , /* 00x */
+	    m_invd    , variant | 39 ,    m_bad     ,    m_ud2     ,    m_bad     , variant | 40 ,   m_femms    ,  m_pfcmpge   , /* 01x */
+	 variant | 41 , variant | 41 , variant | 42 , variant | 43 , variant | 44 , variant | 45 , variant | 46 , variant | 47 , /* 02x */
+	 variant | 48 ,    m_bad     ,    m_bad     ,    m_bad     ,  m_cldemote  ,    m_bad     , variant | 49 ,    m_nop     , /* 03x */
+	    m_mov     ,    m_mov     ,    m_mov     ,    m_mov     ,    m_bad     ,    m_bad     ,    m_bad     ,    m_bad     , /* 04x */
+	 variant | 50 , variant | 50 , variant | 51 , variant | 52 , variant | 53 , variant | 54 , variant | 55 , variant | 56 , /* 05x */
+	   m_wrmsr    ,   m_rdtsc    ,   m_rdmsr    ,   m_rdpmc    ,  m_sysenter  , variant | 57 ,    m_bad     ,   m_getsec   , /* 06x */
+	    m_bad     ,    m_bad     ,    m_bad     ,    m_bad     ,    m_bad     ,    m_bad     ,    m_bad     ,    m_bad     , /* 07x */
+	   m_cmovo    ,   m_cmovno   ,   m_cmovb    ,   m_cmovae   ,   m_cmove    ,   m_cmovne   ,   m_cmovbe   ,   m_cmova    , /* 10x */
+	   m_cmovs    ,   m_cmovns   ,   m_cmovp    ,   m_cmovnp   ,   m_cmovl    ,   m_cmovge   ,   m_cmovle   ,   m_cmovg    , /* 11x */
+	 variant | 58 , variant | 59 , variant | 60 , variant | 61 , variant | 62 , variant | 63 , variant | 64 , variant | 65 , /* 12x */
+	 variant | 66 , variant | 67 , variant | 68 , variant | 69 , variant | 70 , variant | 71 , variant | 72 , variant | 73 , /* 13x */
+	 m_punpcklbw  , m_punpcklwd  , m_punpckldq  ,  m_packsswb  ,  m_pcmpgtb   ,  m_pcmpgtw   ,  m_pcmpgtd   ,  m_packuswb  , /* 14x */
+	 m_punpckhbw  , m_punpckhwd  , m_punpckhdq  ,  m_packssdw  , m_punpcklqdq , m_punpckhqdq , variant | 74 , variant | 75 , /* 15x */
+	 variant | 76 , variant | 77 , variant | 78 , variant | 79 ,  m_pcmpeqb   ,  m_pcmpeqw   ,  m_pcmpeqd   ,    m_emms    , /* 16x */
+	 variant | 80 , variant | 81 ,    m_bad     ,    m_bad     , variant | 82 , variant | 83 , variant | 84 , variant | 75 , /* 17x */
+	     m_jo     ,    m_jno     ,     m_jb     ,    m_jae     ,     m_je     ,    m_jne     ,    m_jbe     ,     m_ja     , /* 20x */
+	     m_js     ,    m_jns     ,     m_jp     ,    m_jnp     ,     m_jl     ,    m_jge     ,    m_jle     ,     m_jg     , /* 21x */
+	    m_seto    ,   m_setno    ,    m_setb    ,   m_setae    ,    m_sete    ,   m_setne    ,   m_setbe    ,    m_seta    , /* 22x */
+	    m_sets    ,   m_setns    ,    m_setp    ,   m_setnp    ,    m_setl    ,   m_setge    ,   m_setle    ,    m_setg    , /* 23x */
+	    m_push    ,    m_pop     ,   m_cpuid    ,     m_bt     ,    m_shld    ,    m_shld    , variant | 85 , variant | 86 , /* 24x */
+	    m_push    ,    m_pop     ,    m_rsm     ,    m_bts     ,    m_shrd    ,    m_shrd    , variant | 87 ,    m_imul    , /* 25x */
+	  m_cmpxchg   ,  m_cmpxchg   ,    m_lss     ,    m_btr     ,    m_lfs     ,    m_lgs     ,   m_movzx    ,   m_movzx    , /* 26x */
+	   m_popcnt   ,    m_ud1     , variant | 88 ,    m_btc     , variant | 89 , variant | 90 ,   m_movsx    ,   m_movsx    , /* 27x */
+	    m_xadd    ,    m_xadd    , variant | 91 ,   m_movnti   ,   m_pinsrw   ,   m_pextrw   , variant | 92 , variant | 93 , /* 30x */
+	   m_bswap    ,   m_bswap    ,   m_bswap    ,   m_bswap    ,   m_bswap    ,   m_bswap    ,   m_bswap    ,   m_bswap    , /* 31x */
+	 variant | 94 ,   m_psrlw    ,   m_psrld    ,   m_psrlq    ,   m_paddq    ,   m_pmullw   , variant | 95 ,  m_pmovmskb  , /* 32x */
+	  m_psubusb   ,  m_psubusw   ,   m_pminub   ,    m_pand    ,  m_paddusb   ,  m_paddusw   ,   m_pmaxub   ,   m_pandn    , /* 33x */
+	   m_pavgb    ,   m_psraw    ,   m_psrad    ,   m_pavgw    ,  m_pmulhuw   ,   m_pmulhw   , variant | 96 , variant | 97 , /* 34x */
+	   m_psubsb   ,   m_psubsw   ,   m_pminsw   ,    m_por     ,   m_paddsb   ,   m_paddsw   ,   m_pmaxsw   ,    m_pxor    , /* 35x */
+	   m_lddqu    ,   m_psllw    ,   m_pslld    ,   m_psllq    ,  m_pmuludq   ,  m_pmaddwd   ,   m_psadbw   , variant | 98 , /* 36x */
+	   m_psubb    ,   m_psubw    ,   m_psubd    ,   m_psubq    ,   m_paddb    ,   m_paddw    ,   m_paddd    ,    m_bad     , /* 37x */
+};
+
+/* 0F 38 xx */
+const uint16_t ssde_x86_names::map_0f38[256] =
+{
+	/*       x0       |        x1       |        x2       |        x3       |        x4       |        x5       |        x6       |        x7        */
+	    m_pshufb    ,    m_phaddw    ,    m_phaddd    ,   m_phaddsw    ,  m_pmaddubsw   ,    m_phsubw    ,    m_phsubd    ,   m_phsubsw    , /* 00x */
+	    m_psignb    ,    m_psignw    ,    m_psignd    ,   m_pmulhrsw   ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 01x */
+	   m_pblendvb   ,     m_bad      ,     m_bad      ,     m_bad      ,   m_blendvps   ,   m_blendvpd   ,     m_bad      ,    m_ptest     , /* 02x */
+	     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,    m_pabsb     ,    m_pabsw     ,    m_pabsd     ,     m_bad      , /* 03x */
+	   m_pmovsxbw   ,   m_pmovsxbd   ,   m_pmovsxbq   ,   m_pmovsxwd   ,   m_pmovsxwq   ,   m_pmovsxdq   ,     m_bad      ,     m_bad      , /* 04x */
+	    m_pmuldq    ,   m_pcmpeqq    ,   m_movntdqa   ,   m_packusdw   ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 05x */
+	   m_pmovzxbw   ,   m_pmovzxbd   ,   m_pmovzxbq   ,   m_pmovzxwd   ,   m_pmovzxwq   ,   m_pmovzxdq   ,     m_bad      ,   m_pcmpgtq    , /* 06x */
+	    m_pminsb    ,    m_pminsd    ,    m_pminuw    ,    m_pminud    ,    m_pmaxsb    ,    m_pmaxsd    ,    m_pmaxuw    ,    m_pmaxud    , /* 07x */
+	    m_pmulld    ,  m_phminposuw  ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 10x */
+	     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 11x */
+	     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 12x */
+	     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 13x */
+	     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 14x */
+	     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 15x */
+	     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 16x */
+	     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 17x */
+	    m_invept    ,   m_invvpid    ,   m_invpcid    ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 20x */
+	     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 21x */
+	     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 22x */
+	     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 23x */
+	     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 24x */
+	     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 25x */
+	     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 26x */
+	     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 27x */
+	     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 30x */
+	  m_sha1nexte   ,   m_sha1msg1   ,   m_sha1msg2   , m_sha256rnds2  ,  m_sha256msg1  ,  m_sha256msg2  ,     m_bad      ,  m_gf2p8mulb   , /* 31x */
+	     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 32x */
+	  variant | 99  ,     m_bad      ,     m_bad      ,    m_aesimc    , variant | 100  , variant | 101  , variant | 102  , variant | 103  , /* 33x */
+	     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 34x */
+	     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 35x */
+	 variant | 104  , variant | 104  ,     m_bad      ,     m_bad      ,     m_bad      , variant | 105  , variant | 106  ,     m_bad      , /* 36x */
+	 variant | 107  ,   m_movdiri    , m_encodekey128 , m_encodekey256 ,     m_bad      ,     m_bad      ,     m_bad      ,     m_bad      , /* 37x */
+};
+
+/* 0F 3A xx */
+const uint16_t ssde_x86_names::map_0f3a[256] =
+{
+	/*         x0         |          x1         |          x2         |          x3         |          x4         |          x5         |          x6         |          x7          */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 00x */
+	     m_roundps      ,     m_roundpd      ,     m_roundss      ,     m_roundsd      ,     m_blendps      ,     m_blendpd      ,     m_pblendw      ,     m_palignr      , /* 01x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,      m_pextrb      ,      m_pextrw      ,   variant | 108    ,    m_extractps     , /* 02x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 03x */
+	      m_pinsrb      ,     m_insertps     ,   variant | 109    ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 04x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 05x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 06x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 07x */
+	       m_dpps       ,       m_dppd       ,     m_mpsadbw      ,       m_bad        ,    m_pclmulqdq     ,       m_bad        ,       m_bad        ,       m_bad        , /* 10x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 11x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 12x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 13x */
+	    m_pcmpestrm     ,    m_pcmpestri     ,    m_pcmpistrm     ,    m_pcmpistri     ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 14x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 15x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 16x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 17x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 20x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 21x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 22x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 23x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 24x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 25x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 26x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 27x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 30x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,    m_sha1rnds4     ,       m_bad        ,  m_gf2p8affineqb   , m_gf2p8affineinvqb , /* 31x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 32x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , m_aeskeygenassist  , /* 33x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 34x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 35x */
+	      m_hreset      ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 36x */
+	       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        ,       m_bad        , /* 37x */
+};
+
+/* VEX 0F xx */
+const uint16_t ssde_x86_names::vex_0f[256] =
+{
+	/*      x0       |       x1       |       x2       |       x3       |       x4       |       x5       |       x6       |       x7        */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 00x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 01x */
+	 variant | 110 , variant | 110 , variant | 111 , variant | 112 , variant | 113 , variant | 114 , variant | 115 , variant | 116 , /* 02x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 03x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 04x */
+	 variant | 117 , variant | 117 , variant | 118 , variant | 119 , variant | 120 , variant | 121 , variant | 122 , variant | 123 , /* 05x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 06x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 07x */
+	     m_bad     , variant | 124 , variant | 125 ,     m_bad     , variant | 126 , variant | 127 , variant | 128 , variant | 129 , /* 10x */
+	     m_bad     ,     m_bad     , variant | 130 , variant | 131 ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 11x */
+	 variant | 132 , variant | 133 , variant | 134 , variant | 135 , variant | 136 , variant | 137 , variant | 138 , variant | 139 , /* 12x */
+	 variant | 140 , variant | 141 , variant | 142 , variant | 143 , variant | 144 , variant | 145 , variant | 146 , variant | 147 , /* 13x */
+	  m_vpunpcklbw ,  m_vpunpcklwd ,  m_vpunpckldq ,  m_vpacksswb  ,   m_vpcmpgtb  ,   m_vpcmpgtw  ,   m_vpcmpgtd  ,  m_vpackuswb  , /* 14x */
+	  m_vpunpckhbw ,  m_vpunpckhwd ,  m_vpunpckhdq ,  m_vpackssdw  , m_vpunpcklqdq , m_vpunpckhqdq , variant | 148 , variant | 149 , /* 15x */
+	 variant | 150 , variant | 151 , variant | 152 , variant | 153 ,   m_vpcmpeqb  ,   m_vpcmpeqw  ,   m_vpcmpeqd  , variant | 154 , /* 16x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , variant | 155 , variant | 156 , variant | 157 , variant | 149 , /* 17x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 20x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 21x */
+	 variant | 158 , variant | 158 , variant | 159 , variant | 159 ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 22x */
+	 variant | 160 , variant | 161 ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 23x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 24x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , variant | 162 ,     m_bad     , /* 25x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 26x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 27x */
+	     m_bad     ,     m_bad     , variant | 163 ,     m_bad     ,   m_vpinsrw   ,   m_vpextrw   , variant | 164 ,     m_bad     , /* 30x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 31x */
+	 variant | 165 ,    m_vpsrlw   ,    m_vpsrld   ,    m_vpsrlq   ,    m_vpaddq   ,   m_vpmullw   ,    m_vmovq    ,  m_vpmovmskb  , /* 32x */
+	   m_vpsubusb  ,   m_vpsubusw  ,   m_vpminub   ,    m_vpand    ,   m_vpaddusb  ,   m_vpaddusw  ,   m_vpmaxub   ,    m_vpandn   , /* 33x */
+	    m_vpavgb   ,    m_vpsraw   ,    m_vpsrad   ,    m_vpavgw   ,   m_vpmulhuw  ,   m_vpmulhw   , variant | 166 ,   m_vmovntdq  , /* 34x */
+	   m_vpsubsb   ,   m_vpsubsw   ,   m_vpminsw   ,     m_vpor    ,   m_vpaddsb   ,   m_vpaddsw   ,   m_vpmaxsw   ,    m_vpxor    , /* 35x */
+	    m_vlddqu   ,    m_vpsllw   ,    m_vpslld   ,    m_vpsllq   ,   m_vpmuludq  ,   m_vpmaddwd  ,   m_vpsadbw   , m_vmaskmovdqu , /* 36x */
+	    m_vpsubb   ,    m_vpsubw   ,    m_vpsubd   ,    m_vpsubq   ,    m_vpaddb   ,    m_vpaddw   ,    m_vpaddd   ,     m_bad     , /* 37x */
+};
+
+/* VEX 0F 38 xx */
+const uint16_t ssde_x86_names::vex_0f38[256] =
+{
+	/*        x0        |         x1        |         x2        |         x3        |         x4        |         x5        |         x6        |         x7         */
+	    m_vpshufb     ,    m_vphaddw     ,    m_vphaddd     ,    m_vphaddsw    ,   m_vpmaddubsw   ,    m_vphsubw     ,    m_vphsubd     ,    m_vphsubsw    , /* 00x */
+	    m_vpsignb     ,    m_vpsignw     ,    m_vpsignd     ,   m_vpmulhrsw    ,   m_vpermilps    ,   m_vpermilpd    ,    m_vtestps     ,    m_vtestpd     , /* 01x */
+	      m_bad       ,      m_bad       ,      m_bad       ,   m_vcvtph2ps    ,      m_bad       ,      m_bad       ,    m_vpermps     ,     m_vptest     , /* 02x */
+	  m_vbroadcastss  ,  m_vbroadcastsd  , m_vbroadcastf128 ,      m_bad       ,     m_vpabsb     ,     m_vpabsw     ,     m_vpabsd     ,      m_bad       , /* 03x */
+	   m_vpmovsxbw    ,   m_vpmovsxbd    ,   m_vpmovsxbq    ,   m_vpmovsxwd    ,   m_vpmovsxwq    ,   m_vpmovsxdq    ,      m_bad       ,      m_bad       , /* 04x */
+	    m_vpmuldq     ,    m_vpcmpeqq    ,   m_vmovntdqa    ,   m_vpackusdw    ,   m_vmaskmovps   ,   m_vmaskmovpd   ,   m_vmaskmovps   ,   m_vmaskmovpd   , /* 05x */
+	   m_vpmovzxbw    ,   m_vpmovzxbd    ,   m_vpmovzxbq    ,   m_vpmovzxwd    ,   m_vpmovzxwq    ,   m_vpmovzxdq    ,     m_vpermd     ,    m_vpcmpgtq    , /* 06x */
+	    m_vpminsb     ,    m_vpminsd     ,    m_vpminuw     ,    m_vpminud     ,    m_vpmaxsb     ,    m_vpmaxsd     ,    m_vpmaxuw     ,    m_vpmaxud     , /* 07x */
+	    m_vpmulld     ,  m_vphminposuw   ,      m_bad       ,      m_bad       ,      m_bad       ,  variant | 167   ,    m_vpsravd     ,  variant | 168   , /* 10x */
+	      m_bad       ,  variant | 169   ,      m_bad       ,  variant | 170   ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       , /* 11x */
+	    m_vpdpbusd    ,   m_vpdpbusds    ,    m_vpdpwssd    ,   m_vpdpwssds    ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       , /* 12x */
+	  m_vpbroadcastd  ,  m_vpbroadcastq  , m_vbroadcasti128 ,      m_bad       ,   m_tdpbf16ps    ,      m_bad       ,  variant | 171   ,      m_bad       , /* 13x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       , /* 14x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       , /* 15x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       , /* 16x */
+	  m_vpbroadcastb  ,  m_vpbroadcastw  ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       , /* 17x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       , /* 20x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,  variant | 172   ,      m_bad       ,  variant | 172   ,      m_bad       , /* 21x */
+	  variant | 173   ,  variant | 174   ,  variant | 175   ,  variant | 176   ,      m_bad       ,      m_bad       ,  variant | 177   ,  variant | 178   , /* 22x */
+	  variant | 179   ,  variant | 180   ,  variant | 181   ,  variant | 182   ,  variant | 183   ,  variant | 184   ,  variant | 185   ,  variant | 186   , /* 23x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,  variant | 187   ,  variant | 188   , /* 24x */
+	  variant | 189   ,  variant | 190   ,  variant | 191   ,  variant | 192   ,  variant | 193   ,  variant | 194   ,  variant | 195   ,  variant | 196   , /* 25x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,  variant | 197   ,  variant | 198   , /* 26x */
+	  variant | 199   ,  variant | 200   ,  variant | 201   ,  variant | 202   ,  variant | 203   ,  variant | 204   ,  variant | 205   ,  variant | 206   , /* 27x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       , /* 30x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,   m_vgf2p8mulb   , /* 31x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       , /* 32x */
+	      m_bad       ,      m_bad       ,      m_bad       ,    m_vaesimc     ,    m_vaesenc     ,  m_vaesenclast   ,    m_vaesdec     ,  m_vaesdeclast   , /* 33x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       , /* 34x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       , /* 35x */
+	      m_bad       ,      m_bad       ,      m_andn      ,  variant | 207   ,      m_bad       ,  variant | 208   ,      m_mulx      ,  variant | 209   , /* 36x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       , /* 37x */
+};
+
+/* VEX 0F 3A xx */
+const uint16_t ssde_x86_names::vex_0f3a[256] =
+{
+	/*         x0          |          x1          |          x2          |          x3          |          x4          |          x5          |          x6          |          x7           */
+	       m_vpermq      ,      m_vpermpd      ,      m_vpblendd     ,        m_bad        ,     m_vpermilps     ,     m_vpermilpd     ,     m_vperm2f128    ,        m_bad        , /* 00x */
+	      m_vroundps     ,      m_vroundpd     ,      m_vroundss     ,      m_vroundsd     ,      m_vblendps     ,      m_vblendpd     ,      m_vpblendw     ,      m_vpalignr     , /* 01x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,      m_vpextrb      ,      m_vpextrw      ,    variant | 210    ,     m_vextractps    , /* 02x */
+	    m_vinsertf128    ,    m_vextractf128   ,        m_bad        ,        m_bad        ,        m_bad        ,     m_vcvtps2ph     ,        m_bad        ,        m_bad        , /* 03x */
+	      m_vpinsrb      ,     m_vinsertps     ,    variant | 211    ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 04x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 05x */
+	    variant | 212    ,    variant | 213    ,    variant | 214    ,    variant | 215    ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 06x */
+	    m_vinserti128    ,    m_vextracti128   ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 07x */
+	       m_vdpps       ,       m_vdppd       ,      m_vmpsadbw     ,        m_bad        ,     m_vpclmulqdq    ,        m_bad        ,     m_vperm2i128    ,        m_bad        , /* 10x */
+	     m_vpermil2ps    ,     m_vpermil2pd    ,     m_vblendvps     ,     m_vblendvpd     ,     m_vpblendvb     ,        m_bad        ,        m_bad        ,        m_bad        , /* 11x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 12x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,    m_vfmaddsubps    ,    m_vfmaddsubpd    ,    m_vfmsubaddps    ,    m_vfmsubaddpd    , /* 13x */
+	     m_vpcmpestrm    ,     m_vpcmpestri    ,     m_vpcmpistrm    ,     m_vpcmpistri    ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 14x */
+	      m_vfmaddps     ,      m_vfmaddpd     ,      m_vfmaddss     ,      m_vfmaddsd     ,      m_vfmsubps     ,      m_vfmsubpd     ,      m_vfmsubss     ,      m_vfmsubsd     , /* 15x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 16x */
+	     m_vfnmaddps     ,     m_vfnmaddpd     ,     m_vfnmaddss     ,     m_vfnmaddsd     ,     m_vfnmsubps     ,     m_vfnmsubpd     ,     m_vfnmsubss     ,     m_vfnmsubsd     , /* 17x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 20x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 21x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 22x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 23x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 24x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 25x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 26x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 27x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 30x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,   m_vgf2p8affineqb  , m_vgf2p8affineinvqb , /* 31x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 32x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,  m_vaeskeygenassist , /* 33x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 34x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 35x */
+	        m_rorx       ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 36x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 37x */
+};
+
+/* EVEX 0F xx */
+const uint16_t ssde_x86_names::evex_0f[256] =
+{
+	/*      x0       |       x1       |       x2       |       x3       |       x4       |       x5       |       x6       |       x7        */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 00x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 01x */
+	 variant | 110 , variant | 110 , variant | 111 , variant | 112 , variant | 113 , variant | 114 , variant | 115 , variant | 116 , /* 02x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 03x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 04x */
+	 variant | 117 , variant | 117 , variant | 118 , variant | 119 , variant | 120 , variant | 121 , variant | 122 , variant | 123 , /* 05x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 06x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 07x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 10x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 11x */
+	     m_bad     , variant | 133 ,     m_bad     ,     m_bad     , variant | 136 , variant | 137 , variant | 138 , variant | 139 , /* 12x */
+	 variant | 140 , variant | 141 , variant | 142 , variant | 216 , variant | 144 , variant | 145 , variant | 146 , variant | 147 , /* 13x */
+	  m_vpunpcklbw ,  m_vpunpcklwd ,  m_vpunpckldq ,  m_vpacksswb  ,   m_vpcmpgtb  ,   m_vpcmpgtw  ,   m_vpcmpgtd  ,  m_vpackuswb  , /* 14x */
+	  m_vpunpckhbw ,  m_vpunpckhwd ,  m_vpunpckhdq ,  m_vpackssdw  , m_vpunpcklqdq , m_vpunpckhqdq , variant | 148 , variant | 217 , /* 15x */
+	 variant | 150 , variant | 151 , variant | 218 , variant | 153 ,   m_vpcmpeqb  ,   m_vpcmpeqw  ,   m_vpcmpeqd  ,     m_bad     , /* 16x */
+	 variant | 219 , variant | 220 , variant | 221 , variant | 222 ,     m_bad     ,     m_bad     , variant | 148 , variant | 217 , /* 17x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 20x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 21x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 22x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 23x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 24x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 25x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 26x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 27x */
+	     m_bad     ,     m_bad     , variant | 163 ,     m_bad     ,   m_vpinsrw   ,   m_vpextrw   , variant | 164 ,     m_bad     , /* 30x */
+	     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     ,     m_bad     , /* 31x */
+	     m_bad     ,    m_vpsrlw   ,    m_vpsrld   ,    m_vpsrlq   ,    m_vpaddq   ,   m_vpmullw   ,    m_vmovq    ,     m_bad     , /* 32x */
+	   m_vpsubusb  ,   m_vpsubusw  ,   m_vpminub   , variant | 223 ,   m_vpaddusb  ,   m_vpaddusw  ,   m_vpmaxub   , variant | 224 , /* 33x */
+	    m_vpavgb   ,    m_vpsraw   , variant | 225 ,    m_vpavgw   ,   m_vpmulhuw  ,   m_vpmulhw   , variant | 226 ,   m_vmovntdq  , /* 34x */
+	   m_vpsubsb   ,   m_vpsubsw   ,   m_vpminsw   , variant | 227 ,   m_vpaddsb   ,   m_vpaddsw   ,   m_vpmaxsw   , variant | 228 , /* 35x */
+	     m_bad     ,    m_vpsllw   ,    m_vpslld   ,    m_vpsllq   ,   m_vpmuludq  ,   m_vpmaddwd  ,   m_vpsadbw   ,     m_bad     , /* 36x */
+	    m_vpsubb   ,    m_vpsubw   ,    m_vpsubd   ,    m_vpsubq   ,    m_vpaddb   ,    m_vpaddw   ,    m_vpaddd   ,     m_bad     , /* 37x */
+};
+
+/* EVEX 0F 38 xx */
+const uint16_t ssde_x86_names::evex_0f38[256] =
+{
+	/*        x0        |         x1        |         x2        |         x3        |         x4        |         x5        |         x6        |         x7         */
+	    m_vpshufb     ,      m_bad       ,      m_bad       ,      m_bad       ,   m_vpmaddubsw   ,      m_bad       ,      m_bad       ,      m_bad       , /* 00x */
+	      m_bad       ,      m_bad       ,      m_bad       ,   m_vpmulhrsw    ,   m_vpermilps    ,   m_vpermilpd    ,      m_bad       ,      m_bad       , /* 01x */
+	  variant | 229   ,  variant | 230   ,  variant | 231   ,  variant | 232   ,  variant | 233   ,  variant | 234   ,  variant | 235   ,      m_bad       , /* 02x */
+	  m_vbroadcastss  ,  variant | 236   ,  variant | 237   ,  variant | 238   ,     m_vpabsb     ,     m_vpabsw     ,     m_vpabsd     ,     m_vpabsq     , /* 03x */
+	  variant | 239   ,  variant | 240   ,  variant | 241   ,  variant | 242   ,  variant | 243   ,  variant | 244   ,  variant | 245   ,  variant | 246   , /* 04x */
+	  variant | 247   ,  variant | 248   ,  variant | 249   ,   m_vpackusdw    ,  variant | 250   ,  variant | 251   ,      m_bad       ,      m_bad       , /* 05x */
+	  variant | 252   ,  variant | 253   ,  variant | 254   ,  variant | 255   ,  variant | 256   ,  variant | 257   ,  variant | 258   ,    m_vpcmpgtq    , /* 06x */
+	  variant | 259   ,  variant | 260   ,  variant | 261   ,  variant | 262   ,    m_vpmaxsb     ,  variant | 263   ,    m_vpmaxuw     ,  variant | 264   , /* 07x */
+	  variant | 265   ,      m_bad       ,  variant | 266   ,  variant | 267   ,  variant | 268   ,  variant | 167   ,  variant | 269   ,  variant | 168   , /* 10x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,  variant | 270   ,  variant | 271   ,  variant | 272   ,  variant | 273   , /* 11x */
+	    m_vpdpbusd    ,   m_vpdpbusds    ,  variant | 274   ,  variant | 275   ,  variant | 276   ,  variant | 277   ,      m_bad       ,      m_bad       , /* 12x */
+	  m_vpbroadcastd  ,  variant | 278   ,  variant | 279   ,  variant | 280   ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       , /* 13x */
+	      m_bad       ,      m_bad       ,  variant | 281   ,  variant | 282   ,  variant | 283   ,  variant | 284   ,  variant | 285   ,      m_bad       , /* 14x */
+	  variant | 286   ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       , /* 15x */
+	    m_vpshldvw    ,  variant | 287   ,  variant | 288   ,  variant | 289   ,      m_bad       ,  variant | 290   ,  variant | 291   ,  variant | 292   , /* 16x */
+	  m_vpbroadcastb  ,  m_vpbroadcastw  ,  m_vpbroadcastb  ,  m_vpbroadcastw  ,  variant | 293   ,  variant | 294   ,  variant | 295   ,  variant | 296   , /* 17x */
+	      m_bad       ,      m_bad       ,      m_bad       , m_vpmultishiftqb ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       , /* 20x */
+	  variant | 297   ,  variant | 298   ,  variant | 299   ,  variant | 300   ,      m_bad       ,  variant | 301   ,      m_bad       ,  m_vpshufbitqmb  , /* 21x */
+	  variant | 173   ,  variant | 174   ,  variant | 175   ,  variant | 176   ,      m_bad       ,      m_bad       ,  variant | 177   ,  variant | 178   , /* 22x */
+	  variant | 179   ,  variant | 180   ,  variant | 302   ,  variant | 303   ,  variant | 183   ,  variant | 184   ,  variant | 185   ,  variant | 186   , /* 23x */
+	  variant | 304   ,  variant | 305   ,  variant | 306   ,  variant | 307   ,      m_bad       ,      m_bad       ,  variant | 187   ,  variant | 188   , /* 24x */
+	  variant | 189   ,  variant | 190   ,  variant | 308   ,  variant | 309   ,  variant | 193   ,  variant | 194   ,  variant | 195   ,  variant | 196   , /* 25x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,  m_vpmadd52luq   ,  m_vpmadd52huq   ,  variant | 197   ,  variant | 198   , /* 26x */
+	  variant | 199   ,  variant | 200   ,  variant | 201   ,  variant | 202   ,  variant | 203   ,  variant | 204   ,  variant | 205   ,  variant | 206   , /* 27x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,  variant | 310   ,      m_bad       ,  variant | 311   ,  variant | 312   , /* 30x */
+	  variant | 313   ,      m_bad       ,  variant | 314   ,  variant | 315   ,  variant | 316   ,  variant | 317   ,      m_bad       ,   m_vgf2p8mulb   , /* 31x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       , /* 32x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,    m_vaesenc     ,  m_vaesenclast   ,    m_vaesdec     ,  m_vaesdeclast   , /* 33x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       , /* 34x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       , /* 35x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       , /* 36x */
+	      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       ,      m_bad       , /* 37x */
+};
+
+/* EVEX 0F 3A xx */
+const uint16_t ssde_x86_names::evex_0f3a[256] =
+{
+	/*         x0          |          x1          |          x2          |          x3          |          x4          |          x5          |          x6          |          x7           */
+	       m_vpermq      ,      m_vpermpd      ,        m_bad        ,    variant | 318    ,     m_vpermilps     ,     m_vpermilpd     ,        m_bad        ,        m_bad        , /* 00x */
+	    variant | 319    ,    m_vrndscalepd    ,    variant | 320    ,    m_vrndscalesd    ,        m_bad        ,        m_bad        ,        m_bad        ,      m_vpalignr     , /* 01x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,      m_vpextrb      ,      m_vpextrw      ,    variant | 210    ,     m_vextractps    , /* 02x */
+	    variant | 321    ,    variant | 322    ,    variant | 323    ,    variant | 324    ,        m_bad        ,     m_vcvtps2ph     ,    variant | 325    ,    variant | 326    , /* 03x */
+	      m_vpinsrb      ,     m_vinsertps     ,    variant | 211    ,    variant | 327    ,        m_bad        ,    variant | 328    ,    variant | 329    ,    variant | 330    , /* 04x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 05x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 06x */
+	    variant | 331    ,    variant | 332    ,    variant | 333    ,    variant | 334    ,        m_bad        ,        m_bad        ,    variant | 335    ,    variant | 336    , /* 07x */
+	        m_bad        ,        m_bad        ,     m_vdbpsadbw     ,    variant | 337    ,     m_vpclmulqdq    ,        m_bad        ,        m_bad        ,        m_bad        , /* 10x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 11x */
+	    variant | 338    ,    variant | 339    ,        m_bad        ,        m_bad        ,    variant | 340    ,    variant | 341    ,    variant | 342    ,    variant | 343    , /* 12x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 13x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,    variant | 344    ,    variant | 345    , /* 14x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 15x */
+	      m_vpshldw      ,    variant | 346    ,      m_vpshrdw      ,    variant | 347    ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 16x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 17x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 20x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 21x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 22x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 23x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 24x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 25x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 26x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 27x */
+	        m_bad        ,        m_bad        ,    variant | 348    ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 30x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,   m_vgf2p8affineqb  , m_vgf2p8affineinvqb , /* 31x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 32x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 33x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 34x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 35x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 36x */
+	        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        ,        m_bad        , /* 37x */
+};
+
+/* which fields pick the mnemonic of an opcode and where its list starts */
+const ssde_x86_names::variant_desc ssde_x86_names::variants[] =
+{
+	{ s_p, 0 },                            /* 0: 60 */
+	{ s_p, 4 },                            /* 1: 61 */
+	{ s_x, 8 },                            /* 2: 63 */
+	{ s_p | s_w, 10 },                     /* 3: 6D */
+	{ s_p | s_w, 18 },                     /* 4: 6F */
+	{ s_r, 26 },                           /* 5: 80 */
+	{ s_p | s_w, 34 },                     /* 6: 90 */
+	{ s_p | s_w, 42 },                     /* 7: 98 */
+	{ s_p | s_w, 50 },                     /* 8: 99 */
+	{ s_x | s_p | s_w, 58 },               /* 9: 9C */
+	{ s_x | s_p | s_w, 74 },               /* 10: 9D */
+	{ s_x, 90 },                           /* 11: A0 */
+	{ s_p | s_w, 92 },                     /* 12: A5 */
+	{ s_p | s_w, 100 },                    /* 13: A7 */
+	{ s_p | s_w, 108 },                    /* 14: AB */
+	{ s_p | s_w, 116 },                    /* 15: AD */
+	{ s_p | s_w, 124 },                    /* 16: AF */
+	{ s_w, 132 },                          /* 17: B8 */
+	{ s_r, 134 },                          /* 18: C0 */
+	{ s_m, 142 },                          /* 19: C5 */
+	{ s_m | s_r, 144 },                    /* 20: C6 */
+	{ s_m | s_r, 160 },                    /* 21: C7 */
+	{ s_w, 176 },                          /* 22: CA */
+	{ s_p | s_w, 178 },                    /* 23: CF */
+	{ s_r, 186 },                          /* 24: D8 */
+	{ s_m | s_r | s_b, 194 },              /* 25: D9 */
+	{ s_m | s_r, 322 },                    /* 26: DA */
+	{ s_m | s_r | s_b, 338 },              /* 27: DB */
+	{ s_m | s_r, 466 },                    /* 28: DC */
+	{ s_m | s_r, 482 },                    /* 29: DD */
+	{ s_m | s_r, 498 },                    /* 30: DE */
+	{ s_m | s_r, 514 },                    /* 31: DF */
+	{ s_x | s_p | s_w | s_a, 530 },        /* 32: E3 */
+	{ s_r, 562 },                          /* 33: F6 */
+	{ s_r, 570 },                          /* 34: FE */
+	{ s_p | s_w | s_r, 578 },              /* 35: FF */
+	{ s_r, 642 },                          /* 36: 0F 00 */
+	{ s_p | s_m | s_r | s_b, 650 },        /* 37: 0F 01 */
+	{ s_w, 1162 },                         /* 38: 0F 07 */
+	{ s_p, 1164 },                         /* 39: 0F 09 */
+	{ s_r, 1168 },                         /* 40: 0F 0D */
+	{ s_p, 1176 },                         /* 41: 0F 10 */
+	{ s_p | s_m, 1180 },                   /* 42: 0F 12 */
+	{ s_p, 1188 },                         /* 43: 0F 13 */
+	{ s_p, 1192 },                         /* 44: 0F 14 */
+	{ s_p, 1196 },                         /* 45: 0F 15 */
+	{ s_p | s_m, 1200 },                   /* 46: 0F 16 */
+	{ s_p, 1208 },                         /* 47: 0F 17 */
+	{ s_r, 1212 },                         /* 48: 0F 18 */
+	{ s_w | s_r | s_b, 1220 },             /* 49: 0F 1E */
+	{ s_p, 1348 },                         /* 50: 0F 28 */
+	{ s_p, 1352 },                         /* 51: 0F 2A */
+	{ s_p, 1356 },                         /* 52: 0F 2B */
+	{ s_p, 1360 },                         /* 53: 0F 2C */
+	{ s_p, 1364 },                         /* 54: 0F 2D */
+	{ s_p, 1368 },                         /* 55: 0F 2E */
+	{ s_p, 1372 },                         /* 56: 0F 2F */
+	{ s_w, 1376 },                         /* 57: 0F 35 */
+	{ s_p, 1378 },                         /* 58: 0F 50 */
+	{ s_p, 1382 },                         /* 59: 0F 51 */
+	{ s_p, 1386 },                         /* 60: 0F 52 */
+	{ s_p, 1390 },                         /* 61: 0F 53 */
+	{ s_p, 1394 },                         /* 62: 0F 54 */
+	{ s_p, 1398 },                         /* 63: 0F 55 */
+	{ s_p, 1402 },                         /* 64: 0F 56 */
+	{ s_p, 1406 },                         /* 65: 0F 57 */
+	{ s_p, 1410 },                         /* 66: 0F 58 */
+	{ s_p, 1414 },                         /* 67: 0F 59 */
+	{ s_p, 1418 },                         /* 68: 0F 5A */
+	{ s_p, 1422 },                         /* 69: 0F 5B */
+	{ s_p, 1426 },                         /* 70: 0F 5C */
+	{ s_p, 1430 },                         /* 71: 0F 5D */
+	{ s_p, 1434 },                         /* 72: 0F 5E */
+	{ s_p, 1438 },                         /* 73: 0F 5F */
+	{ s_p | s_w, 1442 },                   /* 74: 0F 6E */
+	{ s_p, 1450 },                         /* 75: 0F 6F */
+	{ s_p, 1454 },                         /* 76: 0F 70 */
+	{ s_r, 1458 },                         /* 77: 0F 71 */
+	{ s_r, 1466 },                         /* 78: 0F 72 */
+	{ s_r, 1474 },                         /* 79: 0F 73 */
+	{ s_p | s_m, 1482 },                   /* 80: 0F 78 */
+	{ s_p | s_m, 1490 },                   /* 81: 0F 79 */
+	{ s_p, 1498 },                         /* 82: 0F 7C */
+	{ s_p, 1502 },                         /* 83: 0F 7D */
+	{ s_p | s_w, 1506 },                   /* 84: 0F 7E */
+	{ s_r, 1514 },                         /* 85: 0F A6 */
+	{ s_r, 1522 },                         /* 86: 0F A7 */
+	{ s_p | s_w | s_m | s_r, 1530 },       /* 87: 0F AE */
+	{ s_r, 1658 },                         /* 88: 0F BA */
+	{ s_p, 1666 },                         /* 89: 0F BC */
+	{ s_p, 1670 },                         /* 90: 0F BD */
+	{ s_p, 1674 },                         /* 91: 0F C2 */
+	{ s_p, 1678 },                         /* 92: 0F C6 */
+	{ s_p | s_w | s_m | s_r, 1682 },       /* 93: 0F C7 */
+	{ s_p, 1810 },                         /* 94: 0F D0 */
+	{ s_p, 1814 },                         /* 95: 0F D6 */
+	{ s_p, 1818 },                         /* 96: 0F E6 */
+	{ s_p, 1822 },                         /* 97: 0F E7 */
+	{ s_p, 1826 },                         /* 98: 0F F7 */
+	{ s_r, 1830 },                         /* 99: 0F 38 D8 */
+	{ s_p | s_m, 1838 },                   /* 100: 0F 38 DC */
+	{ s_p, 1846 },                         /* 101: 0F 38 DD */
+	{ s_p, 1850 },                         /* 102: 0F 38 DE */
+	{ s_p, 1854 },                         /* 103: 0F 38 DF */
+	{ s_p, 1858 },                         /* 104: 0F 38 F0 */
+	{ s_w, 1862 },                         /* 105: 0F 38 F5 */
+	{ s_p | s_w, 1864 },                   /* 106: 0F 38 F6 */
+	{ s_p, 1872 },                         /* 107: 0F 38 F8 */
+	{ s_w, 1876 },                         /* 108: 0F 3A 16 */
+	{ s_w, 1878 },                         /* 109: 0F 3A 22 */
+	{ s_p, 1880 },                         /* 110: VEX 0F 10 */
+	{ s_p | s_m, 1884 },                   /* 111: VEX 0F 12 */
+	{ s_p, 1892 },                         /* 112: VEX 0F 13 */
+	{ s_p, 1896 },                         /* 113: VEX 0F 14 */
+	{ s_p, 1900 },                         /* 114: VEX 0F 15 */
+	{ s_p | s_m, 1904 },                   /* 115: VEX 0F 16 */
+	{ s_p, 1912 },                         /* 116: VEX 0F 17 */
+	{ s_p, 1916 },                         /* 117: VEX 0F 28 */
+	{ s_p, 1920 },                         /* 118: VEX 0F 2A */
+	{ s_p, 1924 },                         /* 119: VEX 0F 2B */
+	{ s_p, 1928 },                         /* 120: VEX 0F 2C */
+	{ s_p, 1932 },                         /* 121: VEX 0F 2D */
+	{ s_p, 1936 },                         /* 122: VEX 0F 2E */
+	{ s_p, 1940 },                         /* 123: VEX 0F 2F */
+	{ s_p | s_w, 1944 },                   /* 124: VEX 0F 41 */
+	{ s_p | s_w, 1952 },                   /* 125: VEX 0F 42 */
+	{ s_p | s_w, 1960 },                   /* 126: VEX 0F 44 */
+	{ s_p | s_w, 1968 },                   /* 127: VEX 0F 45 */
+	{ s_p | s_w, 1976 },                   /* 128: VEX 0F 46 */
+	{ s_p | s_w, 1984 },                   /* 129: VEX 0F 47 */
+	{ s_p | s_w, 1992 },                   /* 130: VEX 0F 4A */
+	{ s_p | s_w, 2000 },                   /* 131: VEX 0F 4B */
+	{ s_p, 2008 },                         /* 132: VEX 0F 50 */
+	{ s_p, 2012 },                         /* 133: VEX 0F 51 */
+	{ s_p, 2016 },                         /* 134: VEX 0F 52 */
+	{ s_p, 2020 },                         /* 135: VEX 0F 53 */
+	{ s_p, 2024 },                         /* 136: VEX 0F 54 */
+	{ s_p, 2028 },                         /* 137: VEX 0F 55 */
+	{ s_p, 2032 },                         /* 138: VEX 0F 56 */
+	{ s_p, 2036 },                         /* 139: VEX 0F 57 */
+	{ s_p, 2040 },                         /* 140: VEX 0F 58 */
+	{ s_p, 2044 },                         /* 141: VEX 0F 59 */
+	{ s_p, 2048 },                         /* 142: VEX 0F 5A */
+	{ s_p, 2052 },                         /* 143: VEX 0F 5B */
+	{ s_p, 2056 },                         /* 144: VEX 0F 5C */
+	{ s_p, 2060 },                         /* 145: VEX 0F 5D */
+	{ s_p, 2064 },                         /* 146: VEX 0F 5E */
+	{ s_p, 2068 },                         /* 147: VEX 0F 5F */
+	{ s_w, 2072 },                         /* 148: VEX 0F 6E */
+	{ s_p, 2074 },                         /* 149: VEX 0F 6F */
+	{ s_p, 2078 },                         /* 150: VEX 0F 70 */
+	{ s_r, 2082 },                         /* 151: VEX 0F 71 */
+	{ s_r, 2090 },                         /* 152: VEX 0F 72 */
+	{ s_r, 2098 },                         /* 153: VEX 0F 73 */
+	{ s_l, 2106 },                         /* 154: VEX 0F 77 */
+	{ s_p, 2110 },                         /* 155: VEX 0F 7C */
+	{ s_p, 2114 },                         /* 156: VEX 0F 7D */
+	{ s_p | s_w, 2118 },                   /* 157: VEX 0F 7E */
+	{ s_p | s_w, 2126 },                   /* 158: VEX 0F 90 */
+	{ s_p | s_w, 2134 },                   /* 159: VEX 0F 92 */
+	{ s_p | s_w, 2142 },                   /* 160: VEX 0F 98 */
+	{ s_p | s_w, 2150 },                   /* 161: VEX 0F 99 */
+	{ s_r, 2158 },                         /* 162: VEX 0F AE */
+	{ s_p, 2166 },                         /* 163: VEX 0F C2 */
+	{ s_p, 2170 },                         /* 164: VEX 0F C6 */
+	{ s_p, 2174 },                         /* 165: VEX 0F D0 */
+	{ s_p, 2178 },                         /* 166: VEX 0F E6 */
+	{ s_w, 2182 },                         /* 167: VEX 0F 38 45 */
+	{ s_w, 2184 },                         /* 168: VEX 0F 38 47 */
+	{ s_p | s_m, 2186 },                   /* 169: VEX 0F 38 49 */
+	{ s_p, 2194 },                         /* 170: VEX 0F 38 4B */
+	{ s_p, 2198 },                         /* 171: VEX 0F 38 5E */
+	{ s_w, 2202 },                         /* 172: VEX 0F 38 8C */
+	{ s_w, 2204 },                         /* 173: VEX 0F 38 90 */
+	{ s_w, 2206 },                         /* 174: VEX 0F 38 91 */
+	{ s_w, 2208 },                         /* 175: VEX 0F 38 92 */
+	{ s_w, 2210 },                         /* 176: VEX 0F 38 93 */
+	{ s_w, 2212 },                         /* 177: VEX 0F 38 96 */
+	{ s_w, 2214 },                         /* 178: VEX 0F 38 97 */
+	{ s_w, 2216 },                         /* 179: VEX 0F 38 98 */
+	{ s_w, 2218 },                         /* 180: VEX 0F 38 99 */
+	{ s_w, 2220 },                         /* 181: VEX 0F 38 9A */
+	{ s_w, 2222 },                         /* 182: VEX 0F 38 9B */
+	{ s_w, 2224 },                         /* 183: VEX 0F 38 9C */
+	{ s_w, 2226 },                         /* 184: VEX 0F 38 9D */
+	{ s_w, 2228 },                         /* 185: VEX 0F 38 9E */
+	{ s_w, 2230 },                         /* 186: VEX 0F 38 9F */
+	{ s_w, 2232 },                         /* 187: VEX 0F 38 A6 */
+	{ s_w, 2234 },                         /* 188: VEX 0F 38 A7 */
+	{ s_w, 2236 },                         /* 189: VEX 0F 38 A8 */
+	{ s_w, 2238 },                         /* 190: VEX 0F 38 A9 */
+	{ s_w, 2240 },                         /* 191: VEX 0F 38 AA */
+	{ s_w, 2242 },                         /* 192: VEX 0F 38 AB */
+	{ s_w, 2244 },                         /* 193: VEX 0F 38 AC */
+	{ s_w, 2246 },                         /* 194: VEX 0F 38 AD */
+	{ s_w, 2248 },                         /* 195: VEX 0F 38 AE */
+	{ s_w, 2250 },                         /* 196: VEX 0F 38 AF */
+	{ s_w, 2252 },                         /* 197: VEX 0F 38 B6 */
+	{ s_w, 2254 },                         /* 198: VEX 0F 38 B7 */
+	{ s_w, 2256 },                         /* 199: VEX 0F 38 B8 */
+	{ s_w, 2258 },                         /* 200: VEX 0F 38 B9 */
+	{ s_w, 2260 },                         /* 201: VEX 0F 38 BA */
+	{ s_w, 2262 },                         /* 202: VEX 0F 38 BB */
+	{ s_w, 2264 },                         /* 203: VEX 0F 38 BC */
+	{ s_w, 2266 },                         /* 204: VEX 0F 38 BD */
+	{ s_w, 2268 },                         /* 205: VEX 0F 38 BE */
+	{ s_w, 2270 },                         /* 206: VEX 0F 38 BF */
+	{ s_r, 2272 },                         /* 207: VEX 0F 38 F3 */
+	{ s_p, 2280 },                         /* 208: VEX 0F 38 F5 */
+	{ s_p, 2284 },                         /* 209: VEX 0F 38 F7 */
+	{ s_w, 2288 },                         /* 210: VEX 0F 3A 16 */
+	{ s_w, 2290 },                         /* 211: VEX 0F 3A 22 */
+	{ s_w, 2292 },                         /* 212: VEX 0F 3A 30 */
+	{ s_w, 2294 },                         /* 213: VEX 0F 3A 31 */
+	{ s_w, 2296 },                         /* 214: VEX 0F 3A 32 */
+	{ s_w, 2298 },                         /* 215: VEX 0F 3A 33 */
+	{ s_p | s_w, 2300 },                   /* 216: EVEX 0F 5B */
+	{ s_p | s_w, 2308 },                   /* 217: EVEX 0F 6F */
+	{ s_w | s_r, 2316 },                   /* 218: EVEX 0F 72 */
+	{ s_p | s_w, 2332 },                   /* 219: EVEX 0F 78 */
+	{ s_p | s_w, 2340 },                   /* 220: EVEX 0F 79 */
+	{ s_p | s_w, 2348 },                   /* 221: EVEX 0F 7A */
+	{ s_p | s_w, 2356 },                   /* 222: EVEX 0F 7B */
+	{ s_w, 2364 },                         /* 223: EVEX 0F DB */
+	{ s_w, 2366 },                         /* 224: EVEX 0F DF */
+	{ s_w, 2368 },                         /* 225: EVEX 0F E2 */
+	{ s_p | s_w, 2370 },                   /* 226: EVEX 0F E6 */
+	{ s_w, 2378 },                         /* 227: EVEX 0F EB */
+	{ s_w, 2380 },                         /* 228: EVEX 0F EF */
+	{ s_p, 2382 },                         /* 229: EVEX 0F 38 10 */
+	{ s_p, 2386 },                         /* 230: EVEX 0F 38 11 */
+	{ s_p, 2390 },                         /* 231: EVEX 0F 38 12 */
+	{ s_p, 2394 },                         /* 232: EVEX 0F 38 13 */
+	{ s_p | s_w, 2398 },                   /* 233: EVEX 0F 38 14 */
+	{ s_p | s_w, 2406 },                   /* 234: EVEX 0F 38 15 */
+	{ s_w, 2414 },                         /* 235: EVEX 0F 38 16 */
+	{ s_w, 2416 },                         /* 236: EVEX 0F 38 19 */
+	{ s_w, 2418 },                         /* 237: EVEX 0F 38 1A */
+	{ s_w, 2420 },                         /* 238: EVEX 0F 38 1B */
+	{ s_p, 2422 },                         /* 239: EVEX 0F 38 20 */
+	{ s_p, 2426 },                         /* 240: EVEX 0F 38 21 */
+	{ s_p, 2430 },                         /* 241: EVEX 0F 38 22 */
+	{ s_p, 2434 },                         /* 242: EVEX 0F 38 23 */
+	{ s_p, 2438 },                         /* 243: EVEX 0F 38 24 */
+	{ s_p, 2442 },                         /* 244: EVEX 0F 38 25 */
+	{ s_p | s_w, 2446 },                   /* 245: EVEX 0F 38 26 */
+	{ s_p | s_w, 2454 },                   /* 246: EVEX 0F 38 27 */
+	{ s_p | s_w, 2462 },                   /* 247: EVEX 0F 38 28 */
+	{ s_p | s_w, 2470 },                   /* 248: EVEX 0F 38 29 */
+	{ s_p, 2478 },                         /* 249: EVEX 0F 38 2A */
+	{ s_w, 2482 },                         /* 250: EVEX 0F 38 2C */
+	{ s_w, 2484 },                         /* 251: EVEX 0F 38 2D */
+	{ s_p, 2486 },                         /* 252: EVEX 0F 38 30 */
+	{ s_p, 2490 },                         /* 253: EVEX 0F 38 31 */
+	{ s_p, 2494 },                         /* 254: EVEX 0F 38 32 */
+	{ s_p, 2498 },                         /* 255: EVEX 0F 38 33 */
+	{ s_p, 2502 },                         /* 256: EVEX 0F 38 34 */
+	{ s_p, 2506 },                         /* 257: EVEX 0F 38 35 */
+	{ s_w, 2510 },                         /* 258: EVEX 0F 38 36 */
+	{ s_p | s_w, 2512 },                   /* 259: EVEX 0F 38 38 */
+	{ s_p | s_w, 2520 },                   /* 260: EVEX 0F 38 39 */
+	{ s_p, 2528 },                         /* 261: EVEX 0F 38 3A */
+	{ s_w, 2532 },                         /* 262: EVEX 0F 38 3B */
+	{ s_w, 2534 },                         /* 263: EVEX 0F 38 3D */
+	{ s_w, 2536 },                         /* 264: EVEX 0F 38 3F */
+	{ s_w, 2538 },                         /* 265: EVEX 0F 38 40 */
+	{ s_w, 2540 },                         /* 266: EVEX 0F 38 42 */
+	{ s_w, 2542 },                         /* 267: EVEX 0F 38 43 */
+	{ s_w, 2544 },                         /* 268: EVEX 0F 38 44 */
+	{ s_w, 2546 },                         /* 269: EVEX 0F 38 46 */
+	{ s_w, 2548 },                         /* 270: EVEX 0F 38 4C */
+	{ s_w, 2550 },                         /* 271: EVEX 0F 38 4D */
+	{ s_w, 2552 },                         /* 272: EVEX 0F 38 4E */
+	{ s_w, 2554 },                         /* 273: EVEX 0F 38 4F */
+	{ s_p, 2556 },                         /* 274: EVEX 0F 38 52 */
+	{ s_p, 2560 },                         /* 275: EVEX 0F 38 53 */
+	{ s_w, 2564 },                         /* 276: EVEX 0F 38 54 */
+	{ s_w, 2566 },                         /* 277: EVEX 0F 38 55 */
+	{ s_w, 2568 },                         /* 278: EVEX 0F 38 59 */
+	{ s_w, 2570 },                         /* 279: EVEX 0F 38 5A */
+	{ s_w, 2572 },                         /* 280: EVEX 0F 38 5B */
+	{ s_w, 2574 },                         /* 281: EVEX 0F 38 62 */
+	{ s_w, 2576 },                         /* 282: EVEX 0F 38 63 */
+	{ s_w, 2578 },                         /* 283: EVEX 0F 38 64 */
+	{ s_w, 2580 },                         /* 284: EVEX 0F 38 65 */
+	{ s_w, 2582 },                         /* 285: EVEX 0F 38 66 */
+	{ s_w, 2584 },                         /* 286: EVEX 0F 38 68 */
+	{ s_w, 2586 },                         /* 287: EVEX 0F 38 71 */
+	{ s_p, 2588 },                         /* 288: EVEX 0F 38 72 */
+	{ s_w, 2592 },                         /* 289: EVEX 0F 38 73 */
+	{ s_w, 2594 },                         /* 290: EVEX 0F 38 75 */
+	{ s_w, 2596 },                         /* 291: EVEX 0F 38 76 */
+	{ s_w, 2598 },                         /* 292: EVEX 0F 38 77 */
+	{ s_w, 2600 },                         /* 293: EVEX 0F 38 7C */
+	{ s_w, 2602 },                         /* 294: EVEX 0F 38 7D */
+	{ s_w, 2604 },                         /* 295: EVEX 0F 38 7E */
+	{ s_w, 2606 },                         /* 296: EVEX 0F 38 7F */
+	{ s_w, 2608 },                         /* 297: EVEX 0F 38 88 */
+	{ s_w, 2610 },                         /* 298: EVEX 0F 38 89 */
+	{ s_w, 2612 },                         /* 299: EVEX 0F 38 8A */
+	{ s_w, 2614 },                         /* 300: EVEX 0F 38 8B */
+	{ s_w, 2616 },                         /* 301: EVEX 0F 38 8D */
+	{ s_p | s_w, 2618 },                   /* 302: EVEX 0F 38 9A */
+	{ s_p | s_w, 2626 },                   /* 303: EVEX 0F 38 9B */
+	{ s_w, 2634 },                         /* 304: EVEX 0F 38 A0 */
+	{ s_w, 2636 },                         /* 305: EVEX 0F 38 A1 */
+	{ s_w, 2638 },                         /* 306: EVEX 0F 38 A2 */
+	{ s_w, 2640 },                         /* 307: EVEX 0F 38 A3 */
+	{ s_p | s_w, 2642 },                   /* 308: EVEX 0F 38 AA */
+	{ s_p | s_w, 2650 },                   /* 309: EVEX 0F 38 AB */
+	{ s_w, 2658 },                         /* 310: EVEX 0F 38 C4 */
+	{ s_w | s_r, 2660 },                   /* 311: EVEX 0F 38 C6 */
+	{ s_w | s_r, 2676 },                   /* 312: EVEX 0F 38 C7 */
+	{ s_w, 2692 },                         /* 313: EVEX 0F 38 C8 */
+	{ s_w, 2694 },                         /* 314: EVEX 0F 38 CA */
+	{ s_w, 2696 },                         /* 315: EVEX 0F 38 CB */
+	{ s_w, 2698 },                         /* 316: EVEX 0F 38 CC */
+	{ s_w, 2700 },                         /* 317: EVEX 0F 38 CD */
+	{ s_w, 2702 },                         /* 318: EVEX 0F 3A 03 */
+	{ s_p, 2704 },                         /* 319: EVEX 0F 3A 08 */
+	{ s_p, 2708 },                         /* 320: EVEX 0F 3A 0A */
+	{ s_w, 2712 },                         /* 321: EVEX 0F 3A 18 */
+	{ s_w, 2714 },                         /* 322: EVEX 0F 3A 19 */
+	{ s_w, 2716 },                         /* 323: EVEX 0F 3A 1A */
+	{ s_w, 2718 },                         /* 324: EVEX 0F 3A 1B */
+	{ s_w, 2720 },                         /* 325: EVEX 0F 3A 1E */
+	{ s_w, 2722 },                         /* 326: EVEX 0F 3A 1F */
+	{ s_w, 2724 },                         /* 327: EVEX 0F 3A 23 */
+	{ s_w, 2726 },                         /* 328: EVEX 0F 3A 25 */
+	{ s_p | s_w, 2728 },                   /* 329: EVEX 0F 3A 26 */
+	{ s_p | s_w, 2736 },                   /* 330: EVEX 0F 3A 27 */
+	{ s_w, 2744 },                         /* 331: EVEX 0F 3A 38 */
+	{ s_w, 2746 },                         /* 332: EVEX 0F 3A 39 */
+	{ s_w, 2748 },                         /* 333: EVEX 0F 3A 3A */
+	{ s_w, 2750 },                         /* 334: EVEX 0F 3A 3B */
+	{ s_w, 2752 },                         /* 335: EVEX 0F 3A 3E */
+	{ s_w, 2754 },                         /* 336: EVEX 0F 3A 3F */
+	{ s_w, 2756 },                         /* 337: EVEX 0F 3A 43 */
+	{ s_w, 2758 },                         /* 338: EVEX 0F 3A 50 */
+	{ s_w, 2760 },                         /* 339: EVEX 0F 3A 51 */
+	{ s_w, 2762 },                         /* 340: EVEX 0F 3A 54 */
+	{ s_w, 2764 },                         /* 341: EVEX 0F 3A 55 */
+	{ s_p | s_w, 2766 },                   /* 342: EVEX 0F 3A 56 */
+	{ s_p | s_w, 2774 },                   /* 343: EVEX 0F 3A 57 */
+	{ s_p | s_w, 2782 },                   /* 344: EVEX 0F 3A 66 */
+	{ s_p | s_w, 2790 },                   /* 345: EVEX 0F 3A 67 */
+	{ s_w, 2798 },                         /* 346: EVEX 0F 3A 71 */
+	{ s_w, 2800 },                         /* 347: EVEX 0F 3A 73 */
+	{ s_p, 2802 },                         /* 348: EVEX 0F 3A C2 */
+};
+
+/* mnemonics of variants, in order of the fields */
+const uint16_t ssde_x86_names::lists[] =
+{
+	/* 0: 60, P */
+	m_pushad, m_pusha, m_pushad, m_pushad,
+	/* 1: 61, P */
+	m_popad, m_popa, m_popad, m_popad,
+	/* 2: 63, X */
+	m_arpl, m_movsxd,
+	/* 3: 6D, P W */
+	m_insd, m_insd, m_insw, m_insd, m_insd, m_insd, m_insd, m_insd,
+	/* 4: 6F, P W */
+	m_outsd, m_outsd, m_outsw, m_outsd, m_outsd, m_outsd, m_outsd, m_outsd,
+	/* 5: 80, R */
+	m_add, m_or, m_adc, m_sbb, m_and, m_sub, m_xor, m_cmp,
+	/* 6: 90, P W */
+	m_nop, m_nop, m_nop, m_nop, m_pause, m_xchg, m_nop, m_nop,
+	/* 7: 98, P W */
+	m_cwde, m_cdqe, m_cbw, m_cdqe, m_cwde, m_cdqe, m_cwde, m_cdqe,
+	/* 8: 99, P W */
+	m_cdq, m_cqo, m_cwd, m_cqo, m_cdq, m_cqo, m_cdq, m_cqo,
+	/* 9: 9C, X P W */
+	m_pushfd, m_bad, m_pushf, m_bad, m_pushfd, m_bad, m_pushfd, m_bad, m_pushfq, m_pushfq, m_pushf,
+	m_pushfq, m_pushfq, m_pushfq, m_pushfq, m_pushfq,
+	/* 10: 9D, X P W */
+	m_popfd, m_bad, m_popf, m_bad, m_popfd, m_bad, m_popfd, m_bad, m_popfq, m_popfq, m_popf,
+	m_popfq, m_popfq, m_popfq, m_popfq, m_popfq,
+	/* 11: A0, X */
+	m_mov, m_movabs,
+	/* 12: A5, P W */
+	m_movsd, m_movsq, m_movsw, m_movsq, m_movsd, m_movsq, m_movsd, m_movsq,
+	/* 13: A7, P W */
+	m_cmpsd, m_cmpsq, m_cmpsw, m_cmpsq, m_cmpsd, m_cmpsq, m_cmpsd, m_cmpsq,
+	/* 14: AB, P W */
+	m_stosd, m_stosq, m_stosw, m_stosq, m_stosd, m_stosq, m_stosd, m_stosq,
+	/* 15: AD, P W */
+	m_lodsd, m_lodsq, m_lodsw, m_lodsq, m_lodsd, m_lodsq, m_lodsd, m_lodsq,
+	/* 16: AF, P W */
+	m_scasd, m_scasq, m_scasw, m_scasq, m_scasd, m_scasq, m_scasd, m_scasq,
+	/* 17: B8, W */
+	m_mov, m_movabs,
+	/* 18: C0, R */
+	m_rol, m_ror, m_rcl, m_rcr, m_shl, m_shr, m_bad, m_sar,
+	/* 19: C5, M */
+	m_lds, m_kmovw,
+	/* 20: C6, M R */
+	m_mov, m_nop, m_nop, m_nop, m_nop, m_nop, m_nop, m_nop, m_mov, m_nop, m_nop, m_nop, m_nop,
+	m_nop, m_nop, m_xabort,
+	/* 21: C7, M R */
+	m_mov, m_nop, m_nop, m_nop, m_nop, m_nop, m_nop, m_nop, m_mov, m_nop, m_nop, m_nop, m_nop,
+	m_nop, m_nop, m_xbegin,
+	/* 22: CA, W */
+	m_retf, m_retfq,
+	/* 23: CF, P W */
+	m_iretd, m_iretq, m_iret, m_iretq, m_iretd, m_iretq, m_iretd, m_iretq,
+	/* 24: D8, R */
+	m_fadd, m_fmul, m_fcom, m_fcomp, m_fsub, m_fsubr, m_fdiv, m_fdivr,
+	/* 25: D9, M R B */
+	m_fld, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_fst, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_fstp, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_fldenv, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_fldcw, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_fnstenv, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_fnstcw, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_fld, m_fld, m_fld, m_fld, m_fld, m_fld, m_fld, m_fld, m_fxch, m_fxch, m_fxch, m_fxch, m_fxch,
+	m_fxch, m_fxch, m_fxch, m_fnop, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_fchs, m_fabs, m_bad, m_bad, m_ftst, m_fxam, m_bad,
+	m_bad, m_fld1, m_fldl2t, m_fldl2e, m_fldpi, m_fldlg2, m_fldln2, m_fldz, m_bad, m_f2xm1,
+	m_fyl2x, m_fptan, m_fpatan, m_fxtract, m_fprem1, m_fdecstp, m_fincstp, m_fprem, m_fyl2xp1,
+	m_fsqrt, m_fsincos, m_frndint, m_fscale, m_fsin, m_fcos,
+	/* 26: DA, M R */
+	m_fiadd, m_fimul, m_ficom, m_ficomp, m_fisub, m_fisubr, m_fidiv, m_fidivr, m_fcmovb, m_fcmove,
+	m_fcmovbe, m_fcmovu, m_bad, m_fucompp, m_bad, m_bad,
+	/* 27: DB, M R B */
+	m_fild, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_fisttp, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_fist, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_fistp, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_fld, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_fstp, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_fcmovnb,
+	m_fcmovnb, m_fcmovnb, m_fcmovnb, m_fcmovnb, m_fcmovnb, m_fcmovnb, m_fcmovnb, m_fcmovne,
+	m_fcmovne, m_fcmovne, m_fcmovne, m_fcmovne, m_fcmovne, m_fcmovne, m_fcmovne, m_fcmovnbe,
+	m_fcmovnbe, m_fcmovnbe, m_fcmovnbe, m_fcmovnbe, m_fcmovnbe, m_fcmovnbe, m_fcmovnbe, m_fcmovnu,
+	m_fcmovnu, m_fcmovnu, m_fcmovnu, m_fcmovnu, m_fcmovnu, m_fcmovnu, m_fcmovnu, m_bad, m_bad,
+	m_fnclex, m_fninit, m_bad, m_bad, m_bad, m_bad, m_fucomi, m_fucomi, m_fucomi, m_fucomi,
+	m_fucomi, m_fucomi, m_fucomi, m_fucomi, m_fcomi, m_fcomi, m_fcomi, m_fcomi, m_fcomi, m_fcomi,
+	m_fcomi, m_fcomi, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	/* 28: DC, M R */
+	m_fadd, m_fmul, m_fcom, m_fcomp, m_fsub, m_fsubr, m_fdiv, m_fdivr, m_fadd, m_fmul, m_bad,
+	m_bad, m_fsubr, m_fsub, m_fdivr, m_fdiv,
+	/* 29: DD, M R */
+	m_fld, m_fisttp, m_fst, m_fstp, m_frstor, m_bad, m_fnsave, m_fnstsw, m_ffree, m_bad, m_fst,
+	m_fstp, m_fucom, m_fucomp, m_bad, m_bad,
+	/* 30: DE, M R */
+	m_fiadd, m_fimul, m_ficom, m_ficomp, m_fisub, m_fisubr, m_fidiv, m_fidivr, m_faddp, m_fmulp,
+	m_bad, m_fcompp, m_fsubrp, m_fsubp, m_fdivrp, m_fdivp,
+	/* 31: DF, M R */
+	m_fild, m_fisttp, m_fist, m_fistp, m_fbld, m_fild, m_fbstp, m_fistp, m_ffreep, m_bad, m_bad,
+	m_bad, m_fnstsw, m_fucomip, m_fcomip, m_bad,
+	/* 32: E3, X P W A */
+	m_jecxz, m_jcxz, m_bad, m_bad, m_jecxz, m_jcxz, m_bad, m_bad, m_jecxz, m_jcxz, m_bad, m_bad,
+	m_jecxz, m_jcxz, m_bad, m_bad, m_jrcxz, m_jecxz, m_jrcxz, m_jrcxz, m_jrcxz, m_jrcxz, m_jrcxz,
+	m_jrcxz, m_jrcxz, m_jecxz, m_jrcxz, m_jrcxz, m_jrcxz, m_jecxz, m_jrcxz, m_jrcxz,
+	/* 33: F6, R */
+	m_test, m_bad, m_not, m_neg, m_mul, m_imul, m_div, m_idiv,
+	/* 34: FE, R */
+	m_inc, m_dec, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	/* 35: FF, P W R */
+	m_inc, m_dec, m_call, m_call, m_jmp, m_jmp, m_push, m_bad, m_inc, m_dec, m_call, m_lcall,
+	m_jmp, m_ljmp, m_push, m_bad, m_inc, m_dec, m_call, m_lcall, m_jmp, m_ljmp, m_push, m_bad,
+	m_inc, m_dec, m_call, m_lcall, m_jmp, m_ljmp, m_push, m_bad, m_inc, m_dec, m_call, m_call,
+	m_jmp, m_jmp, m_push, m_bad, m_inc, m_dec, m_call, m_lcall, m_jmp, m_ljmp, m_push, m_bad,
+	m_inc, m_dec, m_call, m_call, m_jmp, m_jmp, m_push, m_bad, m_inc, m_dec, m_call, m_lcall,
+	m_jmp, m_ljmp, m_push, m_bad,
+	/* 36: 0F 00, R */
+	m_sldt, m_str, m_lldt, m_ltr, m_verr, m_verw, m_bad, m_bad,
+	/* 37: 0F 01, P M R B */
+	m_sgdt, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_sidt, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_lgdt, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_lidt, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_smsw, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_lmsw, m_bad, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_invlpg, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_enclv,
+	m_vmcall, m_vmlaunch, m_vmresume, m_vmxoff, m_pconfig, m_bad, m_bad, m_monitor, m_mwait,
+	m_clac, m_stac, m_bad, m_bad, m_bad, m_encls, m_xgetbv, m_xsetbv, m_bad, m_bad, m_vmfunc,
+	m_xend, m_xtest, m_enclu, m_vmrun, m_vmmcall, m_vmload, m_vmsave, m_stgi, m_clgi, m_skinit,
+	m_invlpga, m_smsw, m_smsw, m_smsw, m_smsw, m_smsw, m_smsw, m_smsw, m_smsw, m_serialize, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_rdpkru, m_wrpkru, m_lmsw, m_lmsw, m_lmsw, m_lmsw, m_lmsw, m_lmsw,
+	m_lmsw, m_lmsw, m_swapgs, m_rdtscp, m_monitorx, m_mwaitx, m_clzero, m_bad, m_invlpgb,
+	m_tlbsync, m_sgdt, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_sidt, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_lgdt, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_lidt, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_smsw, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_lmsw, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_invlpg, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_enclv, m_vmcall, m_vmlaunch, m_vmresume, m_vmxoff, m_pconfig, m_bad, m_bad, m_monitor,
+	m_mwait, m_clac, m_stac, m_tdcall, m_seamret, m_seamops, m_seamcall, m_xgetbv, m_xsetbv, m_bad,
+	m_bad, m_vmfunc, m_xend, m_xtest, m_enclu, m_vmrun, m_vmmcall, m_vmload, m_vmsave, m_stgi,
+	m_clgi, m_skinit, m_invlpga, m_smsw, m_smsw, m_smsw, m_smsw, m_smsw, m_smsw, m_smsw, m_smsw,
+	m_serialize, m_bad, m_bad, m_bad, m_bad, m_bad, m_rdpkru, m_wrpkru, m_lmsw, m_lmsw, m_lmsw,
+	m_lmsw, m_lmsw, m_lmsw, m_lmsw, m_lmsw, m_swapgs, m_rdtscp, m_monitorx, m_mwaitx, m_clzero,
+	m_bad, m_invlpgb, m_tlbsync, m_sgdt, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_sidt,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_lgdt, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_bad, m_lidt, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_smsw, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_rstorssp, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_lmsw, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_invlpg, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_enclv, m_vmcall, m_vmlaunch, m_vmresume, m_vmxoff, m_pconfig, m_bad,
+	m_bad, m_monitor, m_mwait, m_clac, m_stac, m_bad, m_bad, m_bad, m_encls, m_xgetbv, m_xsetbv,
+	m_bad, m_bad, m_vmfunc, m_xend, m_xtest, m_enclu, m_vmrun, m_vmmcall, m_vmload, m_vmsave,
+	m_stgi, m_clgi, m_skinit, m_invlpga, m_smsw, m_smsw, m_smsw, m_smsw, m_smsw, m_smsw, m_smsw,
+	m_smsw, m_setssbsy, m_bad, m_saveprevssp, m_bad, m_uiret, m_testui, m_clui, m_stui, m_lmsw,
+	m_lmsw, m_lmsw, m_lmsw, m_lmsw, m_lmsw, m_lmsw, m_lmsw, m_swapgs, m_rdtscp, m_monitorx,
+	m_mwaitx, m_clzero, m_bad, m_rmpadjust, m_psmash, m_sgdt, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_bad, m_sidt, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_lgdt, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_lidt, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_smsw, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_lmsw, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_invlpg, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_enclv, m_vmcall, m_vmlaunch, m_vmresume, m_vmxoff,
+	m_pconfig, m_bad, m_bad, m_monitor, m_mwait, m_clac, m_stac, m_bad, m_bad, m_bad, m_encls,
+	m_xgetbv, m_xsetbv, m_bad, m_bad, m_vmfunc, m_xend, m_xtest, m_enclu, m_vmrun, m_vmmcall,
+	m_vmload, m_vmsave, m_stgi, m_clgi, m_skinit, m_invlpga, m_smsw, m_smsw, m_smsw, m_smsw,
+	m_smsw, m_smsw, m_smsw, m_smsw, m_xsusldtrk, m_xresldtrk, m_bad, m_bad, m_bad, m_bad, m_rdpkru,
+	m_wrpkru, m_lmsw, m_lmsw, m_lmsw, m_lmsw, m_lmsw, m_lmsw, m_lmsw, m_lmsw, m_swapgs, m_rdtscp,
+	m_monitorx, m_mwaitx, m_clzero, m_bad, m_rmpupdate, m_pvalidate,
+	/* 38: 0F 07, W */
+	m_sysret, m_sysretq,
+	/* 39: 0F 09, P */
+	m_wbinvd, m_wbinvd, m_wbnoinvd, m_wbinvd,
+	/* 40: 0F 0D, R */
+	m_prefetch, m_prefetchw, m_prefetchwt1, m_bad, m_bad, m_bad, m_bad, m_bad,
+	/* 41: 0F 10, P */
+	m_movups, m_movupd, m_movss, m_movsd,
+	/* 42: 0F 12, P M */
+	m_movlps, m_movhlps, m_movlpd, m_movhlps, m_movsldup, m_movsldup, m_movddup, m_movddup,
+	/* 43: 0F 13, P */
+	m_movlps, m_movlpd, m_movlps, m_movlps,
+	/* 44: 0F 14, P */
+	m_unpcklps, m_unpcklpd, m_unpcklps, m_unpcklps,
+	/* 45: 0F 15, P */
+	m_unpckhps, m_unpckhpd, m_unpckhps, m_unpckhps,
+	/* 46: 0F 16, P M */
+	m_movhps, m_movlhps, m_movhpd, m_movlhps, m_movshdup, m_movshdup, m_movhps, m_movlhps,
+	/* 47: 0F 17, P */
+	m_movhps, m_movhpd, m_movhps, m_movhps,
+	/* 48: 0F 18, R */
+	m_prefetchnta, m_prefetcht0, m_prefetcht1, m_prefetcht2, m_bad, m_bad, m_bad, m_bad,
+	/* 49: 0F 1E, W R B */
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_rdsspd, m_rdsspd, m_rdsspd, m_rdsspd,
+	m_rdsspd, m_rdsspd, m_rdsspd, m_rdsspd, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_endbr64, m_endbr32, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_rdsspq, m_rdsspq,
+	m_rdsspq, m_rdsspq, m_rdsspq, m_rdsspq, m_rdsspq, m_rdsspq, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_endbr64,
+	m_endbr32, m_bad, m_bad, m_bad, m_bad,
+	/* 50: 0F 28, P */
+	m_movaps, m_movapd, m_movaps, m_movaps,
+	/* 51: 0F 2A, P */
+	m_cvtpi2ps, m_cvtpi2pd, m_cvtsi2ss, m_cvtsi2sd,
+	/* 52: 0F 2B, P */
+	m_movntps, m_movntpd, m_movntss, m_movntsd,
+	/* 53: 0F 2C, P */
+	m_cvttps2pi, m_cvttpd2pi, m_cvttss2si, m_cvttsd2si,
+	/* 54: 0F 2D, P */
+	m_cvtps2pi, m_cvtpd2pi, m_cvtss2si, m_cvtsd2si,
+	/* 55: 0F 2E, P */
+	m_ucomiss, m_ucomisd, m_ucomiss, m_ucomiss,
+	/* 56: 0F 2F, P */
+	m_comiss, m_comisd, m_comiss, m_comiss,
+	/* 57: 0F 35, W */
+	m_sysexit, m_sysexitq,
+	/* 58: 0F 50, P */
+	m_movmskps, m_movmskpd, m_movmskps, m_movmskps,
+	/* 59: 0F 51, P */
+	m_sqrtps, m_sqrtpd, m_sqrtss, m_sqrtsd,
+	/* 60: 0F 52, P */
+	m_rsqrtps, m_rsqrtps, m_rsqrtss, m_rsqrtps,
+	/* 61: 0F 53, P */
+	m_rcpps, m_rcpps, m_rcpss, m_rcpps,
+	/* 62: 0F 54, P */
+	m_andps, m_andpd, m_andps, m_andps,
+	/* 63: 0F 55, P */
+	m_andnps, m_andnpd, m_andnps, m_andnps,
+	/* 64: 0F 56, P */
+	m_orps, m_orpd, m_orps, m_orps,
+	/* 65: 0F 57, P */
+	m_xorps, m_xorpd, m_xorps, m_xorps,
+	/* 66: 0F 58, P */
+	m_addps, m_addpd, m_addss, m_addsd,
+	/* 67: 0F 59, P */
+	m_mulps, m_mulpd, m_mulss, m_mulsd,
+	/* 68: 0F 5A, P */
+	m_cvtps2pd, m_cvtpd2ps, m_cvtss2sd, m_cvtsd2ss,
+	/* 69: 0F 5B, P */
+	m_cvtdq2ps, m_cvtps2dq, m_cvttps2dq, m_cvtdq2ps,
+	/* 70: 0F 5C, P */
+	m_subps, m_subpd, m_subss, m_subsd,
+	/* 71: 0F 5D, P */
+	m_minps, m_minpd, m_minss, m_minsd,
+	/* 72: 0F 5E, P */
+	m_divps, m_divpd, m_divss, m_divsd,
+	/* 73: 0F 5F, P */
+	m_maxps, m_maxpd, m_maxss, m_maxsd,
+	/* 74: 0F 6E, P W */
+	m_movd, m_movq, m_movd, m_movq, m_bad, m_movd, m_bad, m_movd,
+	/* 75: 0F 6F, P */
+	m_movq, m_movdqa, m_movdqu, m_movq,
+	/* 76: 0F 70, P */
+	m_pshufw, m_pshufd, m_pshufhw, m_pshuflw,
+	/* 77: 0F 71, R */
+	m_bad, m_bad, m_psrlw, m_bad, m_psraw, m_bad, m_psllw, m_bad,
+	/* 78: 0F 72, R */
+	m_bad, m_bad, m_psrld, m_bad, m_psrad, m_bad, m_pslld, m_bad,
+	/* 79: 0F 73, R */
+	m_bad, m_bad, m_psrlq, m_psrldq, m_bad, m_bad, m_psllq, m_pslldq,
+	/* 80: 0F 78, P M */
+	m_vmread, m_vmread, m_vmread, m_extrq, m_vmread, m_vmread, m_vmread, m_insertq,
+	/* 81: 0F 79, P M */
+	m_vmwrite, m_vmwrite, m_vmwrite, m_extrq, m_vmwrite, m_vmwrite, m_vmwrite, m_insertq,
+	/* 82: 0F 7C, P */
+	m_bad, m_haddpd, m_bad, m_haddps,
+	/* 83: 0F 7D, P */
+	m_bad, m_hsubpd, m_bad, m_hsubps,
+	/* 84: 0F 7E, P W */
+	m_movd, m_movq, m_movd, m_movq, m_movq, m_movq, m_bad, m_movd,
+	/* 85: 0F A6, R */
+	m_montmul, m_xsha1, m_xsha256, m_bad, m_bad, m_bad, m_bad, m_bad,
+	/* 86: 0F A7, R */
+	m_xstorerng, m_xcryptecb, m_xcryptcbc, m_xcryptctr, m_xcryptcfb, m_xcryptofb, m_bad, m_bad,
+	/* 87: 0F AE, P W M R */
+	m_fxsave, m_fxrstor, m_ldmxcsr, m_stmxcsr, m_xsave, m_xrstor, m_xsaveopt, m_clflush, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_lfence, m_mfence, m_sfence, m_fxsave64, m_fxrstor64, m_ldmxcsr,
+	m_stmxcsr, m_xsave64, m_xrstor64, m_xsaveopt64, m_clflush, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_lfence, m_mfence, m_sfence, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_clwb, m_clflushopt,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_tpause, m_bad, m_fxsave, m_fxrstor, m_ldmxcsr,
+	m_stmxcsr, m_xsave, m_xrstor, m_clwb, m_clflushopt, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_lfence, m_tpause, m_sfence, m_bad, m_bad, m_bad, m_bad, m_ptwrite, m_bad, m_clrssbsy, m_bad,
+	m_rdfsbase, m_rdgsbase, m_wrfsbase, m_wrgsbase, m_ptwrite, m_incsspd, m_umonitor, m_bad,
+	m_fxsave, m_fxrstor, m_ldmxcsr, m_stmxcsr, m_ptwrite, m_xrstor, m_clrssbsy, m_clflush,
+	m_rdfsbase, m_rdgsbase, m_wrfsbase, m_wrgsbase, m_ptwrite, m_incsspq, m_umonitor, m_sfence,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_umwait, m_bad, m_fxsave, m_fxrstor, m_ldmxcsr, m_stmxcsr, m_xsave, m_xrstor,
+	m_xsaveopt, m_clflush, m_bad, m_bad, m_bad, m_bad, m_bad, m_lfence, m_umwait, m_sfence,
+	/* 88: 0F BA, R */
+	m_bad, m_bad, m_bad, m_bad, m_bt, m_bts, m_btr, m_btc,
+	/* 89: 0F BC, P */
+	m_bsf, m_bsf, m_tzcnt, m_bsf,
+	/* 90: 0F BD, P */
+	m_bsr, m_bsr, m_lzcnt, m_bsr,
+	/* 91: 0F C2, P */
+	m_cmpps, m_cmppd, m_cmpss, m_cmpsd,
+	/* 92: 0F C6, P */
+	m_shufps, m_shufpd, m_shufps, m_shufps,
+	/* 93: 0F C7, P W M R */
+	m_bad, m_cmpxchg8b, m_bad, m_xrstors, m_xsavec, m_xsaves, m_vmptrld, m_vmptrst, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_rdrand, m_rdseed, m_bad, m_cmpxchg16b, m_bad, m_xrstors64,
+	m_xsavec64, m_xsaves64, m_vmptrld, m_vmptrst, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_rdrand, m_rdseed, m_bad, m_cmpxchg8b, m_bad, m_bad, m_bad, m_bad, m_vmclear, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_rdrand, m_rdseed, m_bad, m_cmpxchg16b, m_bad, m_xrstors,
+	m_xsavec, m_xsaves, m_vmclear, m_vmptrst, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_rdrand,
+	m_rdseed, m_bad, m_cmpxchg8b, m_bad, m_bad, m_bad, m_bad, m_vmxon, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_senduipi, m_rdpid, m_bad, m_cmpxchg16b, m_bad, m_xrstors, m_xsavec,
+	m_xsaves, m_vmxon, m_vmptrst, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_senduipi, m_rdpid,
+	m_bad, m_cmpxchg8b, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad,
+	m_bad, m_bad, m_bad, m_bad, m_bad, m_cmpxchg16b, m_bad, m_xrstors, m_xsavec, m_xsaves,
+	m_vmptrld, m_vmptrst, m_bad, m_bad, m_bad, m_bad, m_bad, m_bad, m_rdrand, m_rdseed,
+	/* 94: 0F D0, P */
+	m_bad, m_addsubpd, m_bad, m_addsubps,
+	/* 95: 0F D6, P */
+	m_bad, m_movq, m_movq2dq, m_movdq2q,
+	/* 96: 0F E6, P */
+	m_bad, m_cvttpd2dq, m_cvtdq2pd, m_cvtpd2dq,
+	/* 97: 0F E7, P */
+	m_movntq, m_movntdq, m_movntq, m_movntq,
+	/* 98: 0F F7, P */
+	m_maskmovq, m_maskmovdqu, m_maskmovq, m_maskmovq,
+	/* 99: 0F 38 D8, R */
+	m_aesencwide128kl, m_aesdecwide128kl, m_aesencwide256kl, m_aesdecwide256kl, m_bad, m_bad,
+	m_bad, m_bad,
+	/* 100: 0F 38 DC, P M */
+	m_bad, m_bad, m_aesenc, m_aesenc, m_aesenc128kl, m_loadiwkey, m_bad, m_bad,
+	/* 101: 0F 38 DD, P */
+	m_bad, m_aesenclast, m_aesdec128kl, m_bad,
+	/* 102: 0F 38 DE, P */
+	m_bad, m_aesdec, m_aesenc256kl, m_bad,
+	/* 103: 0F 38 DF, P */
+	m_bad, m_aesdeclast, m_aesdec256kl, m_bad,
+	/* 104: 0F 38 F0, P */
+	m_movbe, m_movbe, m_movbe, m_crc32,
+	/* 105: 0F 38 F5, W */
+	m_wrussd, m_wrussq,
+	/* 106: 0F 38 F6, P W */
+	m_wrssd, m_wrssq, m_adcx, m_adcx, m_adox, m_adox, m_bad, m_wrssd,
+	/* 107: 0F 38 F8, P */
+	m_bad, m_movdir64b, m_enqcmds, m_enqcmd,
+	/* 108: 0F 3A 16, W */
+	m_pextrd, m_pextrq,
+	/* 109: 0F 3A 22, W */
+	m_pinsrd, m_pinsrq,
+	/* 110: VEX 0F 10, P */
+	m_vmovups, m_vmovupd, m_vmovss, m_vmovsd,
+	/* 111: VEX 0F 12, P M */
+	m_vmovlps, m_vmovhlps, m_vmovlpd, m_bad, m_vmovsldup, m_vmovsldup, m_vmovddup, m_vmovddup,
+	/* 112: VEX 0F 13, P */
+	m_vmovlps, m_vmovlpd, m_bad, m_bad,
+	/* 113: VEX 0F 14, P */
+	m_vunpcklps, m_vunpcklpd, m_bad, m_bad,
+	/* 114: VEX 0F 15, P */
+	m_vunpckhps, m_vunpckhpd, m_bad, m_bad,
+	/* 115: VEX 0F 16, P M */
+	m_vmovhps, m_vmovlhps, m_vmovhpd, m_bad, m_vmovshdup, m_vmovshdup, m_bad, m_bad,
+	/* 116: VEX 0F 17, P */
+	m_vmovhps, m_vmovhpd, m_bad, m_bad,
+	/* 117: VEX 0F 28, P */
+	m_vmovaps, m_vmovapd, m_bad, m_bad,
+	/* 118: VEX 0F 2A, P */
+	m_bad, m_bad, m_vcvtsi2ss, m_vcvtsi2sd,
+	/* 119: VEX 0F 2B, P */
+	m_vmovntps, m_vmovntpd, m_bad, m_bad,
+	/* 120: VEX 0F 2C, P */
+	m_bad, m_bad, m_vcvttss2si, m_vcvttsd2si,
+	/* 121: VEX 0F 2D, P */
+	m_bad, m_bad, m_vcvtss2si, m_vcvtsd2si,
+	/* 122: VEX 0F 2E, P */
+	m_vucomiss, m_vucomisd, m_bad, m_bad,
+	/* 123: VEX 0F 2F, P */
+	m_vcomiss, m_vcomisd, m_bad, m_bad,
+	/* 124: VEX 0F 41, P W */
+	m_kandw, m_kandq, m_kandb, m_kandd, m_bad, m_bad, m_bad, m_bad,
+	/* 125: VEX 0F 42, P W */
+	m_kandnw, m_kandnq, m_kandnb, m_kandnd, m_bad, m_bad, m_bad, m_bad,
+	/* 126: VEX 0F 44, P W */
+	m_knotw, m_knotq, m_knotb, m_knotd, m_bad, m_bad, m_bad, m_bad,
+	/* 127: VEX 0F 45, P W */
+	m_korw, m_korq, m_korb, m_kord, m_bad, m_bad, m_bad, m_bad,
+	/* 128: VEX 0F 46, P W */
+	m_kxnorw, m_kxnorq, m_kxnorb, m_kxnord, m_bad, m_bad, m_bad, m_bad,
+	/* 129: VEX 0F 47, P W */
+	m_kxorw, m_kxorq, m_kxorb, m_kxord, m_bad, m_bad, m_bad, m_bad,
+	/* 130: VEX 0F 4A, P W */
+	m_kaddw, m_kaddq, m_kaddb, m_kaddd, m_bad, m_bad, m_bad, m_bad,
+	/* 131: VEX 0F 4B, P W */
+	m_kunpckwd, m_kunpckdq, m_kunpckbw, m_bad, m_bad, m_bad, m_bad, m_bad,
+	/* 132: VEX 0F 50, P */
+	m_vmovmskps, m_vmovmskpd, m_bad, m_bad,
+	/* 133: VEX 0F 51, P */
+	m_vsqrtps, m_vsqrtpd, m_vsqrtss, m_vsqrtsd,
+	/* 134: VEX 0F 52, P */
+	m_vrsqrtps, m_bad, m_vrsqrtss, m_bad,
+	/* 135: VEX 0F 53, P */
+	m_vrcpps, m_bad, m_vrcpss, m_bad,
+	/* 136: VEX 0F 54, P */
+	m_vandps, m_vandpd, m_bad, m_bad,
+	/* 137: VEX 0F 55, P */
+	m_vandnps, m_vandnpd, m_bad, m_bad,
+	/* 138: VEX 0F 56, P */
+	m_vorps, m_vorpd, m_bad, m_bad,
+	/* 139: VEX 0F 57, P */
+	m_vxorps, m_vxorpd, m_bad, m_bad,
+	/* 140: VEX 0F 58, P */
+	m_vaddps, m_vaddpd, m_vaddss, m_vaddsd,
+	/* 141: VEX 0F 59, P */
+	m_vmulps, m_vmulpd, m_vmulss, m_vmulsd,
+	/* 142: VEX 0F 5A, P */
+	m_vcvtps2pd, m_vcvtpd2ps, m_vcvtss2sd, m_vcvtsd2ss,
+	/* 143: VEX 0F 5B, P */
+	m_vcvtdq2ps, m_vcvtps2dq, m_vcvttps2dq, m_bad,
+	/* 144: VEX 0F 5C, P */
+	m_vsubps, m_vsubpd, m_vsubss, m_vsubsd,
+	/* 145: VEX 0F 5D, P */
+	m_vminps, m_vminpd, m_vminss, m_vminsd,
+	/* 146: VEX 0F 5E, P */
+	m_vdivps, m_vdivpd, m_vdivss, m_vdivsd,
+	/* 147: VEX 0F 5F, P */
+	m_vmaxps, m_vmaxpd, m_vmaxss, m_vmaxsd,
+	/* 148: VEX 0F 6E, W */
+	m_vmovd, m_vmovq,
+	/* 149: VEX 0F 6F, P */
+	m_bad, m_vmovdqa, m_vmovdqu, m_bad,
+	/* 150: VEX 0F 70, P */
+	m_bad, m_vpshufd, m_vpshufhw, m_vpshuflw,
+	/* 151: VEX 0F 71, R */
+	m_bad, m_bad, m_vpsrlw, m_bad, m_vpsraw, m_bad, m_vpsllw, m_bad,
+	/* 152: VEX 0F 72, R */
+	m_bad, m_bad, m_vpsrld, m_bad, m_vpsrad, m_bad, m_vpslld, m_bad,
+	/* 153: VEX 0F 73, R */
+	m_bad, m_bad, m_vpsrlq, m_vpsrldq, m_bad, m_bad, m_vpsllq, m_vpslldq,
+	/* 154: VEX 0F 77, L */
+	m_vzeroupper, m_vzeroall, m_bad, m_bad,
+	/* 155: VEX 0F 7C, P */
+	m_bad, m_vhaddpd, m_bad, m_vhaddps,
+	/* 156: VEX 0F 7D, P */
+	m_bad, m_vhsubpd, m_bad, m_vhsubps,
+	/* 157: VEX 0F 7E, P W */
+	m_bad, m_bad, m_vmovd, m_vmovq, m_vmovq, m_vmovq, m_bad, m_bad,
+	/* 158: VEX 0F 90, P W */
+	m_kmovw, m_kmovq, m_kmovb, m_kmovd, m_bad, m_bad, m_bad, m_bad,
+	/* 159: VEX 0F 92, P W */
+	m_kmovw, m_bad, m_kmovb, m_bad, m_bad, m_bad, m_kmovd, m_kmovq,
+	/* 160: VEX 0F 98, P W */
+	m_kortestw, m_kortestq, m_kortestb, m_kortestd, m_bad, m_bad, m_bad, m_bad,
+	/* 161: VEX 0F 99, P W */
+	m_ktestw, m_ktestq, m_ktestb, m_ktestd, m_bad, m_bad, m_bad, m_bad,
+	/* 162: VEX 0F AE, R */
+	m_bad, m_bad, m_vldmxcsr, m_vstmxcsr, m_bad, m_bad, m_bad, m_bad,
+	/* 163: VEX 0F C2, P */
+	m_vcmpps, m_vcmppd, m_vcmpss, m_vcmpsd,
+	/* 164: VEX 0F C6, P */
+	m_vshufps, m_vshufpd, m_bad, m_bad,
+	/* 165: VEX 0F D0, P */
+	m_bad, m_vaddsubpd, m_bad, m_vaddsubps,
+	/* 166: VEX 0F E6, P */
+	m_bad, m_vcvttpd2dq, m_vcvtdq2pd, m_vcvtpd2dq,
+	/* 167: VEX 0F 38 45, W */
+	m_vpsrlvd, m_vpsrlvq,
+	/* 168: VEX 0F 38 47, W */
+	m_vpsllvd, m_vpsllvq,
+	/* 169: VEX 0F 38 49, P M */
+	m_ldtilecfg, m_tilerelease, m_sttilecfg, m_bad, m_bad, m_bad, m_bad, m_tilezero,
+	/* 170: VEX 0F 38 4B, P */
+	m_bad, m_tileloaddt1, m_tilestored, m_tileloadd,
+	/* 171: VEX 0F 38 5E, P */
+	m_tdpbuud, m_tdpbusd, m_tdpbsud, m_tdpbssd,
+	/* 172: VEX 0F 38 8C, W */
+	m_vpmaskmovd, m_vpmaskmovq,
+	/* 173: VEX 0F 38 90, W */
+	m_vpgatherdd, m_vpgatherdq,
+	/* 174: VEX 0F 38 91, W */
+	m_vpgatherqd, m_vpgatherqq,
+	/* 175: VEX 0F 38 92, W */
+	m_vgatherdps, m_vgatherdpd,
+	/* 176: VEX 0F 38 93, W */
+	m_vgatherqps, m_vgatherqpd,
+	/* 177: VEX 0F 38 96, W */
+	m_vfmaddsub132ps, m_vfmaddsub132pd,
+	/* 178: VEX 0F 38 97, W */
+	m_vfmsubadd132ps, m_vfmsubadd132pd,
+	/* 179: VEX 0F 38 98, W */
+	m_vfmadd132ps, m_vfmadd132pd,
+	/* 180: VEX 0F 38 99, W */
+	m_vfmadd132ss, m_vfmadd132sd,
+	/* 181: VEX 0F 38 9A, W */
+	m_vfmsub132ps, m_vfmsub132pd,
+	/* 182: VEX 0F 38 9B, W */
+	m_vfmsub132ss, m_vfmsub132sd,
+	/* 183: VEX 0F 38 9C, W */
+	m_vfnmadd132ps, m_vfnmadd132pd,
+	/* 184: VEX 0F 38 9D, W */
+	m_vfnmadd132ss, m_vfnmadd132sd,
+	/* 185: VEX 0F 38 9E, W */
+	m_vfnmsub132ps, m_vfnmsub132pd,
+	/* 186: VEX 0F 38 9F, W */
+	m_vfnmsub132ss, m_vfnmsub132sd,
+	/* 187: VEX 0F 38 A6, W */
+	m_vfmaddsub213ps, m_vfmaddsub213pd,
+	/* 188: VEX 0F 38 A7, W */
+	m_vfmsubadd213ps, m_vfmsubadd213pd,
+	/* 189: VEX 0F 38 A8, W */
+	m_vfmadd213ps, m_vfmadd213pd,
+	/* 190: VEX 0F 38 A9, W */
+	m_vfmadd213ss, m_vfmadd213sd,
+	/* 191: VEX 0F 38 AA, W */
+	m_vfmsub213ps, m_vfmsub213pd,
+	/* 192: VEX 0F 38 AB, W */
+	m_vfmsub213ss, m_vfmsub213sd,
+	/* 193: VEX 0F 38 AC, W */
+	m_vfnmadd213ps, m_vfnmadd213pd,
+	/* 194: VEX 0F 38 AD, W */
+	m_vfnmadd213ss, m_vfnmadd213sd,
+	/* 195: VEX 0F 38 AE, W */
+	m_vfnmsub213ps, m_vfnmsub213pd,
+	/* 196: VEX 0F 38 AF, W */
+	m_vfnmsub213ss, m_vfnmsub213sd,
+	/* 197: VEX 0F 38 B6, W */
+	m_vfmaddsub231ps, m_vfmaddsub231pd,
+	/* 198: VEX 0F 38 B7, W */
+	m_vfmsubadd231ps, m_vfmsubadd231pd,
+	/* 199: VEX 0F 38 B8, W */
+	m_vfmadd231ps, m_vfmadd231pd,
+	/* 200: VEX 0F 38 B9, W */
+	m_vfmadd231ss, m_vfmadd231sd,
+	/* 201: VEX 0F 38 BA, W */
+	m_vfmsub231ps, m_vfmsub231pd,
+	/* 202: VEX 0F 38 BB, W */
+	m_vfmsub231ss, m_vfmsub231sd,
+	/* 203: VEX 0F 38 BC, W */
+	m_vfnmadd231ps, m_vfnmadd231pd,
+	/* 204: VEX 0F 38 BD, W */
+	m_vfnmadd231ss, m_vfnmadd231sd,
+	/* 205: VEX 0F 38 BE, W */
+	m_vfnmsub231ps, m_vfnmsub231pd,
+	/* 206: VEX 0F 38 BF, W */
+	m_vfnmsub231ss, m_vfnmsub231sd,
+	/* 207: VEX 0F 38 F3, R */
+	m_bad, m_blsr, m_blsmsk, m_blsi, m_bad, m_bad, m_bad, m_bad,
+	/* 208: VEX 0F 38 F5, P */
+	m_bzhi, m_bad, m_pext, m_pdep,
+	/* 209: VEX 0F 38 F7, P */
+	m_bextr, m_shlx, m_sarx, m_shrx,
+	/* 210: VEX 0F 3A 16, W */
+	m_vpextrd, m_vpextrq,
+	/* 211: VEX 0F 3A 22, W */
+	m_vpinsrd, m_vpinsrq,
+	/* 212: VEX 0F 3A 30, W */
+	m_kshiftrb, m_kshiftrw,
+	/* 213: VEX 0F 3A 31, W */
+	m_kshiftrd, m_kshiftrq,
+	/* 214: VEX 0F 3A 32, W */
+	m_kshiftlb, m_kshiftlw,
+	/* 215: VEX 0F 3A 33, W */
+	m_kshiftld, m_kshiftlq,
+	/* 216: EVEX 0F 5B, P W */
+	m_vcvtdq2ps, m_vcvtqq2ps, m_vcvtps2dq, m_bad, m_vcvttps2dq, m_bad, m_bad, m_bad,
+	/* 217: EVEX 0F 6F, P W */
+	m_bad, m_bad, m_vmovdqa32, m_vmovdqa64, m_vmovdqu32, m_vmovdqu64, m_vmovdqu8, m_vmovdqu16,
+	/* 218: EVEX 0F 72, W R */
+	m_vprord, m_vprold, m_vpsrld, m_bad, m_vpsrad, m_bad, m_vpslld, m_bad, m_vprorq, m_vprolq,
+	m_bad, m_bad, m_vpsraq, m_bad, m_bad, m_bad,
+	/* 219: EVEX 0F 78, P W */
+	m_vcvttps2udq, m_vcvttpd2udq, m_vcvttps2uqq, m_vcvttpd2uqq, m_vcvttss2usi, m_vcvttss2usi,
+	m_vcvttsd2usi, m_vcvttsd2usi,
+	/* 220: EVEX 0F 79, P W */
+	m_vcvtps2udq, m_vcvtpd2udq, m_vcvtps2uqq, m_vcvtpd2uqq, m_vcvtss2usi, m_vcvtss2usi,
+	m_vcvtsd2usi, m_vcvtsd2usi,
+	/* 221: EVEX 0F 7A, P W */
+	m_bad, m_bad, m_vcvttps2qq, m_vcvttpd2qq, m_vcvtudq2pd, m_vcvtuqq2pd, m_vcvtudq2ps,
+	m_vcvtuqq2ps,
+	/* 222: EVEX 0F 7B, P W */
+	m_bad, m_bad, m_vcvtps2qq, m_vcvtpd2qq, m_vcvtusi2ss, m_vcvtusi2ss, m_vcvtusi2sd, m_vcvtusi2sd,
+	/* 223: EVEX 0F DB, W */
+	m_vpandd, m_vpandq,
+	/* 224: EVEX 0F DF, W */
+	m_vpandnd, m_vpandnq,
+	/* 225: EVEX 0F E2, W */
+	m_vpsrad, m_vpsraq,
+	/* 226: EVEX 0F E6, P W */
+	m_bad, m_bad, m_bad, m_vcvttpd2dq, m_vcvtdq2pd, m_vcvtqq2pd, m_bad, m_vcvtpd2dq,
+	/* 227: EVEX 0F EB, W */
+	m_vpord, m_vporq,
+	/* 228: EVEX 0F EF, W */
+	m_vpxord, m_vpxorq,
+	/* 229: EVEX 0F 38 10, P */
+	m_bad, m_vpsrlvw, m_vpmovuswb, m_bad,
+	/* 230: EVEX 0F 38 11, P */
+	m_bad, m_vpsravw, m_vpmovusdb, m_bad,
+	/* 231: EVEX 0F 38 12, P */
+	m_bad, m_vpsllvw, m_vpmovusqb, m_bad,
+	/* 232: EVEX 0F 38 13, P */
+	m_bad, m_vcvtph2ps, m_vpmovusdw, m_bad,
+	/* 233: EVEX 0F 38 14, P W */
+	m_bad, m_bad, m_vprorvd, m_vprorvq, m_vpmovusqw, m_bad, m_bad, m_bad,
+	/* 234: EVEX 0F 38 15, P W */
+	m_bad, m_bad, m_vprolvd, m_vprolvq, m_vpmovusqd, m_bad, m_bad, m_bad,
+	/* 235: EVEX 0F 38 16, W */
+	m_vpermps, m_vpermpd,
+	/* 236: EVEX 0F 38 19, W */
+	m_vbroadcastf32x2, m_vbroadcastsd,
+	/* 237: EVEX 0F 38 1A, W */
+	m_vbroadcastf32x4, m_vbroadcastf64x2,
+	/* 238: EVEX 0F 38 1B, W */
+	m_vbroadcastf32x8, m_vbroadcastf64x4,
+	/* 239: EVEX 0F 38 20, P */
+	m_bad, m_vpmovsxbw, m_vpmovswb, m_bad,
+	/* 240: EVEX 0F 38 21, P */
+	m_bad, m_vpmovsxbd, m_vpmovsdb, m_bad,
+	/* 241: EVEX 0F 38 22, P */
+	m_bad, m_vpmovsxbq, m_vpmovsqb, m_bad,
+	/* 242: EVEX 0F 38 23, P */
+	m_bad, m_vpmovsxwd, m_vpmovsdw, m_bad,
+	/* 243: EVEX 0F 38 24, P */
+	m_bad, m_vpmovsxwq, m_vpmovsqw, m_bad,
+	/* 244: EVEX 0F 38 25, P */
+	m_bad, m_vpmovsxdq, m_vpmovsqd, m_bad,
+	/* 245: EVEX 0F 38 26, P W */
+	m_bad, m_bad, m_vptestmb, m_vptestmw, m_vptestnmb, m_vptestnmw, m_bad, m_bad,
+	/* 246: EVEX 0F 38 27, P W */
+	m_bad, m_bad, m_vptestmd, m_vptestmq, m_vptestnmd, m_vptestnmq, m_bad, m_bad,
+	/* 247: EVEX 0F 38 28, P W */
+	m_bad, m_bad, m_bad, m_vpmuldq, m_vpmovm2b, m_vpmovm2w, m_bad, m_bad,
+	/* 248: EVEX 0F 38 29, P W */
+	m_bad, m_bad, m_bad, m_vpcmpeqq, m_vpmovb2m, m_vpmovw2m, m_bad, m_bad,
+	/* 249: EVEX 0F 38 2A, P */
+	m_bad, m_vmovntdqa, m_vpbroadcastmb2q, m_bad,
+	/* 250: EVEX 0F 38 2C, W */
+	m_vscalefps, m_vscalefpd,
+	/* 251: EVEX 0F 38 2D, W */
+	m_vscalefss, m_vscalefsd,
+	/* 252: EVEX 0F 38 30, P */
+	m_bad, m_vpmovzxbw, m_vpmovwb, m_bad,
+	/* 253: EVEX 0F 38 31, P */
+	m_bad, m_vpmovzxbd, m_vpmovdb, m_bad,
+	/* 254: EVEX 0F 38 32, P */
+	m_bad, m_vpmovzxbq, m_vpmovqb, m_bad,
+	/* 255: EVEX 0F 38 33, P */
+	m_bad, m_vpmovzxwd, m_vpmovdw, m_bad,
+	/* 256: EVEX 0F 38 34, P */
+	m_bad, m_vpmovzxwq, m_vpmovqw, m_bad,
+	/* 257: EVEX 0F 38 35, P */
+	m_bad, m_vpmovzxdq, m_vpmovqd, m_bad,
+	/* 258: EVEX 0F 38 36, W */
+	m_vpermd, m_vpermq,
+	/* 259: EVEX 0F 38 38, P W */
+	m_bad, m_bad, m_vpminsb, m_vpminsb, m_vpmovm2d, m_vpmovm2q, m_bad, m_bad,
+	/* 260: EVEX 0F 38 39, P W */
+	m_bad, m_bad, m_vpminsd, m_vpminsq, m_vpmovd2m, m_vpmovq2m, m_bad, m_bad,
+	/* 261: EVEX 0F 38 3A, P */
+	m_bad, m_vpminuw, m_vpbroadcastmw2d, m_bad,
+	/* 262: EVEX 0F 38 3B, W */
+	m_vpminud, m_vpminuq,
+	/* 263: EVEX 0F 38 3D, W */
+	m_vpmaxsd, m_vpmaxsq,
+	/* 264: EVEX 0F 38 3F, W */
+	m_vpmaxud, m_vpmaxuq,
+	/* 265: EVEX 0F 38 40, W */
+	m_vpmulld, m_vpmullq,
+	/* 266: EVEX 0F 38 42, W */
+	m_vgetexpps, m_vgetexppd,
+	/* 267: EVEX 0F 38 43, W */
+	m_vgetexpss, m_vgetexpsd,
+	/* 268: EVEX 0F 38 44, W */
+	m_vplzcntd, m_vplzcntq,
+	/* 269: EVEX 0F 38 46, W */
+	m_vpsravd, m_vpsravq,
+	/* 270: EVEX 0F 38 4C, W */
+	m_vrcp14ps, m_vrcp14pd,
+	/* 271: EVEX 0F 38 4D, W */
+	m_vrcp14ss, m_vrcp14sd,
+	/* 272: EVEX 0F 38 4E, W */
+	m_vrsqrt14ps, m_vrsqrt14pd,
+	/* 273: EVEX 0F 38 4F, W */
+	m_vrsqrt14ss, m_vrsqrt14sd,
+	/* 274: EVEX 0F 38 52, P */
+	m_bad, m_vpdpwssd, m_vdpbf16ps, m_vp4dpwssd,
+	/* 275: EVEX 0F 38 53, P */
+	m_bad, m_vpdpwssds, m_bad, m_vp4dpwssds,
+	/* 276: EVEX 0F 38 54, W */
+	m_vpopcntb, m_vpopcntw,
+	/* 277: EVEX 0F 38 55, W */
+	m_vpopcntd, m_vpopcntq,
+	/* 278: EVEX 0F 38 59, W */
+	m_vbroadcasti32x2, m_vpbroadcastq,
+	/* 279: EVEX 0F 38 5A, W */
+	m_vbroadcasti32x4, m_vbroadcasti64x2,
+	/* 280: EVEX 0F 38 5B, W */
+	m_vbroadcasti32x8, m_vbroadcasti64x4,
+	/* 281: EVEX 0F 38 62, W */
+	m_vpexpandb, m_vpexpandw,
+	/* 282: EVEX 0F 38 63, W */
+	m_vpcompressb, m_vpcompressw,
+	/* 283: EVEX 0F 38 64, W */
+	m_vpblendmd, m_vpblendmq,
+	/* 284: EVEX 0F 38 65, W */
+	m_vblendmps, m_vblendmpd,
+	/* 285: EVEX 0F 38 66, W */
+	m_vpblendmb, m_vpblendmw,
+	/* 286: EVEX 0F 38 68, W */
+	m_vp2intersectd, m_vp2intersectq,
+	/* 287: EVEX 0F 38 71, W */
+	m_vpshldvd, m_vpshldvq,
+	/* 288: EVEX 0F 38 72, P */
+	m_bad, m_vpshrdvw, m_vcvtneps2bf16, m_vcvtne2ps2bf16,
+	/* 289: EVEX 0F 38 73, W */
+	m_vpshrdvd, m_vpshrdvq,
+	/* 290: EVEX 0F 38 75, W */
+	m_vpermi2b, m_vpermi2w,
+	/* 291: EVEX 0F 38 76, W */
+	m_vpermi2d, m_vpermi2q,
+	/* 292: EVEX 0F 38 77, W */
+	m_vpermi2ps, m_vpermi2pd,
+	/* 293: EVEX 0F 38 7C, W */
+	m_vpbroadcastd, m_vpbroadcastq,
+	/* 294: EVEX 0F 38 7D, W */
+	m_vpermt2b, m_vpermt2w,
+	/* 295: EVEX 0F 38 7E, W */
+	m_vpermt2d, m_vpermt2q,
+	/* 296: EVEX 0F 38 7F, W */
+	m_vpermt2ps, m_vpermt2pd,
+	/* 297: EVEX 0F 38 88, W */
+	m_vexpandps, m_vexpandpd,
+	/* 298: EVEX 0F 38 89, W */
+	m_vpexpandd, m_vpexpandq,
+	/* 299: EVEX 0F 38 8A, W */
+	m_vcompressps, m_vcompresspd,
+	/* 300: EVEX 0F 38 8B, W */
+	m_vpcompressd, m_vpcompressq,
+	/* 301: EVEX 0F 38 8D, W */
+	m_vpermb, m_vpermw,
+	/* 302: EVEX 0F 38 9A, P W */
+	m_bad, m_bad, m_vfmsub132ps, m_vfmsub132pd, m_bad, m_bad, m_v4fmaddps, m_bad,
+	/* 303: EVEX 0F 38 9B, P W */
+	m_bad, m_bad, m_vfmsub132ss, m_vfmsub132sd, m_bad, m_bad, m_v4fmaddss, m_bad,
+	/* 304: EVEX 0F 38 A0, W */
+	m_vpscatterdd, m_vpscatterdq,
+	/* 305: EVEX 0F 38 A1, W */
+	m_vpscatterqd, m_vpscatterqq,
+	/* 306: EVEX 0F 38 A2, W */
+	m_vscatterdps, m_vscatterdpd,
+	/* 307: EVEX 0F 38 A3, W */
+	m_vscatterqps, m_vscatterqpd,
+	/* 308: EVEX 0F 38 AA, P W */
+	m_bad, m_bad, m_vfmsub213ps, m_vfmsub213pd, m_bad, m_bad, m_v4fnmaddps, m_bad,
+	/* 309: EVEX 0F 38 AB, P W */
+	m_bad, m_bad, m_vfmsub213ss, m_vfmsub213sd, m_bad, m_bad, m_v4fnmaddss, m_bad,
+	/* 310: EVEX 0F 38 C4, W */
+	m_vpconflictd, m_vpconflictq,
+	/* 311: EVEX 0F 38 C6, W R */
+	m_bad, m_vgatherpf0dps, m_vgatherpf1dps, m_bad, m_bad, m_vscatterpf0dps, m_vscatterpf1dps,
+	m_bad, m_bad, m_vgatherpf0dpd, m_vgatherpf1dpd, m_bad, m_bad, m_vscatterpf0dpd,
+	m_vscatterpf1dpd, m_bad,
+	/* 312: EVEX 0F 38 C7, W R */
+	m_bad, m_vgatherpf0qps, m_vgatherpf1qps, m_bad, m_bad, m_vscatterpf0qps, m_vscatterpf1qps,
+	m_bad, m_bad, m_vgatherpf0qpd, m_vgatherpf1qpd, m_bad, m_bad, m_vscatterpf0qpd,
+	m_vscatterpf1qpd, m_bad,
+	/* 313: EVEX 0F 38 C8, W */
+	m_vexp2ps, m_vexp2pd,
+	/* 314: EVEX 0F 38 CA, W */
+	m_vrcp28ps, m_vrcp28pd,
+	/* 315: EVEX 0F 38 CB, W */
+	m_vrcp28ss, m_vrcp28sd,
+	/* 316: EVEX 0F 38 CC, W */
+	m_vrsqrt28ps, m_vrsqrt28pd,
+	/* 317: EVEX 0F 38 CD, W */
+	m_vrsqrt28ss, m_vrsqrt28sd,
+	/* 318: EVEX 0F 3A 03, W */
+	m_valignd, m_valignq,
+	/* 319: EVEX 0F 3A 08, P */
+	m_vrndscaleph, m_vrndscaleps, m_bad, m_bad,
+	/* 320: EVEX 0F 3A 0A, P */
+	m_vrndscalesh, m_vrndscaless, m_bad, m_bad,
+	/* 321: EVEX 0F 3A 18, W */
+	m_vinsertf32x4, m_vinsertf64x2,
+	/* 322: EVEX 0F 3A 19, W */
+	m_vextractf32x4, m_vextractf64x2,
+	/* 323: EVEX 0F 3A 1A, W */
+	m_vinsertf32x8, m_vinsertf64x4,
+	/* 324: EVEX 0F 3A 1B, W */
+	m_vextractf32x8, m_vextractf64x4,
+	/* 325: EVEX 0F 3A 1E, W */
+	m_vpcmpud, m_vpcmpuq,
+	/* 326: EVEX 0F 3A 1F, W */
+	m_vpcmpd, m_vpcmpq,
+	/* 327: EVEX 0F 3A 23, W */
+	m_vshuff32x4, m_vshuff64x2,
+	/* 328: EVEX 0F 3A 25, W */
+	m_vpternlogd, m_vpternlogq,
+	/* 329: EVEX 0F 3A 26, P W */
+	m_vgetmantph, m_bad, m_vgetmantps, m_vgetmantpd, m_bad, m_bad, m_bad, m_bad,
+	/* 330: EVEX 0F 3A 27, P W */
+	m_vgetmantsh, m_bad, m_vgetmantss, m_vgetmantsd, m_bad, m_bad, m_bad, m_bad,
+	/* 331: EVEX 0F 3A 38, W */
+	m_vinserti32x4, m_vinserti64x2,
+	/* 332: EVEX 0F 3A 39, W */
+	m_vextracti32x4, m_vextracti64x2,
+	/* 333: EVEX 0F 3A 3A, W */
+	m_vinserti32x8, m_vinserti64x4,
+	/* 334: EVEX 0F 3A 3B, W */
+	m_vextracti32x8, m_vextracti64x4,
+	/* 335: EVEX 0F 3A 3E, W */
+	m_vpcmpub, m_vpcmpuw,
+	/* 336: EVEX 0F 3A 3F, W */
+	m_vpcmpb, m_vpcmpw,
+	/* 337: EVEX 0F 3A 43, W */
+	m_vshufi32x4, m_vshufi64x2,
+	/* 338: EVEX 0F 3A 50, W */
+	m_vrangeps, m_vrangepd,
+	/* 339: EVEX 0F 3A 51, W */
+	m_vrangess, m_vrangesd,
+	/* 340: EVEX 0F 3A 54, W */
+	m_vfixupimmps, m_vfixupimmpd,
+	/* 341: EVEX 0F 3A 55, W */
+	m_vfixupimmss, m_vfixupimmsd,
+	/* 342: EVEX 0F 3A 56, P W */
+	m_vreduceph, m_bad, m_vreduceps, m_vreducepd, m_bad, m_bad, m_bad, m_bad,
+	/* 343: EVEX 0F 3A 57, P W */
+	m_vreducesh, m_bad, m_vreducess, m_vreducesd, m_bad, m_bad, m_bad, m_bad,
+	/* 344: EVEX 0F 3A 66, P W */
+	m_vfpclassph, m_bad, m_vfpclassps, m_vfpclasspd, m_bad, m_bad, m_bad, m_bad,
+	/* 345: EVEX 0F 3A 67, P W */
+	m_vfpclasssh, m_bad, m_vfpclassss, m_vfpclasssd, m_bad, m_bad, m_bad, m_bad,
+	/* 346: EVEX 0F 3A 71, W */
+	m_vpshldd, m_vpshldq,
+	/* 347: EVEX 0F 3A 73, W */
+	m_vpshrdd, m_vpshrdq,
+	/* 348: EVEX 0F 3A C2, P */
+	m_vcmpph, m_bad, m_vcmpsh, m_bad,
+};
+
+
+const char *ssde_x86_names::mnemonic(const ssde_insn &insn, bool x64)
+{
+	if (insn.error_opcode || insn.error_truncated || insn.length == 0)
+		/* nothing can be told about an unknown or cut off instruction */
+	{
+		return names[m_bad];
+	}
+
+	const uint16_t *map;
+	uint8_t         op;
+
+	if (insn.opcode1 != 0x0f)
+	{
+		map = one;
+		op  = insn.opcode1;
+	}
+	else if (insn.opcode2 == 0x38 || insn.opcode2 == 0x3a)
+	{
+		bool is_38 = insn.opcode2 == 0x38;
+
+		if (!insn.has_vex)
+			map = is_38 ? map_0f38 : map_0f3a;
+		else if (insn.vex_size == 4)
+			map = is_38 ? evex_0f38 : evex_0f3a;
+		else
+			map = is_38 ? vex_0f38 : vex_0f3a;
+
+		op = insn.opcode3;
+	}
+	else
+	{
+		if (!insn.has_vex)
+			map = map_0f;
+		else if (insn.vex_size == 4)
+			map = evex_0f;
+		else
+			map = vex_0f;
+
+		op = insn.opcode2;
+	}
+
+	uint16_t entry = map[op];
+
+	if (entry & variant)
+		/* pick out of the list by those fields the variant is told apart by */
+	{
+		const variant_desc &desc = variants[entry & ~variant];
+
+		uint16_t at = 0;
+
+		if (desc.select & s_x)
+			at = static_cast<uint16_t>(at << 1 | (x64 ? 1 : 0));
+
+		if (desc.select & s_p)
+		{
+			uint8_t p = insn.group1 == 0xf3 ? 2 : insn.group1 == 0xf2 ? 3 : insn.group3 == 0x66 ? 1 : 0;
+
+			if (map == one && op != 0x90 && insn.group3 == 0x66)
+				/* 66 is the operand size of REP string instructions, only PAUSE is F3 of its own */
+			{
+				p = 1;
+			}
+
+			at = static_cast<uint16_t>(at << 2 | p);
+		}
+
+		if (desc.select & s_w)
+			at = static_cast<uint16_t>(at << 1 | ((insn.has_vex ? insn.vex_w : insn.rex_w) ? 1 : 0));
+
+		if (desc.select & s_l)
+			at = static_cast<uint16_t>(at << 2 | insn.vex_l);
+
+		if (desc.select & s_a)
+			at = static_cast<uint16_t>(at << 1 | (insn.group4 == 0x67 ? 1 : 0));
+
+		if (desc.select & s_m)
+			at = static_cast<uint16_t>(at << 1 | (insn.has_modrm && insn.modrm_mod == 3 ? 1 : 0));
+
+		if (desc.select & s_r)
+			at = static_cast<uint16_t>(at << 3 | (insn.modrm_reg & 7));
+
+		if (desc.select & s_b)
+			/* rm only tells instructions apart in register forms */
+		{
+			at = static_cast<uint16_t>(at << 3 | (insn.modrm_mod == 3 ? insn.modrm_rm & 7 : 0));
+		}
+
+		entry = lists[desc.first + at];
+	}
+
+	return names[entry];
+}
+
+
+/*
+* Text is written through a cursor into the buffer of the caller, which
+* stops short of its end and counts nothing past it; the terminator
+* always has room.
+*/
+struct ssde_text
+{
+	char *at;
+	char *end;                              // Last byte of the buffer, for the terminator.
+
+	ssde_text(char *text, size_t size) :
+		at(text),
+		end(text + size - 1)
+	{
+	}
+
+	void put(char c)
+	{
+		if (at < end)
+			*at++ = c;
+	}
+
+	void put(const char *s)
+	{
+		for (; *s != '\0' && at < end; ++s)
+			*at++ = *s;
+	}
+
+	void hex(uint64_t value)                // 0x1f
+	{
+		static const char digits[] = "0123456789abcdef";
+
+		char  buffer[16];
+		char *p = buffer + sizeof(buffer);
+
+		do
+		{
+			*--p = digits[value & 0x0f];
+			value >>= 4;
+		}
+		while (value != 0);
+
+		put('0');
+		put('x');
+
+		for (; p < buffer + sizeof(buffer); ++p)
+			put(*p);
+	}
+
+	void dec(unsigned value)
+	{
+		if (value >= 10)
+			dec(value / 10);
+
+		put(static_cast<char>('0' + value % 10));
+	}
+
+	void pad(char *from, size_t width)      // Spaces up to width counted from from.
+	{
+		while (at < end && static_cast<size_t>(at - from) < width)
+			*at++ = ' ';
+	}
+};
+
+
+static const char *const gpr_64[16] =
+{
+	"rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi",
+	"r8",  "r9",  "r10", "r11", "r12", "r13", "r14", "r15"
+};
+
+static const char *const gpr_32[16] =
+{
+	"eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi",
+	"r8d", "r9d", "r10d", "r11d", "r12d", "r13d", "r14d", "r15d"
+};
+
+static const char *const gpr_16[16] =
+{
+	"ax",  "cx",  "dx",  "bx",  "sp",  "bp",  "si",  "di",
+	"r8w", "r9w", "r10w", "r11w", "r12w", "r13w", "r14w", "r15w"
+};
+
+static const char *const gpr_8[16] =
+{
+	"al",  "cl",  "dl",  "bl",  "spl", "bpl", "sil", "dil",
+	"r8b", "r9b", "r10b", "r11b", "r12b", "r13b", "r14b", "r15b"
+};
+
+static const char *const gpr_8_high[4] = { "ah", "ch", "dh", "bh" };
+
+static const char *const segments[6] = { "es", "cs", "ss", "ds", "fs", "gs" };
+
+
+/*
+* Name of a general purpose register of the given width.
+*/
+static const char *gpr_name(uint8_t reg, uint16_t size, bool high_byte = false)
+{
+	reg &= 0x0f;
+
+	switch (size)
+	{
+	case 64: return gpr_64[reg];
+	case 32: return gpr_32[reg];
+	case 16: return gpr_16[reg];
+	default: return high_byte && reg >= 4 && reg < 8 ? gpr_8_high[reg - 4] : gpr_8[reg];
+	}
+}
+
+static void put_reg(ssde_text &out, uint8_t reg_class, uint8_t reg, uint16_t size, bool high_byte, bool att)
+{
+	if (att)
+		out.put('%');
+
+	switch (reg_class)
+	{
+	case ssde_operand::reg_gpr:     out.put(gpr_name(reg, size, high_byte)); return;
+	case ssde_operand::reg_segment: out.put(segments[reg % 6]);              return;
+	case ssde_operand::reg_control: out.put("cr");  break;
+	case ssde_operand::reg_debug:   out.put("dr");  break;
+	case ssde_operand::reg_mmx:     out.put("mm");  break;
+	case ssde_operand::reg_xmm:     out.put("xmm"); break;
+	case ssde_operand::reg_ymm:     out.put("ymm"); break;
+	case ssde_operand::reg_zmm:     out.put("zmm"); break;
+	case ssde_operand::reg_mask:    out.put('k');   break;
+
+	case ssde_operand::reg_x87:
+		out.put("st(");
+		out.dec(reg);
+		out.put(')');
+		return;
+	}
+
+	out.dec(reg);
+}
+
+/*
+* Segment of a memory operand given by a prefix byte.
+*/
+static const char *segment_name(uint8_t prefix)
+{
+	switch (prefix)
+	{
+	case ssde_x86::p_seg_es: return "es";
+	case ssde_x86::p_seg_cs: return "cs";
+	case ssde_x86::p_seg_ss: return "ss";
+	case ssde_x86::p_seg_ds: return "ds";
+	case ssde_x86::p_seg_fs: return "fs";
+	case ssde_x86::p_seg_gs: return "gs";
+	default:                 return nullptr;
+	}
+}
+
+/*
+* Size of a memory operand in Intel syntax.
+*/
+static const char *intel_size(uint16_t size)
+{
+	switch (size)
+	{
+	case 8:   return "BYTE PTR ";
+	case 16:  return "WORD PTR ";
+	case 32:  return "DWORD PTR ";
+	case 48:  return "FWORD PTR ";
+	case 64:  return "QWORD PTR ";
+	case 80:  return "TBYTE PTR ";
+	case 128: return "XMMWORD PTR ";
+	case 256: return "YMMWORD PTR ";
+	case 512: return "ZMMWORD PTR ";
+	default:  return "";
+	}
+}
+
+/*
+* AT&T suffix of an operand size, 0 if there is none.
+*/
+static char att_suffix(uint16_t size)
+{
+	switch (size)
+	{
+	case 8:  return 'b';
+	case 16: return 'w';
+	case 32: return 'l';
+	case 64: return 'q';
+	default: return '\0';
+	}
+}
+
+static void put_disp(ssde_text &out, int64_t disp, bool sign)
+{
+	if (disp < 0)
+	{
+		out.put('-');
+		out.hex(0 - static_cast<uint64_t>(disp));
+	}
+	else
+	{
+		if (sign)
+			out.put('+');
+
+		out.hex(static_cast<uint64_t>(disp));
+	}
+}
+
+/*
+* Segment a memory operand is written with, nullptr if none. In 64 bit
+* mode only FS and GS override it, others are written as prefixes.
+*/
+static const char *memory_segment(uint8_t prefix, bool x64)
+{
+	if (x64 && prefix != ssde_x86::p_seg_fs && prefix != ssde_x86::p_seg_gs)
+		return nullptr;
+
+	return segment_name(prefix);
+}
+
+static void put_memory(ssde_text &out, const ssde_operand &op, uint16_t vector_length, bool has_disp, bool att, bool x64)
+{
+	const char *segment = memory_segment(op.segment, x64);
+	bool        address = !op.has_base && !op.has_index && !op.rip_relative;
+
+	if (!att && op.broadcast && op.size != 0)
+		/* the element and BCST, DWORD BCST [rax] */
+	{
+		const char *size = intel_size(op.size);
+
+		for (; *size != ' '; ++size)
+			out.put(*size);
+
+		out.put(" BCST ");
+	}
+	else if (!att)
+	{
+		out.put(intel_size(op.size));
+	}
+
+	if (address && segment == nullptr && !att)
+		/* an absolute address is told from an immediate by its segment */
+	{
+		segment = "ds";
+	}
+
+	if (segment != nullptr)
+	{
+		if (att)
+			out.put('%');
+
+		out.put(segment);
+		out.put(':');
+	}
+
+	if (address)
+	{
+		out.hex(static_cast<uint64_t>(op.disp) & (op.address_size == 64 ? ~uint64_t(0) : (uint64_t(1) << op.address_size) - 1));
+	}
+	else if (att)
+	{
+		if (has_disp || op.disp != 0 || !op.has_base)
+			put_disp(out, op.disp, false);
+
+		out.put('(');
+
+		if (op.rip_relative)
+			out.put("%rip");
+		else if (op.has_base)
+			put_reg(out, ssde_operand::reg_gpr, op.base, op.address_size, false, true);
+
+		if (op.has_index)
+		{
+			out.put(',');
+			put_reg(out, op.index_class, op.index, op.address_size, false, true);
+
+			if (op.address_size != 16)
+				/* 16 bit addressing has no scale */
+			{
+				out.put(',');
+				out.dec(op.scale);
+			}
+		}
+
+		out.put(')');
+	}
+	else
+	{
+		out.put('[');
+
+		if (op.rip_relative)
+			out.put("rip");
+		else if (op.has_base)
+			out.put(gpr_name(op.base, op.address_size));
+
+		if (op.has_index)
+		{
+			if (op.has_base)
+				out.put('+');
+
+			put_reg(out, op.index_class, op.index, op.address_size, false, false);
+
+			if (op.address_size != 16)
+			{
+				out.put('*');
+				out.dec(op.scale);
+			}
+		}
+
+		if (op.rip_relative)
+			/* unsigned, as wide as the address */
+		{
+			out.put('+');
+			out.hex(static_cast<uint64_t>(op.disp) & (op.address_size == 64 ? ~uint64_t(0) : (uint64_t(1) << op.address_size) - 1));
+		}
+		else if (has_disp || op.disp != 0 || !op.has_base)
+		{
+			put_disp(out, op.disp, true);
+		}
+
+		out.put(']');
+	}
+
+	if (att && op.broadcast && op.size != 0)
+	{
+		out.put("{1to");
+		out.dec(vector_length / op.size);
+		out.put('}');
+	}
+}
+
+static void put_operand(ssde_text &out, const ssde_operand &op, uint16_t vector_length, bool has_disp, bool att, bool indirect, bool x64)
+{
+	switch (op.type)
+	{
+	case ssde_operand::type_reg:
+		if (att && indirect)
+			out.put('*');
+
+		put_reg(out, op.reg_class, op.reg, op.size, op.high_byte, att);
+		break;
+
+	case ssde_operand::type_mem:
+		if (att && indirect)
+			out.put('*');
+
+		put_memory(out, op, vector_length, has_disp, att, x64);
+		break;
+
+	case ssde_operand::type_imm:
+		if (att)
+			out.put('$');
+
+		out.hex(op.size >= 64 || op.size == 0 ? op.value : op.value & ((uint64_t(1) << op.size) - 1));
+		break;
+
+	case ssde_operand::type_rel:
+		out.hex(op.value);
+		break;
+	}
+}
+
+/*
+* String instructions have their operands implied: ES:[rDI], DS:[rSI]
+* whose segment can be overridden, the accumulator or DX. name is that
+* of the table, movsd, its last letter is the size. Writes the mnemonic
+* and the operands as objdump does, movs DWORD PTR es:[rdi],DWORD PTR
+* ds:[rsi] and movsl %ds:(%rsi),%es:(%rdi).
+*/
+static void put_string(ssde_text &out, const ssde_insn &insn, const char *name, bool x64, bool att, char *start)
+{
+	size_t   length = strlen(name) - 1;
+	char     last   = name[length];
+	uint16_t size   = last == 'b' ? 8 : last == 'w' ? 16 : last == 'd' ? 32 : 64;
+
+	uint16_t address_size = x64 ? (insn.group4 == ssde_x86::p_67 ? 32 : 64) : (insn.group4 == ssde_x86::p_67 ? 16 : 32);
+
+	/* operands in Intel order: d is ES:[rDI], s is DS:[rSI], a is the accumulator, p is the port */
+	const char *operands = name[0] == 'm' ? "ds" : name[0] == 'c' ? "sd" : name[0] == 's' && name[1] == 't' ? "da" :
+	                       name[0] == 'l' ? "as" : name[0] == 's' ? "ad" : name[0] == 'i' ? "dp" : "ps";
+
+	for (size_t i = 0; i < length; ++i)
+		out.put(name[i]);
+
+	if (att && operands[0] != 'a' && operands[1] != 'a')
+		/* nothing else tells the size */
+	{
+		out.put(att_suffix(size));
+	}
+
+	out.pad(start, 6);
+	out.put(' ');
+
+	for (size_t i = 0; i < 2; ++i)
+	{
+		char what = operands[att ? 1 - i : i];
+
+		if (i != 0)
+			out.put(',');
+
+		if (what == 'a')
+		{
+			put_reg(out, ssde_operand::reg_gpr, 0, size, false, att);
+			continue;
+		}
+
+		if (what == 'p')
+		{
+			out.put(att ? "(%dx)" : "dx");
+			continue;
+		}
+
+		const char *segment = what == 'd' ? "es" : memory_segment(insn.group2, x64);
+
+		if (segment == nullptr)
+			segment = "ds";
+
+		if (!att)
+			out.put(intel_size(size));
+
+		out.put(att ? "%" : "");
+		out.put(segment);
+		out.put(att ? ":(" : ":[");
+		put_reg(out, ssde_operand::reg_gpr, what == 'd' ? 7 : 6, address_size, false, att);
+		out.put(att ? ')' : ']');
+	}
+}
+
+static void put_opmask(ssde_text &out, uint8_t opmask, bool zeroing, bool att)
+{
+	if (opmask != 0)
+	{
+		out.put(att ? "{%k" : "{k");
+		out.dec(opmask);
+		out.put('}');
+	}
+
+	if (zeroing)
+		out.put("{z}");
+}
+
+/*
+* EVEX instructions that suppress exceptions but have no rounding to
+* control, b of their register forms is {sae} alone.
+*/
+static bool sae_only(const char *name)
+{
+	static const char *const prefixes[] =
+	{
+		"vcmp", "vcomi", "vucomi", "vmax", "vmin", "vcvtt", "vgetexp", "vgetmant", "vrange",
+		"vreduce", "vrndscale", "vfixupimm", "vcvtps2pd", "vcvtph2ps", "vcvtss2sd", "vcvtph2pd",
+		"vcvtsh2sd", "vcvtsh2ss", "vcvtps2phx", "vcvtph2psx", "vexp2", "vrcp28", "vrsqrt28"
+	};
+
+	for (const char *prefix : prefixes)
+	{
+		if (strncmp(name, prefix, strlen(prefix)) == 0)
+			return true;
+	}
+
+	return false;
+}
+
+static void put_rounding(ssde_text &out, const ssde_insn &insn, const char *name)
+{
+	static const char *const modes[4] = { "{rn-sae}", "{rd-sae}", "{ru-sae}", "{rz-sae}" };
+
+	out.put(sae_only(name) ? "{sae}" : modes[insn.vex_round & 3]);
+}
+
+/*
+* Compares with a predicate in their immediate are written with it in
+* the mnemonic, cmpltps, vpcmpnequb. False if name isn't one of them.
+*/
+static bool put_compare(ssde_text &out, const char *name, uint64_t predicate)
+{
+	static const char *const floats[32] =
+	{
+		"eq",    "lt",    "le",    "unord",   "neq",    "nlt",    "nle",    "ord",
+		"eq_uq", "nge",   "ngt",   "false",   "neq_oq", "ge",     "gt",     "true",
+		"eq_os", "lt_oq", "le_oq", "unord_s", "neq_us", "nlt_uq", "nle_uq", "ord_s",
+		"eq_us", "nge_uq", "ngt_uq", "false_os", "neq_os", "ge_oq", "gt_oq", "true_us"
+	};
+
+	static const char *const integers[8] = { "eq", "lt", "le", "false", "neq", "nlt", "nle", "true" };
+
+	size_t size = strlen(name);
+
+	if ((size == 5 && strncmp(name, "cmp", 3) == 0 && predicate < 8) ||
+	    (size == 6 && strncmp(name, "vcmp", 4) == 0 && predicate < 32))
+		/* cmpps, vcmpsd, vcmpph */
+	{
+		out.put(name[0] == 'v' ? "vcmp" : "cmp");
+		out.put(floats[predicate]);
+		out.put(name + size - 2);
+		return true;
+	}
+
+	if ((size == 6 || (size == 7 && name[5] == 'u')) && strncmp(name, "vpcmp", 5) == 0 && predicate < 8)
+		/* vpcmpb, vpcmpuq */
+	{
+		out.put("vpcmp");
+		out.put(integers[predicate]);
+		out.put(name + 5);
+		return true;
+	}
+
+	return false;
+}
+
+/*
+* 66 prefixes beyond the first, as padding has them, or all of them where
+* REX.W overrides them; objdump writes each as data16.
+*/
+static size_t redundant_66(const uint8_t *code, size_t size, bool all)
+{
+	size_t count = 0;
+
+	for (size_t i = 0; i < size; ++i)
+	{
+		switch (code[i])
+		{
+		case 0x66:
+			++count;
+			break;
+
+		case 0xf0: case 0xf2: case 0xf3: case 0x2e: case 0x36:
+		case 0x3e: case 0x26: case 0x64: case 0x65: case 0x67:
+			break;
+
+		default:
+			return count != 0 && !all ? count - 1 : count;
+		}
+	}
+
+	return 0;
+}
+
+/*
+* AT&T mnemonics that are not the Intel ones with a suffix.
+*/
+static const char *att_name(const char *name)
+{
+	static const char *const renames[][2] =
+	{
+		{ "cbw", "cbtw" }, { "cwde", "cwtl" }, { "cdqe", "cltq" },
+		{ "cwd", "cwtd" }, { "cdq",  "cltd" }, { "cqo",  "cqto" },
+		{ "retf", "lret" }, { "retfq", "lretq" }
+	};
+
+	for (const auto &rename : renames)
+	{
+		if (strcmp(name, rename[0]) == 0)
+			return rename[1];
+	}
+
+	return name;
+}
+
+
+size_t ssde_format::bytes(const uint8_t *code, size_t length, char *text, size_t size)
+{
+	static const char digits[] = "0123456789abcdef";
+
+	if (size == 0)
+		return 0;
+
+	ssde_text out(text, size);
+
+	for (size_t i = 0; i < length; ++i)
+	{
+		if (i != 0)
+			out.put(' ');
+
+		out.put(digits[code[i] >> 4]);
+		out.put(digits[code[i] & 0x0f]);
+	}
+
+	*out.at = '\0';
+
+	return static_cast<size_t>(out.at - text);
+}
+
+size_t ssde_format::write(const line &l, char *text, size_t size, uint8_t syntax)
+{
+	if (size == 0)
+		return 0;
+
+	const ssde_insn &insn = *l.insn;
+
+	ssde_text out(text, size);
+
+	bool        att   = syntax == syntax_att;
+	const char *name  = ssde_x86_names::mnemonic(insn, l.x64);
+	bool        known = name != ssde_x86_names::names[0];
+
+	bool legacy = !insn.has_vex;
+	bool one    = legacy && insn.opcode1 != 0x0f;
+	uint8_t op  = insn.opcode1;
+
+	/* -- prefixes that are written as words ------------------------------- */
+	bool string = one && ((op >= 0x6c && op <= 0x6f) || (op >= 0xa4 && op <= 0xa7) || (op >= 0xaa && op <= 0xaf));
+	bool branch = insn.flow != ssde_insn::flow_none && insn.flow != ssde_insn::flow_syscall &&
+	              insn.flow != ssde_insn::flow_interrupt && insn.flow != ssde_insn::flow_halt;
+	bool indirect = insn.flow == ssde_insn::flow_jmp_indirect || insn.flow == ssde_insn::flow_call_indirect;
+	bool notrack  = known && indirect && legacy && insn.group2 == ssde_x86::p_seg_ds;
+	bool hint     = known && legacy && (insn.group2 == ssde_x86::p_seg_cs || insn.group2 == ssde_x86::p_seg_ds) &&
+	                ((one && op >= 0x70 && op <= 0x7f) || (insn.opcode1 == 0x0f && insn.opcode2 >= 0x80 && insn.opcode2 <= 0x8f));
+
+	const ssde_operand *ops   = known ? l.operands : nullptr;
+	size_t              count = known ? l.count : 0;
+
+	bool has_reg    = false;
+	bool has_memory = false;
+	uint16_t memory_size = 0;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (ops[i].type == ssde_operand::type_reg)
+			has_reg = true;
+
+		if (ops[i].type == ssde_operand::type_mem)
+		{
+			has_memory  = true;
+			memory_size = ops[i].size;
+		}
+	}
+
+	char *start = out.at;
+
+	if (known && insn.group1 == ssde_x86::p_lock)
+		out.put("lock ");
+
+	if (known && string && insn.group1 == ssde_x86::p_repz)
+		out.put(op == 0xa6 || op == 0xa7 || op == 0xae || op == 0xaf ? "repz " : "rep ");
+	else if (known && string && insn.group1 == ssde_x86::p_repnz)
+		out.put("repnz ");
+	else if (known && branch && insn.group1 == ssde_x86::p_repnz)
+		out.put("bnd ");
+	else if (known && branch && insn.group1 == ssde_x86::p_repz)
+		out.put("repz ");
+
+	for (size_t i = known ? redundant_66(l.code, l.code_size, one && l.x64 && insn.rex_w) : 0; i != 0; --i)
+		out.put("data16 ");
+
+	if (known && !notrack && !string && !(hint && att) && (!has_memory || memory_segment(insn.group2, l.x64) == nullptr))
+		/* a segment no memory operand is written with, hints of Jcc are ,pn and ,pt in AT&T */
+	{
+		const char *segment = segment_name(insn.group2);
+
+		if (segment != nullptr)
+		{
+			out.put(segment);
+			out.put(' ');
+		}
+	}
+
+	if (notrack)
+		out.put("notrack ");
+
+	if (known && one && l.x64 && insn.rex_w && insn.has_rel)
+		/* REX.W of a relative branch does nothing */
+	{
+		out.put("rex.W ");
+	}
+
+	/* -- mnemonic --------------------------------------------------------- */
+	if (one && op == 0x90 && (insn.rex_b || (insn.group3 == ssde_x86::p_66 && insn.group1 != ssde_x86::p_repz)))
+		/* with REX.B (or 66) it exchanges R8 and RAX (AX and AX) rather than doing nothing */
+	{
+		name = "xchg";
+	}
+	else if (one && op == 0xc7 && insn.modrm_mod == 3 && insn.group3 == ssde_x86::p_66)
+		/* XBEGIN of a 16 bit relative address */
+	{
+		name = "xbeginw";
+	}
+	else if (one && (op == 0x68 || op == 0x6a) && insn.group3 == ssde_x86::p_66)
+		/* PUSH of a 16 bit immediate, nothing else tells its size */
+	{
+		name = "pushw";
+	}
+
+	if (known && string)
+		/* operands of their own, and a mnemonic without the size */
+	{
+		put_string(out, insn, name, l.x64, att, start);
+
+		*out.at = '\0';
+
+		return static_cast<size_t>(out.at - text);
+	}
+
+	if (count != 0 && ops[count - 1].type == ssde_operand::type_imm && !one &&
+	    put_compare(out, name, ops[count - 1].value))
+		/* the predicate is no longer an operand */
+	{
+		--count;
+	}
+	else if (!att)
+	{
+		out.put(name);
+	}
+	else if (legacy && insn.opcode1 == 0x0f && (insn.opcode2 == 0xb6 || insn.opcode2 == 0xb7 ||
+	         insn.opcode2 == 0xbe || insn.opcode2 == 0xbf) && count == 2)
+		/* MOVZX and MOVSX are told by both sizes, movzbl */
+	{
+		out.put(insn.opcode2 < 0xbe ? "movz" : "movs");
+		out.put(att_suffix(ops[1].size));
+		out.put(att_suffix(ops[0].size));
+	}
+	else if (one && op == 0x63 && l.x64 && count == 2)
+		/* MOVSXD, movslq */
+	{
+		out.put("movs");
+		out.put(att_suffix(ops[1].size));
+		out.put(att_suffix(ops[0].size));
+	}
+	else if (one && (op == 0xdc || op == 0xde) && insn.modrm_mod == 3 && (strncmp(name, "fsub", 4) == 0 || strncmp(name, "fdiv", 4) == 0))
+		/* AT&T has the reversed forms of these swapped, as assemblers always had */
+	{
+		out.put(name[0] == 'f' && name[1] == 's' ? "fsub" : "fdiv");
+
+		if (name[4] != 'r')
+			out.put('r');
+
+		out.put(name + (name[4] == 'r' ? 5 : 4));
+	}
+	else
+	{
+		out.put(att_name(name));
+
+		bool x87    = one && op >= 0xd8 && op <= 0xdf;
+		bool setcc  = legacy && insn.opcode1 == 0x0f && insn.opcode2 >= 0x90 && insn.opcode2 <= 0x9f;
+		bool stack  = l.x64 && (strcmp(name, "push") == 0 || strcmp(name, "pop") == 0);
+		bool line   = legacy && insn.opcode1 == 0x0f && ((insn.opcode2 == 0x0d || insn.opcode2 == 0x18) ? memory_size == 8 :
+		              insn.opcode2 == 0xae && insn.group1 != ssde_x86::p_repz);   // Prefetches, CLFLUSH, LDMXCSR and such, of one size.
+		size_t length = strlen(name);
+
+		if (has_memory && x87)
+			/* x87 memory is told by its width, integers have sizes of their own */
+		{
+			if (name[0] == 'f' && name[1] == 'i')
+				out.put(memory_size == 16 ? "s" : memory_size == 32 ? "l" : memory_size == 64 ? "ll" : "");
+			else if (name[0] == 'f' && name[1] != 'b')
+				out.put(memory_size == 32 ? "s" : memory_size == 64 ? "l" : memory_size == 80 ? "t" : "");
+		}
+		else if (has_memory && !has_reg && !branch && !setcc && !insn.has_vex && !(stack && memory_size == 64) && !line)
+			/* nothing else tells the size of the memory */
+		{
+			char suffix = att_suffix(memory_size);
+
+			if (suffix != '\0')
+				out.put(suffix);
+		}
+		else if (has_memory && length > 5 && (strcmp(name + length - 5, "si2ss") == 0 || strcmp(name + length - 5, "si2sd") == 0))
+			/* the integer converted is l or q */
+		{
+			char suffix = att_suffix(memory_size);
+
+			if (suffix != '\0')
+				out.put(suffix);
+		}
+	}
+
+	if (hint && att)
+		/* CS is not taken, DS is */
+	{
+		out.put(insn.group2 == ssde_x86::p_seg_cs ? ",pn" : ",pt");
+	}
+
+	/* -- operands --------------------------------------------------------- */
+	bool by_one = one && (op == 0xd0 || op == 0xd1) && count == 2;
+
+	if (by_one && att)
+		/* shifts by 1 have it implied, shr %rax */
+	{
+		count = 1;
+	}
+
+	bool rounding = known && insn.has_vex && insn.vex_size == 4 && insn.vex_rc && insn.modrm_mod == 3;
+
+	size_t round_at = count;                // Intel: rounding follows the last operand that isn't an immediate.
+
+	while (rounding && round_at != 0 && ops[round_at - 1].type == ssde_operand::type_imm)
+		--round_at;
+
+	size_t st = count;                      // The implied ST(0) of a pair of x87 registers, written as st.
+
+	if (one && op >= 0xd8 && op <= 0xdf && count == 2 && insn.modrm_mod == 3 &&
+	    ops[0].reg_class == ssde_operand::reg_x87 && ops[1].reg_class == ssde_operand::reg_x87)
+	{
+		st = op == 0xdc || op == 0xde ? 1 : 0;
+	}
+
+	if (count != 0 || rounding)
+	{
+		out.pad(start, 6);
+		out.put(' ');
+	}
+
+	if (one && (op == 0x9a || op == 0xea) && count == 2)
+		/* far pointers, selector first */
+	{
+		put_operand(out, ops[1], 0, false, att, false, l.x64);
+		out.put(att ? "," : ":");
+		put_operand(out, ops[0], 0, false, att, false, l.x64);
+	}
+	else if (!att)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (i != 0)
+				out.put(',');
+
+			if (by_one && i == count - 1)
+				out.put('1');
+			else if (i == st)
+				out.put("st");
+			else
+				put_operand(out, ops[i], l.vector_length, insn.has_disp, false, false, l.x64);
+
+			if (i == 0)
+				put_opmask(out, l.opmask, l.zeroing, false);
+
+			if (rounding && i + 1 == round_at)
+				put_rounding(out, insn, name);
+		}
+	}
+	else
+	{
+		bool reverse = !(one && op == 0xc8);
+		bool pending = rounding;                // AT&T: rounding precedes the first vector register.
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			size_t at = reverse ? count - 1 - i : i;
+
+			if (i != 0)
+				out.put(',');
+
+			if (pending && ops[at].type == ssde_operand::type_reg &&
+			    ops[at].reg_class >= ssde_operand::reg_xmm && ops[at].reg_class <= ssde_operand::reg_zmm)
+			{
+				put_rounding(out, insn, name);
+				out.put(',');
+
+				pending = false;
+			}
+
+			if (at == st)
+				out.put("%st");
+			else
+				put_operand(out, ops[at], l.vector_length, insn.has_disp, true, indirect, l.x64);
+
+			if (at == 0)
+				put_opmask(out, l.opmask, l.zeroing, true);
+		}
+	}
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (ops[i].type == ssde_operand::type_mem && ops[i].rip_relative)
+			/* where RIP-relative memory is */
+		{
+			out.put("        # ");
+			out.hex(ops[i].value);
+		}
+	}
+
+	*out.at = '\0';
+
+	return static_cast<size_t>(out.at - text);
+}
@@ -0,0 +1,148 @@
+/*
+* The SSDE header file for text of X86 and X86-64 instructions.
+* Copyright (C) 2015, Constantine Shablya. See Copyright Notice in LICENSE.md
+*/
+#pragma once
+#include "ssde_x86.hpp"
+#include "ssde_operands.hpp"
+
+#include <algorithm>
+
+
+/*
+* Mnemonic tables of X86 and X86-64, one per opcode map like the opcode
+* class tables of ssde_x86_op, with VEX and EVEX maps of their own. Most
+* opcodes name one instruction. The rest name a variant, a list picked
+* from by those fields that tell its instructions apart: mode, mandatory
+* prefix, W, L, address size override, Mod, reg and rm. See ssde_format.cpp.
+*/
+struct ssde_x86_names
+{
+	enum : uint16_t
+	{
+		variant = 0x8000                    // Entry is an index into variants rather than a mnemonic.
+	};
+
+	/*
+	* Fields a variant is picked by. The index into its list is the
+	* fields it's picked by, in this order, one after another.
+	*/
+	enum : uint8_t
+	{
+		s_x = 1 << 7,                       // 64 bit mode, 1 bit.
+		s_p = 1 << 6,                       // Mandatory prefix: none, 66, F3, F2, 2 bits.
+		s_w = 1 << 5,                       // REX.W or VEX.W, 1 bit.
+		s_l = 1 << 4,                       // VEX.L, 2 bits.
+		s_a = 1 << 3,                       // Address size override, 1 bit.
+		s_m = 1 << 2,                       // Mod is 3 (rm is a register), 1 bit.
+		s_r = 1 << 1,                       // Mod R/M reg, 3 bits.
+		s_b = 1 << 0                        // Mod R/M rm of register forms, 0 of memory ones, 3 bits.
+	};
+
+	struct variant_desc
+	{
+		uint8_t  select;                    // s_* it is picked by.
+		uint16_t first;                     // Its list in lists.
+	};
+
+	static const char *const   names[];     // Text of each mnemonic, 0 is "(bad)".
+	static const uint16_t      one[256];    // Mnemonic or variant of each opcode.
+	static const uint16_t      map_0f[256];
+	static const uint16_t      map_0f38[256];
+	static const uint16_t      map_0f3a[256];
+	static const uint16_t      vex_0f[256];
+	static const uint16_t      vex_0f38[256];
+	static const uint16_t      vex_0f3a[256];
+	static const uint16_t      evex_0f[256];
+	static const uint16_t      evex_0f38[256];
+	static const uint16_t      evex_0f3a[256];
+	static const variant_desc  variants[];
+	static const uint16_t      lists[];
+
+	/*
+	* Mnemonic of an instruction decoded with the modrm field group,
+	* "(bad)" for an unknown one or one cut off by the end of the code.
+	*/
+	static const char *mnemonic(const ssde_insn &insn, bool x64);
+};
+
+
+/*
+* Text of instructions, in Intel or AT&T syntax, written into a buffer
+* of the caller. Nothing is allocated and no streams are involved, so
+* listings of large binaries are bound by writing them out, e.g.:
+*
+*   char text[ssde_format::max_text];
+*
+*   for (ssde_x64 dis(image); dis.dec(); dis.next())
+*   {
+*     size_t n = ssde_format::format(dis, text, sizeof(text));
+*
+*     fwrite(text, 1, n, out);
+*   }
+*
+* Operands are those of ssde_operands, and the implied ones of string
+* instructions; numbers are in hex, relative targets and RIP-relative
+* addresses are absolute (base address of the code included). Text is
+* that of objdump -d, prefixes it has no use for included, except that
+* FWAIT is always an instruction of its own. Text is cut short to fit,
+* and is always terminated.
+*/
+class ssde_format
+{
+public:
+	enum : uint8_t
+	{
+		syntax_intel = 0,                   // mov rax,QWORD PTR [rbp-0x8]
+		syntax_att   = 1                    // mov -0x8(%rbp),%rax
+	};
+
+	enum : size_t { max_text = 160 };       // Longest text of an instruction, terminator included.
+
+	/*
+	* Writes text of an instruction decoded by dec() into text, returns
+	* its length.
+	*/
+	template <class arch>
+	static size_t format(const arch &dis, char *text, size_t size, uint8_t syntax = syntax_intel)
+	{
+		ssde_operands<arch> operands(dis);
+
+		line l;
+
+		l.insn          = &dis;
+		l.code          = dis.data() + dis.ip;
+		l.code_size     = dis.ip < dis.size() ? std::min<size_t>(dis.length, dis.size() - dis.ip) : 0;
+		l.x64           = arch::address_bits == 64;
+		l.operands      = operands.begin();
+		l.count         = operands.size();
+		l.vector_length = operands.vector_length();
+		l.opmask        = operands.opmask();
+		l.zeroing       = operands.zeroing();
+
+		return write(l, text, size, syntax);
+	}
+
+	/*
+	* Writes bytes of an instruction in hex, separated by spaces, returns
+	* the length of the text. A truncated instruction has fewer bytes in
+	* the code than its length; only those that are there can be given.
+	*/
+	static size_t bytes(const uint8_t *code, size_t length, char *text, size_t size);
+
+private:
+	struct line
+	{
+		const ssde_insn    *insn;
+		const uint8_t      *code;               // Bytes of the instruction, code_size of them are there.
+		size_t              code_size;
+		bool                x64;
+		const ssde_operand *operands;
+		size_t              count;
+		uint16_t            vector_length;
+		uint8_t             opmask;
+		bool                zeroing;
+	};
+
+	static size_t write(const line &l, char *text, size_t size, uint8_t syntax);
+};
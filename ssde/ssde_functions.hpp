@@ -0,0 +1,264 @@
+/*
+* The SSDE header file for finding functions in code without symbols.
+* Copyright (C) 2015, Constantine Shablya. See Copyright Notice in LICENSE.md
+*/
+#pragma once
+#include "ssde.hpp"
+#include "ssde_descent.hpp"
+#include "ssde_sweep.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+
+/*
+* A function found by ssde_functions().
+*/
+struct ssde_function
+{
+	/*
+	* What the start of the function was found by.
+	*/
+	enum : uint8_t
+	{
+		by_call     = 1 << 0,               // Target of a direct call.
+		by_endbr    = 1 << 1,               // Starts with ENDBR32 or ENDBR64.
+		by_prologue = 1 << 2,               // Starts with push ebp/rbp; mov ebp/rbp, esp/rsp.
+		by_boundary = 1 << 3                // Follows a return, jump or HLT and padding, and is aligned or has a prologue.
+	};
+
+	size_t  start;                          // Offset of the first instruction.
+	size_t  end;                            // Start of the next function, or end of the code.
+	uint8_t evidence;                       // by_* bits.
+};
+
+
+/*
+* Whether insn is alignment padding: NOP, multi byte NOP (0F 1F) or INT3.
+*/
+inline bool ssde_is_padding(const ssde_insn &insn)
+{
+	if (insn.error || insn.has_vex)
+		return false;
+
+	return insn.opcode1 == 0x90 ||
+	       insn.opcode1 == 0xcc ||
+	       (insn.opcode1 == 0x0f && insn.opcode2 == 0x1f);
+}
+
+
+/*
+* Function starts of the code of dis, from its IP to its end, sorted. The
+* code is swept linearly (see ssde_sweep()) and instructions are looked
+* at for
+*
+*   - direct calls, targets of which are function starts
+*   - ENDBR32/ENDBR64, which CET enabled compilers put at function starts,
+*     but also at exception landing pads (those move eax/rax elsewhere
+*     right away and are skipped)
+*   - push ebp/rbp; mov ebp/rbp, esp/rsp prologues
+*   - end of the previous function: a return, jump or HLT, followed by
+*     padding up to a 16 byte boundary or a prologue
+*
+* ENDBR and the end of a previous function are weak evidence, it doesn't
+* count for targets of conditional branches. Only instruction starts of
+* the sweep are considered, so calls into data or into the middle of
+* instructions are dropped. Both the sweep and the search are split
+* between threads (0 for one per core).
+*/
+template <class arch>
+std::vector<ssde_function> ssde_functions(const arch &dis, unsigned threads = 0)
+{
+	enum : size_t { max_padding = 32 };
+
+	if (threads == 0)
+		threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+	std::vector<size_t> offsets = ssde_sweep(dis, threads);
+
+	const uint8_t *code = dis.data();
+	size_t         size = dis.size();
+
+	auto has_bytes = [&](size_t ip, const uint8_t *pattern, size_t n) -> bool
+	{
+		return ip + n <= size && memcmp(code + ip, pattern, n) == 0;
+	};
+
+	auto is_prologue = [&](size_t ip) -> bool
+	{
+		static const uint8_t x64_mov[]  = { 0x55, 0x48, 0x89, 0xe5 };
+		static const uint8_t x64_movr[] = { 0x55, 0x48, 0x8b, 0xec };
+		static const uint8_t x86_mov[]  = { 0x55, 0x89, 0xe5 };
+		static const uint8_t x86_movr[] = { 0x55, 0x8b, 0xec };
+
+		return has_bytes(ip, x64_mov, 4) || has_bytes(ip, x64_movr, 4) ||
+		       has_bytes(ip, x86_mov, 3) || has_bytes(ip, x86_movr, 3);
+	};
+
+	auto is_endbr = [&](size_t ip) -> bool
+	{
+		static const uint8_t endbr64[] = { 0xf3, 0x0f, 0x1e, 0xfa };
+		static const uint8_t endbr32[] = { 0xf3, 0x0f, 0x1e, 0xfb };
+
+		return has_bytes(ip, endbr64, 4) || has_bytes(ip, endbr32, 4);
+	};
+
+	std::vector<std::vector<ssde_function>> found(threads);
+	std::vector<std::vector<size_t>>        calls(threads);
+	std::vector<std::vector<size_t>>        branches(threads);
+
+	auto search = [&](unsigned self)
+	{
+		size_t first = offsets.size() / threads * self;
+		size_t last  = self + 1 == threads ? offsets.size() : offsets.size() / threads * (self + 1);
+
+		arch insn(dis);
+
+		for (size_t i = first; i < last; ++i)
+		{
+			insn.ip = offsets[i];
+			insn.dec();
+
+			/* targets as offsets, below the code they wrap around past size */
+			uint64_t target = insn.abs - insn.base_address();
+
+			if (insn.flow == ssde_insn::flow_call && insn.has_rel && !insn.error && target < size)
+				calls[self].push_back(static_cast<size_t>(target));
+
+			if (insn.flow == ssde_insn::flow_jcc && insn.has_rel && !insn.error && target < size)
+				branches[self].push_back(static_cast<size_t>(target));
+
+			if (ssde_is_padding(insn))
+				continue;
+
+			if (i > 0 && offsets[i - 1] + 4 == insn.ip && is_endbr(offsets[i - 1]))
+				/* the function started at ENDBR already */
+			{
+				continue;
+			}
+
+			uint8_t evidence = 0;
+
+			if (is_endbr(insn.ip))
+				/* unless it's an exception landing pad, which takes the exception in eax/rax */
+			{
+				arch pad(dis);
+
+				pad.ip = insn.ip + insn.length;
+				pad.dec();
+
+				if (pad.opcode1 != 0x89 || pad.modrm_mod != 3 || pad.modrm_reg != 0 || pad.has_vex)
+					evidence |= ssde_function::by_endbr;
+			}
+
+			if (is_prologue(insn.ip))
+				evidence |= ssde_function::by_prologue;
+
+			if (i > 0 && (insn.ip % 16 == 0 || evidence))
+				/* look back past padding for the end of the previous function */
+			{
+				arch prev(dis);
+
+				size_t j = i;
+
+				do
+				{
+					prev.ip = offsets[--j];
+					prev.dec();
+				}
+				while (ssde_is_padding(prev) && j > 0 && i - j < max_padding);
+
+				if (!ssde_is_padding(prev) && !ssde_falls_through(prev))
+					evidence |= ssde_function::by_boundary;
+			}
+
+			if (evidence)
+			{
+				ssde_function function = { insn.ip, 0, evidence };
+				found[self].push_back(function);
+			}
+		}
+	};
+
+	std::vector<std::thread> workers;
+
+	for (unsigned t = 1; t < threads; ++t)
+		workers.emplace_back(search, t);
+
+	search(0);
+
+	for (auto &worker : workers)
+		worker.join();
+
+	/* slices are in order, so are functions found in them */
+	std::vector<ssde_function> functions;
+
+	for (auto &slice : found)
+		functions.insert(functions.end(), slice.begin(), slice.end());
+
+	for (auto &slice : calls)
+	{
+		for (size_t target : slice)
+		{
+			if (!std::binary_search(offsets.begin(), offsets.end(), target))
+				/* lands in the middle of an instruction */
+			{
+				continue;
+			}
+
+			ssde_function function = { target, 0, ssde_function::by_call };
+			functions.push_back(function);
+		}
+	}
+
+	std::stable_sort(functions.begin(), functions.end(), [](const ssde_function &a, const ssde_function &b)
+	{
+		return a.start < b.start;
+	});
+
+	std::vector<size_t> targets;
+
+	for (auto &slice : branches)
+		targets.insert(targets.end(), slice.begin(), slice.end());
+
+	std::sort(targets.begin(), targets.end());
+
+	/* merge evidence of functions found more than once */
+	size_t count = 0;
+
+	for (size_t i = 0; i < functions.size(); ++i)
+	{
+		if (count > 0 && functions[count - 1].start == functions[i].start)
+			functions[count - 1].evidence |= functions[i].evidence;
+		else
+			functions[count++] = functions[i];
+	}
+
+	/*
+	* Code past jumps is often aligned and jump tables land on ENDBR as
+	* well, but conditional branches don't go to other functions. Weak
+	* evidence doesn't count for their targets.
+	*/
+	size_t kept = 0;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (!(functions[i].evidence & (ssde_function::by_call | ssde_function::by_prologue)) &&
+		    std::binary_search(targets.begin(), targets.end(), functions[i].start))
+		{
+			continue;
+		}
+
+		functions[kept++] = functions[i];
+	}
+
+	count = kept;
+
+	functions.resize(count);
+
+	for (size_t i = 0; i < count; ++i)
+		functions[i].end = i + 1 < count ? functions[i + 1].start : size;
+
+	return functions;
+}
@@ -0,0 +1,1796 @@
+/*
+* The SSDE header file for operands of X86 and X86-64 instructions.
+* Copyright (C) 2015, Constantine Shablya. See Copyright Notice in LICENSE.md
+*/
+#pragma once
+#include "ssde_x86.hpp"
+
+
+/*
+* An operand of an instruction: a register, memory, an immediate or a
+* relative address.
+*/
+struct ssde_operand
+{
+	enum : uint8_t
+	{
+		type_none = 0,                      // No operand.
+		type_reg  = 1,                      // Register, see reg_class and reg.
+		type_mem  = 2,                      // Memory, see base, index, scale and disp.
+		type_imm  = 3,                      // Immediate value, in value.
+		type_rel  = 4                       // Relative address, its target is in value.
+	};
+
+	/*
+	* Register classes.
+	*/
+	enum : uint8_t
+	{
+		reg_gpr     = 0,                    // General purpose, size tells AL, AX, EAX or RAX.
+		reg_segment = 1,                    // ES, CS, SS, DS, FS, GS, in that order.
+		reg_control = 2,                    // CR0-CR15.
+		reg_debug   = 3,                    // DR0-DR15.
+		reg_x87     = 4,                    // ST(0)-ST(7).
+		reg_mmx     = 5,                    // MM0-MM7.
+		reg_xmm     = 6,                    // XMM0-XMM31.
+		reg_ymm     = 7,                    // YMM0-YMM31.
+		reg_zmm     = 8,                    // ZMM0-ZMM31.
+		reg_mask    = 9                     // K0-K7.
+	};
+
+	uint8_t  type         = type_none;      // type_* of the operand.
+	uint8_t  reg_class    = reg_gpr;        // Class of the register, type_reg.
+	uint8_t  reg          = 0;              // Number of the register in its class, type_reg.
+	bool     high_byte    = false;          // 8 bit register 4-7 is AH, CH, DH or BH rather than SPL, BPL, SIL or DIL.
+	uint16_t size         = 0;              // Width in bits of the register, the memory accessed (0 if it's not plain) or the immediate.
+
+	bool     has_base     = false;          // Memory: has a base register.
+	bool     has_index    = false;          // Memory: has an index register.
+	bool     rip_relative = false;          // Memory: relative to the next instruction (X86-64), value is the address.
+	bool     broadcast    = false;          // Memory: one element broadcast to the vector (EVEX), size is of the element.
+	uint8_t  base         = 0;              // Memory: base register, a general purpose one.
+	uint8_t  index        = 0;              // Memory: index register.
+	uint8_t  index_class  = reg_gpr;        // Memory: class of the index register, vector ones for VSIB.
+	uint8_t  scale        = 0;              // Memory: index scale factor, 1, 2, 4 or 8.
+	uint8_t  segment      = 0;              // Memory: segment override prefix (p_seg_*), 0 if none.
+	uint8_t  address_size = 0;              // Memory: address size in bits, 16, 32 or 64.
+	int64_t  disp         = 0;              // Memory: displacement, moffs included.
+
+	uint64_t value        = 0;              // Immediate (sign extended where the instruction does so), relative target or address of RIP-relative memory.
+};
+
+
+/*
+* Operands of an instruction decoded by ssde_x86 or ssde_x64, expanded
+* from its fields on first access and kept until the instruction is
+* gone. Decoding doesn't do any of this, so loops that only need lengths
+* or branch targets don't pay for it, e.g.:
+*
+*   for (ssde_x64 dis(text, text_size); dis.dec(); dis.next())
+*   {
+*     ssde_operands<ssde_x64> operands(dis);
+*
+*     for (const ssde_operand &operand : operands)
+*       if (operand.type == ssde_operand::type_mem && operand.rip_relative)
+*         ... operand.value is the address referenced
+*   }
+*
+* Operands are in Intel order, the destination first. Those given by the
+* encoding are there: Mod R/M reg and rm, VEX vvvv, registers in opcode
+* bytes, immediates, relative addresses and moffs, as well as AL/eAX of
+* accumulator forms, CL and 1 of shifts, DX of IN and OUT and XMM0 of
+* BLENDV and SHA256RNDS2. Other implicit operands (stack of PUSH, EDI of
+* string instructions etc.) are not. Vector memory is as wide as the
+* vector unless the instruction is scalar, broadcasts or widens; gathers
+* and scatters have the size of an element there. disp of EVEX disp8 is
+* scaled by N, the size of the memory accessed, an element of compresses
+* and expands.
+*
+* The instruction has to be decoded with the modrm, sib, disp, imm, rel
+* and vex field groups, as dec() does, and the view borrows it: it's
+* only valid until the disassembler decodes the next one.
+*/
+template <class arch>
+class ssde_operands
+{
+public:
+	enum : size_t { max_operands = 5 };     // Most operands an instruction has, here.
+
+	explicit ssde_operands(const arch &dis) :
+		dis(dis)
+	{
+	}
+
+	size_t size() const                     // Number of operands.
+	{
+		expand();
+
+		return count;
+	}
+
+	const ssde_operand &operator[](size_t i) const
+	{
+		expand();
+
+		return list[i];
+	}
+
+	const ssde_operand *begin() const
+	{
+		expand();
+
+		return list;
+	}
+
+	const ssde_operand *end() const
+	{
+		expand();
+
+		return list + count;
+	}
+
+	uint16_t vector_length() const          // Vector length in bits from VEX L (128, 256 or 512), 0 without VEX.
+	{
+		if (!dis.has_vex)
+			return 0;
+
+		expand();
+
+		return length == 2 ? 512 : length == 1 ? 256 : 128;
+	}
+
+	uint8_t opmask() const                  // AVX-512 opmask register, 0 if none.
+	{
+		return dis.has_vex && dis.vex_size == 4 ? dis.vex_opmask : 0;
+	}
+
+	bool zeroing() const                    // AVX-512 zeroing rather than merging masking.
+	{
+		return dis.has_vex && dis.vex_size == 4 && dis.vex_zero;
+	}
+
+private:
+	enum : uint8_t { none = 0xff };         // No operand, in place of a register class.
+
+	/*
+	* What a Mod R/M field or vvvv is: a register class (or none) and a
+	* width. Memory rm takes the width of the register it would be.
+	*/
+	struct role
+	{
+		uint8_t  cls  = none;
+		uint16_t size = 0;
+	};
+
+	/*
+	* Intel order of reg, rm and vvvv.
+	*/
+	enum : uint8_t
+	{
+		order_reg_vex_rm,                   // Most of them: reg is the destination.
+		order_rm_vex_reg,                   // Stores: rm is the destination.
+		order_vex_rm,                       // vvvv is the destination, reg is an opcode extension.
+		order_reg_rm_vex                    // BMI shifts and bit field extracts.
+	};
+
+	static const bool x64 = arch::address_bits == 64;
+
+	void expand() const
+	{
+		if (expanded)
+			return;
+
+		expanded = true;
+
+		if (dis.error_opcode || dis.length == 0)
+			/* nothing can be told about an unknown instruction */
+		{
+			return;
+		}
+
+		extensions();
+
+		if (dis.opcode1 != 0x0f)
+			expand_1();
+		else if (dis.opcode2 == 0x38)
+			expand_38();
+		else if (dis.opcode2 == 0x3a)
+			expand_3a();
+		else
+			expand_0f();
+	}
+
+	/* -- REX, VEX and EVEX register extensions ---------------------------- */
+	void extensions() const
+	{
+		ext_r  = dis.rex_r ? 8 : 0;
+		ext_x  = dis.rex_x ? 8 : 0;
+		ext_b  = dis.rex_b ? 8 : 0;
+		ext_rr = 0;
+		ext_xx = 0;
+		ext_v  = 0;
+
+		vvvv   = dis.vex_reg & 0x0f;
+		length = dis.vex_l;
+
+		if (dis.has_vex && dis.vex_size == 4)
+			/* EVEX has a fifth bit for registers of 64 bit mode */
+		{
+			if (x64)
+			{
+				ext_rr = dis.vex_rr ? 16 : 0;
+				ext_xx = dis.vex_x ? 16 : 0;
+				ext_v  = dis.vex_reg & 0x10;
+			}
+
+			broadcast = dis.vex_broadcast && memory();
+
+			if (broadcast)
+				/* the decoder takes b for rounding control, which implies 512 bits, it's only that with registers */
+			{
+				length = dis.vex_round;
+			}
+		}
+	}
+
+	/* -- widths ----------------------------------------------------------- */
+	uint16_t gpr_size(bool byte_op = false) const
+	{
+		if (byte_op)
+			return 8;
+
+		if (x64 && dis.rex_w)
+			return 64;
+
+		return operand_size_66() ? 16 : 32;
+	}
+
+	uint16_t stack_size() const             // Width of operands of PUSH, POP and indirect branches.
+	{
+		if (operand_size_66())
+			return 16;
+
+		return x64 ? 64 : 32;
+	}
+
+	uint16_t group15_size() const           // Memory of 0F AE, 0 for state areas of FXSAVE, XSAVE and such.
+	{
+		switch (dis.modrm_reg & 0x07)
+		{
+		case 2: case 3:
+			/* LDMXCSR and STMXCSR */
+			return 32;
+
+		case 4:
+			/* PTWRITE */
+			return dis.group1 == ssde_x86::p_repz ? (x64 && dis.rex_w ? 64 : 32) : 0;
+
+		case 6: case 7:
+			/* CLWB, CLFLUSH and CLFLUSHOPT, of the line a byte is in */
+			return (dis.modrm_reg & 0x07) == 7 || dis.group3 == ssde_x86::p_66 ? 8 : 0;
+
+		default:
+			return 0;
+		}
+	}
+
+	bool operand_size_66() const            // 66 overrides the operand size, rather than being VEX pp or a mandatory prefix.
+	{
+		if (dis.group3 != ssde_x86::p_66 || dis.has_vex)
+			return false;
+
+		/* WRUSS, ADCX and MOVDIR64B, 66 is a part of their opcode */
+		return !(dis.opcode1 == 0x0f && dis.opcode2 == 0x38 && (dis.opcode3 == 0xf5 || dis.opcode3 == 0xf6 || dis.opcode3 == 0xf8));
+	}
+
+	uint8_t vector_class() const
+	{
+		if (!dis.has_vex)
+			return ssde_operand::reg_xmm;
+
+		return length == 2 ? ssde_operand::reg_zmm : length == 1 ? ssde_operand::reg_ymm : ssde_operand::reg_xmm;
+	}
+
+	static uint16_t class_size(uint8_t cls)
+	{
+		switch (cls)
+		{
+		case ssde_operand::reg_segment:
+			return 16;
+
+		case ssde_operand::reg_control:
+		case ssde_operand::reg_debug:
+			return x64 ? 64 : 32;
+
+		case ssde_operand::reg_x87:
+			return 80;
+
+		case ssde_operand::reg_mmx:
+		case ssde_operand::reg_mask:
+			return 64;
+
+		case ssde_operand::reg_xmm:
+			return 128;
+
+		case ssde_operand::reg_ymm:
+			return 256;
+
+		case ssde_operand::reg_zmm:
+			return 512;
+
+		default:
+			return 0;
+		}
+	}
+
+	static role make(uint8_t cls, uint16_t size = 0)
+	{
+		role r;
+
+		r.cls  = cls;
+		r.size = size != 0 ? size : class_size(cls);
+
+		return r;
+	}
+
+	role gpr(bool byte_op = false) const
+	{
+		return make(ssde_operand::reg_gpr, gpr_size(byte_op));
+	}
+
+	role vector() const
+	{
+		return make(vector_class());
+	}
+
+	bool simd_prefix() const                // 66, F2, F3 or VEX, which turn MMX forms into SSE ones.
+	{
+		return dis.has_vex ||
+		       dis.group3 == ssde_x86::p_66 ||
+		       dis.group1 == ssde_x86::p_repz ||
+		       dis.group1 == ssde_x86::p_repnz;
+	}
+
+	bool memory() const                     // Whether rm is memory.
+	{
+		return dis.has_modrm && dis.modrm_mod != 0x03;
+	}
+
+	/* -- operands --------------------------------------------------------- */
+	ssde_operand &push() const
+	{
+		list[count] = ssde_operand();
+
+		return list[count++];
+	}
+
+	void push_reg(uint8_t cls, uint8_t reg, uint16_t size) const
+	{
+		if (count == max_operands)
+			return;
+
+		ssde_operand &op = push();
+
+		op.type      = ssde_operand::type_reg;
+		op.reg_class = cls;
+		op.reg       = reg;
+		op.size      = size;
+		op.high_byte = cls == ssde_operand::reg_gpr && size == 8 && reg >= 4 && reg < 8 && !dis.has_rex;
+	}
+
+	void push_imm(uint64_t value, uint16_t size) const
+	{
+		if (count == max_operands)
+			return;
+
+		ssde_operand &op = push();
+
+		op.type  = ssde_operand::type_imm;
+		op.value = value;
+		op.size  = size;
+	}
+
+	void push_role_reg(const role &r) const // Mod R/M reg.
+	{
+		bool vector = r.cls >= ssde_operand::reg_xmm && r.cls <= ssde_operand::reg_zmm;
+
+		uint8_t reg = (dis.modrm_reg & 0x07) | ext_r | (vector ? ext_rr : 0);
+
+		if (r.cls == ssde_operand::reg_segment || r.cls == ssde_operand::reg_x87 ||
+		    r.cls == ssde_operand::reg_mmx     || r.cls == ssde_operand::reg_mask)
+			/* only 8 of these, REX doesn't extend them */
+		{
+			reg &= 0x07;
+		}
+
+		push_reg(r.cls, reg, r.size);
+	}
+
+	void push_role_vex(const role &r) const // VEX vvvv.
+	{
+		bool vector = r.cls >= ssde_operand::reg_xmm && r.cls <= ssde_operand::reg_zmm;
+
+		push_reg(r.cls, static_cast<uint8_t>(vvvv | (vector ? ext_v : 0)), r.size);
+	}
+
+	void push_role_rm(const role &r) const  // Mod R/M rm, a register or memory.
+	{
+		if (memory())
+		{
+			push_memory(r.size);
+			return;
+		}
+
+		bool vector = r.cls >= ssde_operand::reg_xmm && r.cls <= ssde_operand::reg_zmm;
+
+		uint8_t reg = (dis.modrm_rm & 0x07) | ext_b | (vector ? ext_xx : 0);
+
+		if (r.cls == ssde_operand::reg_x87 || r.cls == ssde_operand::reg_mmx || r.cls == ssde_operand::reg_mask)
+			reg &= 0x07;
+
+		push_reg(r.cls, reg, r.size);
+	}
+
+	void push_memory(uint16_t size) const
+	{
+		if (count == max_operands)
+			return;
+
+		ssde_operand &op = push();
+
+		bool addr16 = !x64 && dis.group4 == ssde_x86::p_67;
+
+		op.type         = ssde_operand::type_mem;
+		op.size         = broadcast ? (dis.vex_w ? 64 : 32) : size;
+		op.broadcast    = broadcast;
+		op.segment      = dis.group2;
+		op.address_size = x64 ? (dis.group4 == ssde_x86::p_67 ? 32 : 64) : (addr16 ? 16 : 32);
+		op.disp         = dis.has_disp ? static_cast<int32_t>(dis.disp) : 0;
+
+		if (dis.has_vex && dis.vex_size == 4 && dis.disp_size == 1)
+			/* EVEX disp8 is in units of N, the bytes accessed */
+		{
+			uint16_t n = element != 0 ? element : op.size / 8;
+
+			op.disp *= n != 0 ? n : 1;
+		}
+
+		uint8_t rm = dis.modrm_rm & 0x07;
+
+		if (addr16)
+			/* BX+SI, BX+DI, BP+SI, BP+DI, SI, DI, BP (disp16 alone with Mod 0), BX */
+		{
+			static const uint8_t base16[8]  = { 3, 3, 5, 5, 6, 7, 5, 3 };
+			static const uint8_t index16[8] = { 6, 7, 6, 7, 0, 0, 0, 0 };
+
+			op.has_base  = !(dis.modrm_mod == 0x00 && rm == 0x06);
+			op.base      = base16[rm];
+			op.has_index = rm < 4;
+			op.index     = index16[rm];
+			op.scale     = op.has_index ? 1 : 0;
+			op.disp      = dis.disp_size == 2 ? static_cast<int16_t>(dis.disp) : op.disp;
+
+			return;
+		}
+
+		if (dis.has_sib)
+		{
+			uint8_t base  = (dis.sib_base  & 0x07) | ext_b;
+			uint8_t index = (dis.sib_index & 0x07) | ext_x;
+
+			op.has_base  = !(dis.modrm_mod == 0x00 && (dis.sib_base & 0x07) == 0x05);
+			op.base      = base;
+			op.has_index = vsib != none || index != 0x04;
+			op.index     = vsib != none ? static_cast<uint8_t>(index | ext_v) : index;
+			op.scale     = op.has_index ? dis.sib_scale : 0;
+
+			if (vsib != none)
+				op.index_class = vsib;
+
+			return;
+		}
+
+		if (dis.modrm_mod == 0x00 && rm == 0x05)
+			/* disp32 alone, relative to the next instruction in 64 bit mode */
+		{
+			if (x64)
+			{
+				op.rip_relative = true;
+				op.value        = dis.base_address() + dis.ip + dis.length + op.disp;
+
+				if (op.address_size == 32)
+					op.value &= 0xffffffff;
+			}
+
+			return;
+		}
+
+		op.has_base = true;
+		op.base     = rm | ext_b;
+	}
+
+	/*
+	* Pushes reg, rm and vvvv in order, then the immediates and the
+	* relative address.
+	*/
+	void layout(const role &reg, const role &rm, const role &vex, uint8_t order) const
+	{
+		bool use_vex = dis.has_vex && vex.cls != none;
+
+		switch (order)
+		{
+		case order_rm_vex_reg:
+			if (rm.cls != none)
+				push_role_rm(rm);
+
+			if (use_vex)
+				push_role_vex(vex);
+
+			if (reg.cls != none)
+				push_role_reg(reg);
+			break;
+
+		case order_vex_rm:
+			if (use_vex)
+				push_role_vex(vex);
+
+			if (rm.cls != none)
+				push_role_rm(rm);
+			break;
+
+		case order_reg_rm_vex:
+			if (reg.cls != none)
+				push_role_reg(reg);
+
+			if (rm.cls != none)
+				push_role_rm(rm);
+
+			if (use_vex)
+				push_role_vex(vex);
+			break;
+
+		default:
+			if (reg.cls != none)
+				push_role_reg(reg);
+
+			if (use_vex)
+				push_role_vex(vex);
+
+			if (rm.cls != none)
+				push_role_rm(rm);
+			break;
+		}
+
+		immediates();
+	}
+
+	void immediates() const
+	{
+		if (dis.has_imm)
+		{
+			uint16_t size  = static_cast<uint16_t>(dis.imm_size * 8);
+			uint16_t width = sign_extends();
+
+			if (width > size)
+				/* sign extended to the operand size */
+			{
+				uint64_t value = static_cast<uint64_t>(size == 8 ? static_cast<int8_t>(dis.imm) :
+				                                       size == 16 ? static_cast<int16_t>(dis.imm) :
+				                                                    static_cast<int32_t>(dis.imm));
+
+				push_imm(width < 64 ? value & ((1ull << width) - 1) : value, width);
+			}
+			else
+			{
+				push_imm(dis.imm, size);
+			}
+		}
+
+		if (dis.has_imm2)
+			push_imm(dis.imm2, static_cast<uint16_t>(dis.imm2_size * 8));
+
+		if (dis.has_rel && count < max_operands)
+		{
+			ssde_operand &op = push();
+
+			op.type  = ssde_operand::type_rel;
+			op.value = dis.abs;
+			op.size  = static_cast<uint16_t>(dis.rel_size * 8);
+		}
+	}
+
+	uint16_t sign_extends() const           // Operand size an immediate is sign extended to, 0 if it isn't.
+	{
+		if (dis.opcode1 == 0x0f || dis.has_vex)
+			return 0;
+
+		switch (dis.opcode1)
+		{
+		case 0x6a:
+		case 0x68:
+			/* PUSH */
+			return stack_size();
+
+		case 0x6b:
+		case 0x83:
+			return gpr_size();
+
+		default:
+			/* imm32 of 64 bit operations */
+			return dis.imm_size == 4 && x64 && dis.rex_w ? 64 : 0;
+		}
+	}
+
+	/* -- one byte opcodes ------------------------------------------------- */
+	void expand_1() const
+	{
+		uint8_t op = dis.opcode1;
+		role    reg, rm, vex;
+
+		if (!dis.has_modrm)
+		{
+			if (op < 0x40 && (op & 0x07) >= 0x04 && (op & 0x07) <= 0x05)
+				/* ALU on the accumulator and an immediate */
+			{
+				push_reg(ssde_operand::reg_gpr, 0, gpr_size(op & 0x01 ? false : true));
+			}
+			else if (!x64 && op >= 0x40 && op <= 0x4f)
+				/* INC and DEC of a register */
+			{
+				push_reg(ssde_operand::reg_gpr, op & 0x07, gpr_size());
+			}
+			else if (op >= 0x50 && op <= 0x5f)
+				/* PUSH and POP of a register */
+			{
+				push_reg(ssde_operand::reg_gpr, (op & 0x07) | ext_b, stack_size());
+			}
+			else if ((op >= 0x91 && op <= 0x97) || (op == 0x90 && (ext_b || (operand_size_66() && dis.group1 != ssde_x86::p_repz))))
+				/* XCHG of a register and the accumulator, 90 is NOP without REX.B or 66 */
+			{
+				push_reg(ssde_operand::reg_gpr, (op & 0x07) | ext_b, gpr_size());
+				push_reg(ssde_operand::reg_gpr, 0, gpr_size());
+			}
+			else if (op >= 0xa0 && op <= 0xa3)
+				/* MOV between the accumulator and moffs */
+			{
+				uint16_t size = gpr_size(op & 0x01 ? false : true);
+
+				if (op >= 0xa2)
+					push_moffs(size);
+
+				push_reg(ssde_operand::reg_gpr, 0, size);
+
+				if (op < 0xa2)
+					push_moffs(size);
+
+				return;
+			}
+			else if (op == 0xa8 || op == 0xa9)
+				/* TEST of the accumulator */
+			{
+				push_reg(ssde_operand::reg_gpr, 0, gpr_size(op == 0xa8));
+			}
+			else if (op >= 0xb0 && op <= 0xb7)
+				/* MOV of an immediate to an 8 bit register */
+			{
+				push_reg(ssde_operand::reg_gpr, (op & 0x07) | ext_b, 8);
+			}
+			else if (op >= 0xb8 && op <= 0xbf)
+				/* MOV of an immediate to a register, 64 bit with REX.W */
+			{
+				push_reg(ssde_operand::reg_gpr, (op & 0x07) | ext_b, gpr_size());
+			}
+			else if ((op >= 0xe4 && op <= 0xe7) || (op >= 0xec && op <= 0xef))
+				/* IN and OUT, the port is an immediate or DX */
+			{
+				uint16_t size = op & 0x01 ? (dis.group3 == ssde_x86::p_66 ? 16 : 32) : 8;
+
+				if (op & 0x02)
+					port();
+
+				push_reg(ssde_operand::reg_gpr, 0, size);
+
+				if (!(op & 0x02))
+					port();
+
+				return;
+			}
+
+			immediates();
+			return;
+		}
+
+		uint8_t order = order_reg_vex_rm;
+
+		switch (op)
+		{
+		case 0x62:
+			/* BOUND */
+			reg = gpr();
+			rm  = make(ssde_operand::reg_gpr, 0);
+			break;
+
+		case 0x63:
+			/* MOVSXD in 64 bit mode, ARPL outside of it */
+			if (x64)
+			{
+				reg = gpr();
+				rm  = make(ssde_operand::reg_gpr, 32);
+			}
+			else
+			{
+				reg   = make(ssde_operand::reg_gpr, 16);
+				rm    = make(ssde_operand::reg_gpr, 16);
+				order = order_rm_vex_reg;
+			}
+			break;
+
+		case 0x69:
+		case 0x6b:
+			/* IMUL with an immediate */
+			reg = gpr();
+			rm  = gpr();
+			break;
+
+		case 0xc6: case 0xc7:
+			if (dis.modrm_mod == 0x03 && (dis.modrm_reg & 0x07) == 0x07)
+				/* XABORT and XBEGIN, only an immediate or the abort handler */
+			{
+				immediates();
+				return;
+			}
+
+			rm = gpr(!(op & 0x01));
+			break;
+
+		case 0x80: case 0x81: case 0x82: case 0x83:
+		case 0xc0: case 0xc1:
+		case 0xd0: case 0xd1: case 0xd2: case 0xd3:
+		case 0xf6: case 0xf7: case 0xfe:
+			/* reg extends the opcode */
+			rm = gpr(!(op & 0x01));
+			break;
+
+		case 0x84: case 0x85: case 0x86: case 0x87:
+		case 0x88: case 0x89:
+			/* TEST, XCHG and MOV to rm */
+			reg   = gpr(!(op & 0x01));
+			rm    = gpr(!(op & 0x01));
+			order = order_rm_vex_reg;
+			break;
+
+		case 0x8a:
+		case 0x8b:
+			reg = gpr(op == 0x8a);
+			rm  = gpr(op == 0x8a);
+			break;
+
+		case 0x8c:
+			/* MOV from a segment register */
+			reg   = make(ssde_operand::reg_segment);
+			rm    = memory() ? make(ssde_operand::reg_gpr, 16) : gpr();
+			order = order_rm_vex_reg;
+			break;
+
+		case 0x8d:
+			/* LEA, memory isn't accessed */
+			reg = gpr();
+			rm  = make(ssde_operand::reg_gpr, 0);
+			break;
+
+		case 0x8e:
+			/* MOV to a segment register */
+			reg = make(ssde_operand::reg_segment);
+			rm  = make(ssde_operand::reg_gpr, 16);
+			break;
+
+		case 0x8f:
+			/* POP to rm */
+			rm = make(ssde_operand::reg_gpr, stack_size());
+			break;
+
+		case 0xc4:
+		case 0xc5:
+			/* LES and LDS, far pointers */
+			reg = gpr();
+			rm  = make(ssde_operand::reg_gpr, 0);
+			break;
+
+		case 0xd8: case 0xd9: case 0xda: case 0xdb:
+		case 0xdc: case 0xdd: case 0xde: case 0xdf:
+			expand_x87(op);
+			return;
+
+		case 0xff:
+			switch (dis.modrm_reg & 0x07)
+			{
+			case 0x02:
+			case 0x04:
+			case 0x06:
+				/* CALL, JMP and PUSH */
+				rm = make(ssde_operand::reg_gpr, stack_size());
+				break;
+
+			case 0x03:
+			case 0x05:
+				/* far CALL and JMP */
+				rm = make(ssde_operand::reg_gpr, 0);
+				break;
+
+			default:
+				rm = gpr();
+				break;
+			}
+			break;
+
+		default:
+			if (op < 0x40)
+				/* ALU, bit 1 tells which way it goes */
+			{
+				reg   = gpr(!(op & 0x01));
+				rm    = gpr(!(op & 0x01));
+				order = op & 0x02 ? order_reg_vex_rm : order_rm_vex_reg;
+			}
+			else
+			{
+				reg = gpr();
+				rm  = gpr();
+			}
+			break;
+		}
+
+		layout(reg, rm, vex, order);
+
+		if (op == 0xd0 || op == 0xd1)
+			/* shifts by 1 */
+		{
+			push_imm(1, 8);
+		}
+		else if (op == 0xd2 || op == 0xd3)
+			/* shifts by CL */
+		{
+			push_reg(ssde_operand::reg_gpr, 1, 8);
+		}
+	}
+
+	/*
+	* x87 escapes. Memory is as wide as the integer or real it holds (0
+	* for environments and states), registers are ST(0) and ST(i).
+	*/
+	void expand_x87(uint8_t op) const
+	{
+		uint8_t reg = dis.modrm_reg & 0x07;
+
+		if (memory())
+		{
+			static const uint8_t widths[8][8] =
+			{
+				{ 32, 32, 32, 32, 32, 32, 32, 32 },   // D8: real4
+				{ 32,  0, 32, 32,  0, 16,  0, 16 },   // D9: real4, environment, control word
+				{ 32, 32, 32, 32, 32, 32, 32, 32 },   // DA: int4
+				{ 32, 32, 32, 32,  0, 80,  0, 80 },   // DB: int4, real10
+				{ 64, 64, 64, 64, 64, 64, 64, 64 },   // DC: real8
+				{ 64, 64, 64, 64,  0,  0,  0, 16 },   // DD: real8, state, status word
+				{ 16, 16, 16, 16, 16, 16, 16, 16 },   // DE: int2
+				{ 16, 16, 16, 16, 80, 64, 80, 64 }    // DF: int2, bcd, int8
+			};
+
+			push_memory(widths[op - 0xd8][reg]);
+			return;
+		}
+
+		uint8_t i = dis.modrm_rm & 0x07;
+
+		bool st0_sti = false;                   // ST(0), ST(i)
+		bool sti_st0 = false;                   // ST(i), ST(0)
+		bool sti     = false;                   // ST(i) alone
+
+		switch (op)
+		{
+		case 0xd8:
+			st0_sti = reg != 2 && reg != 3;
+			sti     = !st0_sti;
+			break;
+
+		case 0xd9:
+			/* FLD and FXCH, the rest have no operands */
+			sti = reg == 0 || reg == 1;
+			break;
+
+		case 0xda:
+			/* FCMOVcc, FUCOMPP has none */
+			st0_sti = reg < 4;
+			break;
+
+		case 0xdb:
+			/* FCMOVNcc, FUCOMI and FCOMI */
+			st0_sti = reg < 4 || reg == 5 || reg == 6;
+			break;
+
+		case 0xdc:
+			sti_st0 = reg != 2 && reg != 3;
+			sti     = !sti_st0;
+			break;
+
+		case 0xdd:
+			/* FFREE, FST, FSTP, FUCOM and FUCOMP */
+			sti = reg != 1 && reg != 6 && reg != 7;
+			break;
+
+		case 0xde:
+			/* arithmetic and pop, FCOMPP has none */
+			sti_st0 = reg != 3;
+			break;
+
+		default:
+			if (reg == 4 && i == 0)
+				/* FNSTSW AX */
+			{
+				push_reg(ssde_operand::reg_gpr, 0, 16);
+			}
+
+			/* FUCOMIP and FCOMIP, the rest are aliases of ST(i) ones */
+			st0_sti = reg == 5 || reg == 6;
+			sti     = reg < 4;
+			break;
+		}
+
+		if (st0_sti)
+		{
+			push_reg(ssde_operand::reg_x87, 0, 80);
+			push_reg(ssde_operand::reg_x87, i, 80);
+		}
+		else if (sti_st0)
+		{
+			push_reg(ssde_operand::reg_x87, i, 80);
+			push_reg(ssde_operand::reg_x87, 0, 80);
+		}
+		else if (sti)
+		{
+			push_reg(ssde_operand::reg_x87, i, 80);
+		}
+	}
+
+	void port() const                       // Port of IN and OUT.
+	{
+		if (dis.has_imm)
+			push_imm(dis.imm, 8);
+		else
+			push_reg(ssde_operand::reg_gpr, 2, 16);
+	}
+
+	void push_moffs(uint16_t size) const
+	{
+		if (count == max_operands)
+			return;
+
+		ssde_operand &op = push();
+
+		op.type         = ssde_operand::type_mem;
+		op.size         = size;
+		op.segment      = dis.group2;
+		op.address_size = static_cast<uint8_t>(dis.imm_size * 8);
+		op.disp         = static_cast<int64_t>(dis.imm);
+	}
+
+	/* -- 0F xx ------------------------------------------------------------ */
+	void expand_0f() const
+	{
+		uint8_t op = dis.opcode2;
+		role    reg, rm, vex;
+		uint8_t order = order_reg_vex_rm;
+
+		if (!dis.has_modrm)
+		{
+			if (op >= 0xc8 && op <= 0xcf)
+				/* BSWAP */
+			{
+				push_reg(ssde_operand::reg_gpr, (op & 0x07) | ext_b, gpr_size());
+			}
+
+			immediates();
+			return;
+		}
+
+		if (dis.has_vex && ((op >= 0x41 && op <= 0x4b) || (op >= 0x90 && op <= 0x99)))
+			/* AVX-512 opmask instructions */
+		{
+			role k = make(ssde_operand::reg_mask);
+
+			switch (op)
+			{
+			case 0x90:
+				reg = k;
+				rm  = memory() ? make(ssde_operand::reg_mask, 0) : k;
+				break;
+
+			case 0x91:
+				reg   = k;
+				rm    = make(ssde_operand::reg_mask, 0);
+				order = order_rm_vex_reg;
+				break;
+
+			case 0x92:
+				reg = k;
+				rm  = make(ssde_operand::reg_gpr, dis.vex_w ? 64 : 32);
+				break;
+
+			case 0x93:
+				reg = make(ssde_operand::reg_gpr, dis.vex_w ? 64 : 32);
+				rm  = k;
+				break;
+
+			case 0x98:
+			case 0x99:
+				reg = k;
+				rm  = k;
+				break;
+
+			default:
+				reg = k;
+				rm  = k;
+				vex = k;
+				break;
+			}
+
+			layout(reg, rm, vex, order);
+			return;
+		}
+
+		if (vector_0f(op))
+		{
+			expand_0f_vector(op);
+			return;
+		}
+
+		switch (op)
+		{
+		case 0x00:
+			/* SLDT, STR, LLDT and so on */
+			rm = make(ssde_operand::reg_gpr, memory() ? 16 : gpr_size());
+			break;
+
+		case 0x01:
+			/* descriptor tables and such, register forms are other instructions */
+			if (memory())
+				rm = make(ssde_operand::reg_gpr, 0);
+			break;
+
+		case 0x02:
+		case 0x03:
+			/* LAR and LSL */
+			reg = gpr();
+			rm  = make(ssde_operand::reg_gpr, 16);
+			break;
+
+		case 0x0d:
+		case 0x18:
+			/* prefetches of the line a byte is in, the rest of 18 are hints */
+			rm = make(ssde_operand::reg_gpr, op == 0x0d || (dis.modrm_reg & 0x07) < 4 ? 8 : 32);
+			break;
+
+		case 0x19: case 0x1a: case 0x1b: case 0x1c:
+		case 0x1d: case 0x1e: case 0x1f:
+			/* hints and NOP, ENDBR32 and ENDBR64 have no operands */
+			if (!(op == 0x1e && dis.group1 == ssde_x86::p_repz && !memory() && (dis.modrm_reg & 0x07) == 0x07))
+				rm = gpr();
+			break;
+
+		case 0x20:
+		case 0x21:
+			/* MOV from a control or debug register */
+			reg   = make(op == 0x20 ? ssde_operand::reg_control : ssde_operand::reg_debug);
+			rm    = make(ssde_operand::reg_gpr, x64 ? 64 : 32);
+			order = order_rm_vex_reg;
+			break;
+
+		case 0x22:
+		case 0x23:
+			reg = make(op == 0x22 ? ssde_operand::reg_control : ssde_operand::reg_debug);
+			rm  = make(ssde_operand::reg_gpr, x64 ? 64 : 32);
+			break;
+
+		case 0x90: case 0x91: case 0x92: case 0x93:
+		case 0x94: case 0x95: case 0x96: case 0x97:
+		case 0x98: case 0x99: case 0x9a: case 0x9b:
+		case 0x9c: case 0x9d: case 0x9e: case 0x9f:
+			/* SETcc */
+			rm = make(ssde_operand::reg_gpr, 8);
+			break;
+
+		case 0xa3: case 0xab: case 0xb3: case 0xbb:
+		case 0xa4: case 0xa5: case 0xac: case 0xad:
+		case 0xc1: case 0xc3:
+			/* BT family, SHLD, SHRD, XADD and MOVNTI, rm is the destination */
+			reg   = gpr();
+			rm    = gpr();
+			order = order_rm_vex_reg;
+			break;
+
+		case 0xb0:
+		case 0xb1:
+		case 0xc0:
+			/* CMPXCHG and XADD */
+			reg   = gpr(op != 0xb1);
+			rm    = gpr(op != 0xb1);
+			order = order_rm_vex_reg;
+			break;
+
+		case 0xae:
+			/* FXSAVE and such, RDFSBASE and such with F3 */
+			if (memory())
+				rm = make(ssde_operand::reg_gpr, group15_size());
+			else if (dis.group1 == ssde_x86::p_repz)
+				rm = gpr();
+			break;
+
+		case 0xb2: case 0xb4: case 0xb5:
+			/* LSS, LFS and LGS, far pointers */
+			reg = gpr();
+			rm  = make(ssde_operand::reg_gpr, 0);
+			break;
+
+		case 0xb6: case 0xb7: case 0xbe: case 0xbf:
+			/* MOVZX and MOVSX */
+			reg = gpr();
+			rm  = make(ssde_operand::reg_gpr, op & 0x01 ? 16 : 8);
+			break;
+
+		case 0xba:
+			/* BT family with an immediate */
+			rm = gpr();
+			break;
+
+		case 0xc7:
+			/* CMPXCHG8B, CMPXCHG16B; RDRAND and RDSEED */
+			if (memory())
+				rm = make(ssde_operand::reg_gpr, x64 && dis.rex_w ? 128 : 64);
+			else
+				rm = gpr();
+			break;
+
+		default:
+			/* CMOVcc, IMUL, BSF, BSR, POPCNT, LZCNT, TZCNT and others of reg, rm */
+			reg = gpr();
+			rm  = gpr();
+			break;
+		}
+
+		layout(reg, rm, vex, order);
+
+		if (op == 0xa5 || op == 0xad)
+			/* SHLD and SHRD by CL */
+		{
+			push_reg(ssde_operand::reg_gpr, 1, 8);
+		}
+	}
+
+	static bool vector_0f(uint8_t op)
+	{
+		return (op >= 0x10 && op <= 0x17) ||
+		       (op >= 0x28 && op <= 0x2f) ||
+		       (op >= 0x50 && op <= 0x7f && op != 0x77 && op != 0x78 && op != 0x79) ||
+		       op == 0xc2 ||
+		       (op >= 0xc4 && op <= 0xc6) ||
+		       op >= 0xd0;
+	}
+
+	void expand_0f_vector(uint8_t op) const
+	{
+		bool mmx = !simd_prefix() &&
+		           ((op >= 0x60 && op <= 0x7f) || op >= 0xd0 || op == 0xc4 || op == 0xc5 ||
+		            op == 0x2a || op == 0x2c || op == 0x2d);
+
+		bool scalar = dis.group1 == ssde_x86::p_repz || dis.group1 == ssde_x86::p_repnz;
+
+		role    v     = mmx ? make(ssde_operand::reg_mmx) : vector();
+		role    reg   = v;
+		role    rm    = v;
+		role    vex   = v;
+		uint8_t order = order_reg_vex_rm;
+
+		if (scalar && ((op >= 0x10 && op <= 0x11) || (op >= 0x51 && op <= 0x5f && op != 0x5b) || op == 0xc2))
+			/* scalar single or double, of XMM registers whatever L rounding control leaves */
+		{
+			reg = make(ssde_operand::reg_xmm);
+			vex = reg;
+			rm  = scalar_rm(dis.group1 == ssde_x86::p_repz ? 32 : 64);
+		}
+		else if (memory() && (op == 0x2e || op == 0x2f))
+			/* UCOMISS, COMISS, UCOMISD and COMISD */
+		{
+			rm.size = dis.group3 == ssde_x86::p_66 ? 64 : 32;
+		}
+		else if (memory() && (((op & 0xfb) == 0x12 && !scalar) || (op & 0xfb) == 0x13 || op == 0xd6 ||
+		                      (op == 0x12 && dis.group1 == ssde_x86::p_repnz && length == 0)))
+			/* MOVLPS, MOVHPS, MOVLPD, MOVHPD, MOVDDUP and MOVQ of a half */
+		{
+			rm.size = 64;
+		}
+
+		if (dis.has_vex && dis.vex_size == 4 && (op == 0xc2 || (op >= 0x64 && op <= 0x66) || (op >= 0x74 && op <= 0x76)))
+			/* AVX-512 compares into an opmask */
+		{
+			reg = make(ssde_operand::reg_mask);
+		}
+
+		switch (op)
+		{
+		case 0x11: case 0x13: case 0x17: case 0x29: case 0x2b:
+		case 0x7f: case 0xd6: case 0xe7:
+			/* stores */
+			order = order_rm_vex_reg;
+			break;
+
+		case 0x2a:
+			/* CVTSI2SS and CVTSI2SD; CVTPI2PS and CVTPI2PD */
+			reg = scalar ? make(ssde_operand::reg_xmm) : vector();
+			vex = reg;
+			rm  = scalar ? gpr() : make(ssde_operand::reg_mmx);
+			break;
+
+		case 0x2c:
+		case 0x2d:
+			/* CVTTSS2SI and co; CVTTPS2PI and co */
+			reg = scalar ? make(ssde_operand::reg_gpr, x64 && dis.rex_w ? 64 : 32) : make(ssde_operand::reg_mmx);
+			rm  = scalar ? scalar_rm(dis.group1 == ssde_x86::p_repz ? 32 : 64) : make(ssde_operand::reg_xmm, memory() ? 64 : 128);
+			break;
+
+		case 0x5a:
+			if (!scalar && dis.group3 != ssde_x86::p_66)
+				/* CVTPS2PD, from a half */
+			{
+				rm = narrower(1);
+			}
+			else if (!scalar)
+				/* CVTPD2PS, into a half */
+			{
+				reg = half();
+			}
+			break;
+
+		case 0xe6:
+			if (dis.group1 == ssde_x86::p_repz)
+				/* CVTDQ2PD, from a half */
+			{
+				rm = narrower(1);
+			}
+			else if (simd_prefix())
+				/* CVTTPD2DQ and CVTPD2DQ, into a half */
+			{
+				reg = half();
+			}
+			break;
+
+		case 0xd1: case 0xd2: case 0xd3: case 0xe1: case 0xe2:
+		case 0xf1: case 0xf2: case 0xf3:
+			/* shifts by a count in the low quadword */
+			if (!mmx)
+				rm = make(ssde_operand::reg_xmm);
+			break;
+
+		case 0x50:
+		case 0xd7:
+			/* MOVMSKPS, MOVMSKPD and PMOVMSKB */
+			reg = make(ssde_operand::reg_gpr, x64 && dis.rex_w ? 64 : 32);
+			break;
+
+		case 0x6e:
+			/* MOVD and MOVQ from a general purpose register */
+			rm = make(ssde_operand::reg_gpr, x64 && dis.rex_w ? 64 : 32);
+			break;
+
+		case 0x7e:
+			if (dis.group1 == ssde_x86::p_repz)
+				/* MOVQ xmm, xmm/m64 */
+			{
+				rm.size = memory() ? 64 : rm.size;
+			}
+			else
+				/* MOVD and MOVQ to a general purpose register */
+			{
+				rm    = make(ssde_operand::reg_gpr, x64 && dis.rex_w ? 64 : 32);
+				order = order_rm_vex_reg;
+			}
+			break;
+
+		case 0x71:
+		case 0x72:
+		case 0x73:
+			/* shifts by an immediate, reg extends the opcode */
+			reg   = role();
+			order = order_vex_rm;
+			break;
+
+		case 0xc4:
+			/* PINSRW */
+			rm = make(ssde_operand::reg_gpr, memory() ? 16 : 32);
+			break;
+
+		case 0xc5:
+			/* PEXTRW */
+			reg = make(ssde_operand::reg_gpr, x64 && dis.rex_w ? 64 : 32);
+			break;
+
+		default:
+			break;
+		}
+
+		if (!vex_0f_nds(op))
+			vex = role();
+
+		layout(reg, rm, vex, order);
+	}
+
+	bool vex_0f_nds(uint8_t op) const       // Whether a VEX instruction of map 0F has vvvv.
+	{
+		bool scalar = dis.group1 == ssde_x86::p_repz || dis.group1 == ssde_x86::p_repnz;
+
+		switch (op)
+		{
+		case 0x10:
+		case 0x11:
+			/* MOVSS and MOVSD of registers merge */
+			return scalar && !memory();
+
+		case 0x12:
+		case 0x16:
+			/* MOVLPS, MOVHPS, MOVHLPS and MOVLHPS; MOVSLDUP, MOVSHDUP and MOVDDUP have none */
+			return !scalar;
+
+		case 0x51: case 0x52: case 0x53: case 0x5a:
+			return scalar;
+
+		case 0x13: case 0x17: case 0x28: case 0x29: case 0x2b: case 0x2c:
+		case 0x2d: case 0x2e: case 0x2f: case 0x50: case 0x5b: case 0x6e:
+		case 0x6f: case 0x70: case 0x7e: case 0x7f: case 0xc5: case 0xd6:
+		case 0xd7: case 0xe6: case 0xe7: case 0xf0: case 0xf7:
+			return false;
+
+		default:
+			return true;
+		}
+	}
+
+	/* -- 0F 38 xx --------------------------------------------------------- */
+	void expand_38() const
+	{
+		uint8_t op = dis.opcode3;
+		role    reg, rm, vex;
+		uint8_t order = order_reg_vex_rm;
+
+		if (!dis.has_modrm)
+		{
+			immediates();
+			return;
+		}
+
+		if (op >= 0xf0)
+			/* MOVBE, CRC32, BMI and ADX, all of general purpose registers */
+		{
+			reg = gpr();
+			rm  = gpr();
+			vex = gpr();
+
+			switch (op)
+			{
+			case 0xf0:
+			case 0xf1:
+				if (dis.group1 == ssde_x86::p_repnz)
+					/* CRC32, rm is as wide as 66 and REX.W tell */
+				{
+					reg = make(ssde_operand::reg_gpr, x64 && dis.rex_w ? 64 : 32);
+					rm  = gpr(op == 0xf0);
+				}
+				else if (op == 0xf1)
+					/* MOVBE to memory */
+				{
+					order = order_rm_vex_reg;
+				}
+				break;
+
+			case 0xf3:
+				/* BLSR, BLSMSK and BLSI, vvvv is the destination */
+				order = order_vex_rm;
+				break;
+
+			case 0xf5:
+				if (dis.group1 != ssde_x86::p_repz && dis.group1 != ssde_x86::p_repnz && dis.group3 != ssde_x86::p_66)
+					/* BZHI */
+				{
+					order = order_reg_rm_vex;
+				}
+				break;
+
+			case 0xf7:
+				/* BEXTR, SHLX, SARX and SHRX */
+				if (dis.has_vex)
+					order = order_reg_rm_vex;
+				break;
+
+			default:
+				break;
+			}
+
+			layout(reg, rm, vex, order);
+			return;
+		}
+
+		bool mmx = !simd_prefix() && op <= 0x1e;
+
+		role v = mmx ? make(ssde_operand::reg_mmx) : vector();
+
+		reg = v;
+		rm  = v;
+		vex = v;
+
+		bool evex = dis.has_vex && dis.vex_size == 4;
+
+		switch (op)
+		{
+		case 0x10: case 0x14: case 0x15:
+			if (!dis.has_vex)
+				/* BLENDVPS, BLENDVPD and PBLENDVB, XMM0 is implied */
+			{
+				layout(reg, rm, role(), order);
+				push_reg(ssde_operand::reg_xmm, 0, 128);
+				return;
+			}
+			break;
+
+		case 0x13:
+			/* VCVTPH2PS, from halves */
+			rm = narrower(1);
+			break;
+
+		case 0x18: case 0x19: case 0x58: case 0x59: case 0x78: case 0x79:
+			/* broadcasts of an element */
+			rm = make(ssde_operand::reg_xmm, memory() ? (op & 0x20 ? 8 << (op & 0x01) : 32 << (op & 0x01)) : 128);
+			break;
+
+		case 0x1a: case 0x5a:
+			/* broadcasts of 128 bits */
+			rm = make(ssde_operand::reg_xmm);
+			break;
+
+		case 0x1b: case 0x5b:
+			/* broadcasts of 256 bits */
+			rm = make(ssde_operand::reg_ymm);
+			break;
+
+		case 0x2d: case 0x43: case 0x4d: case 0x4f: case 0xcd:
+			/* VSCALEFSS, VGETEXPSS, VRCP14SS, VRSQRT14SS, VRSQRT28SS and their SD forms */
+			if (evex)
+			{
+				reg = make(ssde_operand::reg_xmm);
+				vex = reg;
+				rm  = scalar_rm(dis.vex_w ? 64 : 32);
+			}
+			break;
+
+		case 0x99: case 0x9b: case 0x9d: case 0x9f: case 0xa9: case 0xab:
+		case 0xad: case 0xaf: case 0xb9: case 0xbb: case 0xbd: case 0xbf:
+			/* scalar fused multiply-adds */
+			reg = make(ssde_operand::reg_xmm);
+			vex = reg;
+			rm  = scalar_rm(dis.vex_w ? 64 : 32);
+			break;
+
+		case 0x62: case 0x88: case 0x89:
+			/* expands, EVEX disp8 is in elements */
+			element = op == 0x62 ? (dis.vex_w ? 2 : 1) : (dis.vex_w ? 8 : 4);
+			break;
+
+		case 0x20: case 0x23: case 0x25: case 0x30: case 0x33: case 0x35:
+			/* PMOVSX and PMOVZX, from halves */
+			rm = narrower(1);
+			break;
+
+		case 0x21: case 0x24: case 0x31: case 0x34:
+			rm = narrower(2);
+			break;
+
+		case 0x22: case 0x32:
+			rm = narrower(3);
+			break;
+
+		case 0x26: case 0x27: case 0x29: case 0x37:
+			/* AVX-512 compares and tests into an opmask */
+			if (evex)
+				reg = make(ssde_operand::reg_mask);
+			break;
+
+		case 0x28: case 0x38:
+			/* VPMOVM2B and such */
+			if (evex && dis.group1 == ssde_x86::p_repz)
+				rm = make(ssde_operand::reg_mask);
+			break;
+
+		case 0x39:
+			/* VPMOVB2M and such */
+			if (evex && dis.group1 == ssde_x86::p_repz)
+				reg = make(ssde_operand::reg_mask);
+			break;
+
+		case 0x2e: case 0x2f: case 0x8e:
+			/* VMASKMOVPS, VMASKMOVPD and VPMASKMOV to memory */
+			order = order_rm_vex_reg;
+			break;
+
+		case 0x63: case 0x8a: case 0x8b:
+			/* compresses, EVEX disp8 is in elements */
+			element = op == 0x63 ? (dis.vex_w ? 2 : 1) : (dis.vex_w ? 8 : 4);
+			order   = order_rm_vex_reg;
+			break;
+
+		case 0x7a: case 0x7b: case 0x7c:
+			/* VPBROADCASTB, W, D and Q from a general purpose register */
+			rm = make(ssde_operand::reg_gpr, op == 0x7c && dis.vex_w ? 64 : 32);
+			break;
+
+		case 0x90: case 0x91: case 0x92: case 0x93:
+		case 0xa0: case 0xa1: case 0xa2: case 0xa3:
+			/* gathers, vvvv is the mask of VEX ones, and scatters */
+			vsib  = vector_class();
+			order = op < 0xa0 ? order_reg_rm_vex : order_rm_vex_reg;
+
+			if (!(op & 0x01) && dis.vex_w)
+				/* dword indices of qwords, half as many */
+			{
+				vsib = half().cls;
+			}
+			else if ((op & 0x01) && !dis.vex_w)
+				/* qword indices of dwords, half as many */
+			{
+				reg = half();
+				vex = half();
+			}
+			break;
+
+		case 0xc6: case 0xc7:
+			/* prefetches of gathers and scatters */
+			vsib = op == 0xc6 && dis.vex_w ? half().cls : vector_class();
+			break;
+
+		case 0xcb:
+			if (evex)
+				/* VRCP28SS and VRCP28SD */
+			{
+				reg = make(ssde_operand::reg_xmm);
+				vex = reg;
+				rm  = scalar_rm(dis.vex_w ? 64 : 32);
+				break;
+			}
+
+			/* SHA256RNDS2, XMM0 is implied */
+			layout(reg, rm, role(), order);
+			push_reg(ssde_operand::reg_xmm, 0, 128);
+			return;
+
+		default:
+			break;
+		}
+
+		if (memory() && vsib != none)
+			/* an element of those gathered or scattered */
+		{
+			rm.size = dis.vex_w ? 64 : 32;
+		}
+
+		if (!vex_38_nds(op))
+			vex = role();
+
+		layout(reg, rm, vex, order);
+	}
+
+	role narrower(unsigned shift) const     // Vector source of a conversion, 1 << shift times as narrow.
+	{
+		uint16_t bits = class_size(vector_class()) >> shift;
+
+		if (memory())
+			return make(ssde_operand::reg_xmm, bits);
+
+		return make(bits > 256 ? ssde_operand::reg_zmm : bits > 128 ? ssde_operand::reg_ymm : ssde_operand::reg_xmm);
+	}
+
+	role half() const                       // Register half as wide as the vector, of conversions.
+	{
+		return make(length == 2 ? ssde_operand::reg_ymm : ssde_operand::reg_xmm);
+	}
+
+	role scalar_rm(uint16_t size) const     // XMM register or size bits of memory, of scalar operations.
+	{
+		return make(ssde_operand::reg_xmm, memory() ? size : 128);
+	}
+
+	bool vex_38_nds(uint8_t op) const       // Whether a VEX instruction of map 0F 38 has vvvv.
+	{
+		switch (op)
+		{
+		case 0x0e: case 0x0f: case 0x13: case 0x17: case 0x18: case 0x19:
+		case 0x1a: case 0x1b: case 0x1c: case 0x1d: case 0x1e: case 0x1f:
+		case 0x2a: case 0x41: case 0x42: case 0x44: case 0x4c: case 0x4e:
+		case 0x54: case 0x55: case 0x58: case 0x59: case 0x5a: case 0x5b:
+		case 0x62: case 0x63: case 0x78: case 0x79: case 0x7a: case 0x7b:
+		case 0x7c: case 0x88: case 0x89: case 0x8a: case 0x8b: case 0xa0:
+		case 0xa1: case 0xa2: case 0xa3: case 0xc4: case 0xc6: case 0xc7:
+		case 0xc8: case 0xca: case 0xcc: case 0xdb:
+			return false;
+
+		case 0x28: case 0x29: case 0x38: case 0x39:
+			/* VPMOVM2B, VPMOVB2M and such have none */
+			return dis.group1 != ssde_x86::p_repz;
+
+		case 0x90: case 0x91: case 0x92: case 0x93:
+			/* VEX gathers have a mask in vvvv, EVEX ones don't */
+			return dis.vex_size != 4;
+
+		default:
+			/* PMOVSX and PMOVZX */
+			return !((op >= 0x20 && op <= 0x25) || (op >= 0x30 && op <= 0x35));
+		}
+	}
+
+	/* -- 0F 3A xx --------------------------------------------------------- */
+	void expand_3a() const
+	{
+		uint8_t op = dis.opcode3;
+		role    reg, rm, vex;
+		uint8_t order = order_reg_vex_rm;
+
+		if (!dis.has_modrm)
+		{
+			immediates();
+			return;
+		}
+
+		if (op == 0xf0)
+			/* RORX */
+		{
+			layout(gpr(), gpr(), role(), order);
+			return;
+		}
+
+		bool mmx = !simd_prefix() && op == 0x0f;
+
+		role v = mmx ? make(ssde_operand::reg_mmx) : vector();
+
+		reg = v;
+		rm  = v;
+		vex = v;
+
+		switch (op)
+		{
+		case 0x1e: case 0x1f: case 0x3e: case 0x3f: case 0x66:
+			/* AVX-512 compares and classes into an opmask */
+			if (dis.has_vex && dis.vex_size == 4)
+				reg = make(ssde_operand::reg_mask);
+			break;
+
+		case 0x67:
+			/* VFPCLASSSS and VFPCLASSSD */
+			reg = make(ssde_operand::reg_mask);
+			rm  = scalar_rm(dis.vex_w ? 64 : 32);
+			break;
+
+		case 0x14:
+		case 0x15:
+		case 0x16:
+		case 0x17:
+			/* PEXTRB, PEXTRW, PEXTRD, PEXTRQ and EXTRACTPS */
+			reg   = make(ssde_operand::reg_xmm);
+			rm    = memory() ? make(ssde_operand::reg_gpr, op == 0x14 ? 8 : op == 0x15 ? 16 : x64 && dis.rex_w ? 64 : 32) :
+			                   make(ssde_operand::reg_gpr, x64 && dis.rex_w && op == 0x16 ? 64 : 32);
+			order = order_rm_vex_reg;
+			break;
+
+		case 0x1d:
+			/* VCVTPS2PH, into halves */
+			rm    = narrower(1);
+			order = order_rm_vex_reg;
+			break;
+
+		case 0x0a: case 0x0b:
+			/* ROUNDSS and ROUNDSD, VRNDSCALESS and VRNDSCALESD */
+			reg = make(ssde_operand::reg_xmm);
+			vex = reg;
+			rm  = scalar_rm(op == 0x0a ? 32 : 64);
+			break;
+
+		case 0x27: case 0x51: case 0x55: case 0x57:
+			/* VGETMANTSS, VRANGESS, VFIXUPIMMSS, VREDUCESS and their SD forms */
+			reg = make(ssde_operand::reg_xmm);
+			vex = reg;
+			rm  = scalar_rm(dis.vex_w ? 64 : 32);
+			break;
+
+		case 0x19: case 0x1b: case 0x39: case 0x3b:
+			/* extracts of a part of a vector */
+			rm    = make(length == 2 && (op == 0x1b || op == 0x3b) ? ssde_operand::reg_ymm : ssde_operand::reg_xmm);
+			order = order_rm_vex_reg;
+			break;
+
+		case 0x18: case 0x1a: case 0x38: case 0x3a:
+			/* inserts of a part of a vector */
+			rm = make(length == 2 && (op == 0x1a || op == 0x3a) ? ssde_operand::reg_ymm : ssde_operand::reg_xmm);
+			break;
+
+		case 0x20:
+			/* PINSRB */
+			rm = make(ssde_operand::reg_gpr, memory() ? 8 : 32);
+			break;
+
+		case 0x21:
+			/* INSERTPS */
+			rm = make(ssde_operand::reg_xmm, memory() ? 32 : 128);
+			break;
+
+		case 0x22:
+			/* PINSRD and PINSRQ */
+			rm = make(ssde_operand::reg_gpr, x64 && dis.rex_w ? 64 : 32);
+			break;
+
+		default:
+			break;
+		}
+
+		if (!vex_3a_nds(op))
+			vex = role();
+
+		if (dis.has_vex && dis.vex_size != 4 && op >= 0x4a && op <= 0x4c)
+			/* VBLENDVPS, VBLENDVPD and VPBLENDVB, the 4th register is in the immediate */
+		{
+			layout(reg, rm, vex, order);
+
+			if (count != 0 && list[count - 1].type == ssde_operand::type_imm)
+			{
+				ssde_operand &is4 = list[count - 1];
+
+				uint8_t reg4 = static_cast<uint8_t>(is4.value >> 4 & (x64 ? 0x0f : 0x07));
+
+				is4           = ssde_operand();
+				is4.type      = ssde_operand::type_reg;
+				is4.reg_class = vector_class();
+				is4.reg       = reg4;
+				is4.size      = class_size(vector_class());
+			}
+
+			return;
+		}
+
+		layout(reg, rm, vex, order);
+	}
+
+	bool vex_3a_nds(uint8_t op) const       // Whether a VEX instruction of map 0F 3A has vvvv.
+	{
+		switch (op)
+		{
+		case 0x00: case 0x01: case 0x04: case 0x05: case 0x08: case 0x09:
+		case 0x14: case 0x15: case 0x16: case 0x17: case 0x19: case 0x1b:
+		case 0x1d: case 0x26: case 0x39: case 0x3b: case 0x56: case 0x60:
+		case 0x61: case 0x62: case 0x63: case 0x66: case 0x67: case 0xdf:
+			return false;
+
+		default:
+			return true;
+		}
+	}
+
+	const arch &dis;
+
+	mutable bool         expanded  = false; // Whether list is filled in.
+	mutable uint8_t      count     = 0;     // Operands in list.
+	mutable ssde_operand list[max_operands];
+
+	mutable uint8_t      ext_r     = 0;     // REX.R, VEX.R or EVEX.R as bit 3 of reg.
+	mutable uint8_t      ext_x     = 0;     // Same for the SIB index.
+	mutable uint8_t      ext_b     = 0;     // Same for rm and the SIB base.
+	mutable uint8_t      ext_rr    = 0;     // EVEX.R' as bit 4 of a vector reg.
+	mutable uint8_t      ext_xx    = 0;     // EVEX.X as bit 4 of a vector rm.
+	mutable uint8_t      ext_v     = 0;     // EVEX.V' as bit 4 of vvvv and of a VSIB index.
+	mutable uint8_t      vvvv      = 0;     // VEX register specifier, bits 0-3.
+	mutable uint8_t      length    = 0;     // VEX L.
+	mutable uint8_t      vsib      = none;  // Class of the vector index of VSIB memory, none if it isn't.
+	mutable uint8_t      element   = 0;     // Bytes EVEX disp8 is in units of, 0 if it's the size of memory.
+	mutable bool         broadcast = false; // EVEX memory is one element broadcast.
+};
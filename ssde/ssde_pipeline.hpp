@@ -0,0 +1,544 @@
+/*
+* The SSDE header file for decoding in stages connected by queues.
+* Copyright (C) 2015, Constantine Shablya. See Copyright Notice in LICENSE.md
+*/
+#pragma once
+#include "ssde.hpp"
+#include "ssde_stream.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+/* stages can be run as coroutines as well, see ssde_task */
+#define SSDE_COROUTINES
+#include <coroutine>
+#include <exception>
+#endif
+#endif
+
+
+/*
+* Decoded instruction as it is passed between stages: the instruction,
+* its address and its bytes (length of them, the rest is zero), 56 bytes.
+*/
+struct ssde_record
+{
+	ssde_insn insn;                         // The instruction.
+	uint64_t  address;                      // Its address.
+	uint8_t   bytes[16];                    // Its bytes.
+};
+
+
+/*
+* Bounded lock-free queue of T between one producer thread and one
+* consumer thread. Capacity is rounded up to a power of two. Neither side
+* ever waits, push() and pop() move as many items as there are room or
+* items for. The producer closes the queue once it's done.
+*/
+template <class T>
+class ssde_spsc
+{
+public:
+	explicit ssde_spsc(size_t capacity) :
+		mask(round_capacity(capacity) - 1),
+		slots(new T[mask + 1])
+	{
+	}
+
+	/*
+	* Producer side, appends up to n items and returns how many.
+	*/
+	size_t push(const T *items, size_t n)
+	{
+		size_t tail = write.load(std::memory_order_relaxed);
+
+		if (mask + 1 - (tail - read_cache) < n)
+			/* looks full, see how far the consumer got */
+		{
+			read_cache = read.load(std::memory_order_acquire);
+		}
+
+		n = std::min(n, mask + 1 - (tail - read_cache));
+
+		for (size_t i = 0; i < n; ++i)
+			slots[(tail + i) & mask] = items[i];
+
+		write.store(tail + n, std::memory_order_release);
+
+		return n;
+	}
+
+	/*
+	* Consumer side, takes up to n items and returns how many.
+	*/
+	size_t pop(T *items, size_t n)
+	{
+		size_t head = read.load(std::memory_order_relaxed);
+
+		if (write_cache - head < n)
+			/* looks empty, see how far the producer got */
+		{
+			write_cache = write.load(std::memory_order_acquire);
+		}
+
+		n = std::min(n, write_cache - head);
+
+		for (size_t i = 0; i < n; ++i)
+			items[i] = slots[(head + i) & mask];
+
+		read.store(head + n, std::memory_order_release);
+
+		return n;
+	}
+
+	bool push(const T &item)                // Producer side, appends item unless full.
+	{
+		return push(&item, 1) == 1;
+	}
+
+	bool pop(T &item)                       // Consumer side, takes an item unless empty.
+	{
+		return pop(&item, 1) == 1;
+	}
+
+	void close()                            // Producer side, no more items are coming.
+	{
+		closing.store(true, std::memory_order_release);
+	}
+
+	/*
+	* Consumer side, whether the queue is closed and every item taken.
+	*/
+	bool drained()
+	{
+		if (!closing.load(std::memory_order_acquire))
+			return false;
+
+		/* items pushed before close() are visible by now */
+		write_cache = write.load(std::memory_order_acquire);
+
+		return write_cache == read.load(std::memory_order_relaxed);
+	}
+
+	size_t capacity() const
+	{
+		return mask + 1;
+	}
+
+private:
+	static size_t round_capacity(size_t n)
+	{
+		size_t capacity = 1;
+
+		while (capacity < n)
+			capacity *= 2;
+
+		return capacity;
+	}
+
+	/* each side's index on a cache line of its own, with a copy of the other's */
+	std::atomic<size_t> write{0};           // Items pushed so far.
+	size_t              read_cache = 0;     // Producer's copy of read.
+	char                write_pad[64];
+
+	std::atomic<size_t> read{0};            // Items taken so far.
+	size_t              write_cache = 0;    // Consumer's copy of write.
+	char                read_pad[64];
+
+	std::atomic<bool>    closing{false};
+	size_t               mask;
+	std::unique_ptr<T[]> slots;
+};
+
+
+#if defined(SSDE_COROUTINES)
+/*
+* Coroutine running a pipeline stage, suspended each time the stage can't
+* make progress. Nothing resumes it but resume(), so stages of a pipeline
+* can be interleaved on one thread (see ssde_pipeline::run_coroutines())
+* or driven by any other scheduler.
+*/
+class ssde_task
+{
+public:
+	struct promise_type
+	{
+		ssde_task get_return_object()
+		{
+			return ssde_task(std::coroutine_handle<promise_type>::from_promise(*this));
+		}
+
+		std::suspend_always initial_suspend() noexcept { return {}; }
+		std::suspend_always final_suspend() noexcept { return {}; }
+
+		void return_void() {}
+		void unhandled_exception() { std::terminate(); }
+	};
+
+	ssde_task(ssde_task &&from) noexcept :
+		handle(from.handle)
+	{
+		from.handle = nullptr;
+	}
+
+	~ssde_task()
+	{
+		if (handle)
+			handle.destroy();
+	}
+
+	bool resume()                           // Runs the stage up to its next stop, false once it's done.
+	{
+		if (!handle.done())
+			handle.resume();
+
+		return !handle.done();
+	}
+
+private:
+	explicit ssde_task(std::coroutine_handle<promise_type> handle) :
+		handle(handle)
+	{
+	}
+
+	std::coroutine_handle<promise_type> handle;
+};
+#endif
+
+
+/*
+* Decoding split into three stages connected by ssde_spsc queues:
+*
+*   - I/O, which reads code into a pool of chunks (read()) or, for code
+*     already in memory such as a mapped file, hands out parts of it
+*     after touching their pages so that they fault in ahead of the
+*     decoder (view())
+*   - decoding of the chunks with an ssde_stream, instructions running
+*     over the end of a chunk included
+*   - consumption of ssde_record, by a callback
+*
+* Each stage is to be run on a thread of its own, run() does that. With
+* C++20 they can be coroutines instead (the *_task() functions), driven
+* on one thread by run_coroutines() or by any other scheduler. Each stage
+* is also a step function doing a bit of work and telling whether it got
+* anywhere, for stages to be driven by hand.
+*
+* A source is called as source(buffer, size) and returns the number of
+* bytes it put into buffer, 0 at the end. A sink is called as
+* sink(record) for each instruction, in order.
+*/
+template <class arch>
+class ssde_pipeline
+{
+public:
+	enum : size_t { batch = 256 };          // Records moved between stages at once.
+
+	/*
+	* Results of step functions.
+	*/
+	enum : int
+	{
+		step_busy = 0,                      // Got some work done.
+		step_idle = 1,                      // Waiting for another stage.
+		step_done = 2                       // Finished.
+	};
+
+	/*
+	* base is the address of the first byte of code. chunks chunks of
+	* chunk_size bytes are read ahead of the decoder at most, records
+	* decoded ahead of the consumer.
+	*/
+	explicit ssde_pipeline(uint64_t base = 0, size_t chunk_size = 64*1024, size_t chunks = 8, size_t records = 16*1024) :
+		chunk_size(chunk_size),
+		pool(new uint8_t[chunk_size * chunks]),
+		filled(chunks),
+		spare(chunks),
+		records(records),
+		stream(base)
+	{
+		for (size_t i = 0; i < chunks; ++i)
+			spare.push(i);
+	}
+
+	/* -- I/O stage -------------------------------------------------------- */
+	template <class source>
+	int read_step(source &src)
+	{
+		size_t slot;
+
+		if (!spare.pop(slot))
+			return step_idle;
+
+		uint8_t *buffer = pool.get() + slot * chunk_size;
+
+		size_t n = src(buffer, chunk_size);
+
+		if (n == 0)
+		{
+			filled.close();
+			return step_done;
+		}
+
+		chunk c = { buffer, n, slot };
+		filled.push(c);
+
+		return step_busy;
+	}
+
+	/*
+	* I/O stage for code at data, size bytes of it. Doesn't copy, the code
+	* has to stay there until the pipeline is done.
+	*/
+	int view_step(const uint8_t *data, size_t size)
+	{
+		if (viewed >= size)
+		{
+			filled.close();
+			return step_done;
+		}
+
+		chunk c = { data + viewed, std::min(chunk_size, size - viewed), none };
+
+		/* fault the pages in, the decoder is on chunks before this one */
+		volatile uint8_t touch = 0;
+
+		for (size_t at = 0; at < c.size; at += 4096)
+			touch = c.data[at];
+
+		(void)touch;
+
+		if (!filled.push(c))
+			return step_idle;
+
+		viewed += c.size;
+
+		return step_busy;
+	}
+
+	/* -- decoding stage --------------------------------------------------- */
+	int decode_step()
+	{
+		if (sent < decoded)
+			/* what the consumer had no room for last time */
+		{
+			sent += records.push(out + sent, decoded - sent);
+
+			if (sent < decoded)
+				return step_idle;
+		}
+
+		sent = decoded = 0;
+
+		if (ended)
+		{
+			records.close();
+			return step_done;
+		}
+
+		if (!active)
+		{
+			if (filled.pop(current))
+			{
+				stream.feed(current.data, current.size);
+				active = true;
+			}
+			else if (filled.drained())
+			{
+				stream.finish();
+				active = true;
+				draining = true;
+			}
+			else
+			{
+				return step_idle;
+			}
+		}
+
+		bool more = true;
+
+		while (decoded < batch && (more = stream.dec()))
+		{
+			const arch &insn = stream.insn();
+			ssde_record &r = out[decoded++];
+
+			size_t n = std::min<size_t>(std::min<size_t>(insn.length, insn.size() - insn.ip), 16);
+
+			r.insn    = insn;
+			r.address = stream.address();
+
+			memset(r.bytes, 0, sizeof(r.bytes));
+			memcpy(r.bytes, insn.data() + insn.ip, n);
+		}
+
+		if (!more)
+			/* the chunk is used up, what's left of it is in the stash */
+		{
+			if (draining)
+				ended = true;
+			else if (current.slot != none)
+				spare.push(current.slot);
+
+			active = false;
+		}
+
+		sent = records.push(out, decoded);
+
+		return step_busy;
+	}
+
+	/* -- consuming stage -------------------------------------------------- */
+	template <class sink>
+	int consume_step(sink &f)
+	{
+		size_t n = records.pop(in, batch);
+
+		if (n == 0)
+			return records.drained() ? step_done : step_idle;
+
+		for (size_t i = 0; i < n; ++i)
+			f(static_cast<const ssde_record &>(in[i]));
+
+		return step_busy;
+	}
+
+	/* -- stages on threads ------------------------------------------------ */
+	template <class source>
+	void read(source src)
+	{
+		loop([&]() { return read_step(src); });
+	}
+
+	void view(const uint8_t *data, size_t size)
+	{
+		loop([&]() { return view_step(data, size); });
+	}
+
+	void decode()
+	{
+		loop([&]() { return decode_step(); });
+	}
+
+	template <class sink>
+	void consume(sink f)
+	{
+		loop([&]() { return consume_step(f); });
+	}
+
+	/*
+	* Reads and decodes on threads of their own, consumes on the calling
+	* one. A pipeline is run once.
+	*/
+	template <class source, class sink>
+	void run(source src, sink f)
+	{
+		std::thread reader([&]() { read(src); });
+		std::thread decoder([&]() { decode(); });
+
+		consume(f);
+
+		decoder.join();
+		reader.join();
+	}
+
+	template <class sink>
+	void run(const uint8_t *data, size_t size, sink f)
+	{
+		std::thread reader([&]() { view(data, size); });
+		std::thread decoder([&]() { decode(); });
+
+		consume(f);
+
+		decoder.join();
+		reader.join();
+	}
+
+#if defined(SSDE_COROUTINES)
+	/* -- stages as coroutines --------------------------------------------- */
+	template <class source>
+	ssde_task read_task(source src)
+	{
+		while (read_step(src) != step_done)
+			co_await std::suspend_always();
+	}
+
+	ssde_task view_task(const uint8_t *data, size_t size)
+	{
+		while (view_step(data, size) != step_done)
+			co_await std::suspend_always();
+	}
+
+	ssde_task decode_task()
+	{
+		while (decode_step() != step_done)
+			co_await std::suspend_always();
+	}
+
+	template <class sink>
+	ssde_task consume_task(sink f)
+	{
+		while (consume_step(f) != step_done)
+			co_await std::suspend_always();
+	}
+
+	/*
+	* All three stages as coroutines, taking turns on the calling thread.
+	*/
+	template <class source, class sink>
+	void run_coroutines(source src, sink f)
+	{
+		ssde_task stages[] = { read_task(src), decode_task(), consume_task(f) };
+
+		for (bool running = true; running; )
+		{
+			running = false;
+
+			for (ssde_task &stage : stages)
+				running |= stage.resume();
+		}
+	}
+#endif
+
+private:
+	enum : size_t { none = ~size_t(0) };    // Slot of chunks not in the pool.
+
+	struct chunk
+	{
+		const uint8_t *data;
+		size_t         size;
+		size_t         slot;                // Index in the pool, none for views.
+	};
+
+	template <class step>
+	static void loop(step s)                // Runs a stage to its end, yielding while it waits.
+	{
+		for (int state; (state = s()) != step_done; )
+		{
+			if (state == step_idle)
+				std::this_thread::yield();
+		}
+	}
+
+	size_t                     chunk_size;
+	std::unique_ptr<uint8_t[]> pool;        // Chunks read() reads into.
+	size_t                     viewed = 0;  // Bytes handed out by view().
+
+	ssde_spsc<chunk>           filled;      // Chunks to decode, I/O to decoding.
+	ssde_spsc<size_t>          spare;       // Slots decoded, decoding to I/O.
+	ssde_spsc<ssde_record>     records;     // Instructions, decoding to consuming.
+
+	ssde_stream<arch>          stream;
+	chunk                      current = { nullptr, 0, none }; // Chunk being decoded.
+	bool                       active   = false; // Whether stream is on current.
+	bool                       draining = false; // Whether stream is on its stash, after the last chunk.
+	bool                       ended    = false; // Whether every instruction is decoded.
+
+	ssde_record                out[batch];  // Decoded, not yet pushed.
+	size_t                     decoded = 0; // Records in out.
+	size_t                     sent    = 0; // Records of out pushed.
+
+	ssde_record                in[batch];   // Taken by the consumer.
+};
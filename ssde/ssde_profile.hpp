@@ -0,0 +1,353 @@
+/*
+* The SSDE header file for instrumentation of the decoders.
+* Copyright (C) 2015, Constantine Shablya. See Copyright Notice in LICENSE.md
+*/
+#pragma once
+#include "ssde.hpp"
+
+
+/*
+* Instrumentation is off unless SSDE_PROFILE is defined, then dec() and
+* decode() count what they come across (prefix bytes, VEX, table lookups
+* per opcode map, operands, each kind of error) into counters of the
+* thread decoding. SSDE_PROFILE_TSC in addition times the decoder stages
+* with the time stamp counter of X86 CPUs. ssde_profile::collect() merges
+* counters of all threads, e.g.:
+*
+*   g++ -DSSDE_PROFILE ...
+*
+*   ssde_counters counters = ssde_profile::collect();
+*
+*   counters.count[ssde_counters::event_evex] / counters.count[ssde_counters::event_instructions]
+*
+* Either has to be defined (or not) for every file using SSDE alike.
+* When off, the macros expand to nothing and nothing else is declared.
+*/
+#if defined(SSDE_PROFILE)
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+
+#if defined(SSDE_PROFILE_TSC)
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#error "SSDE_PROFILE_TSC needs an X86 CPU"
+#endif
+#endif
+
+
+/*
+* Counters of the decoders, summed over threads.
+*/
+struct ssde_counters
+{
+	enum : unsigned
+	{
+		event_instructions,                 // Instructions decoded.
+		event_prefix_bytes,                 // Legacy and REX prefix bytes.
+		event_rex,                          // Instructions with REX.
+		event_vex2,                         // 2 byte VEX (C5).
+		event_vex3,                         // 3 byte VEX (C4).
+		event_evex,                         // EVEX (62).
+		event_map_1,                        // Lookups in the one byte opcode table.
+		event_map_0f,                       // Lookups in the 0F table.
+		event_map_0f38,                     // Lookups in the 0F 38 table.
+		event_map_0f3a,                     // Lookups in the 0F 3A table.
+		event_modrm,                        // Mod R/M bytes.
+		event_sib,                          // SIB bytes.
+		event_disp,                         // Displacements.
+		event_imm,                          // Immediates and moffs.
+		event_imm2,                         // Second immediates.
+		event_rel,                          // Relative addresses.
+		event_error_opcode,                 // Instructions with error_opcode, and so on.
+		event_error_operand,
+		event_error_length,
+		event_error_lock,
+		event_error_novex,
+		event_error_truncated,
+
+		events
+	};
+
+	enum : unsigned
+	{
+		stage_prefixes,                     // decode_prefixes().
+		stage_opcode,                       // decode_opcode(), VEX included.
+		stage_modrm,                        // Flow control class, Mod R/M, SIB and displacement.
+		stage_imm,                          // decode_imm().
+
+		stages
+	};
+
+	uint64_t count[events]  = {};           // Events, event_*.
+	uint64_t cycles[stages] = {};           // Time stamp counter cycles spent in each stage_*, with SSDE_PROFILE_TSC.
+
+	void merge(const ssde_counters &other)
+	{
+		for (unsigned i = 0; i < events; ++i)
+			count[i] += other.count[i];
+
+		for (unsigned i = 0; i < stages; ++i)
+			cycles[i] += other.cycles[i];
+	}
+
+	static const char *event_name(unsigned event)
+	{
+		static const char *const names[events] =
+		{
+			"instructions", "prefix_bytes", "rex", "vex2", "vex3", "evex",
+			"map_1", "map_0f", "map_0f38", "map_0f3a",
+			"modrm", "sib", "disp", "imm", "imm2", "rel",
+			"error_opcode", "error_operand", "error_length", "error_lock", "error_novex", "error_truncated"
+		};
+
+		return event < events ? names[event] : "";
+	}
+
+	static const char *stage_name(unsigned stage)
+	{
+		static const char *const names[stages] = { "prefixes", "opcode", "modrm", "imm" };
+
+		return stage < stages ? names[stage] : "";
+	}
+};
+
+
+/*
+* Per thread counters. Each thread writes its own, relaxed atomics are
+* plain loads and stores on X86, so counting costs about as much as an
+* increment. Counters of threads that are gone are kept in the registry.
+*/
+class ssde_profile
+{
+public:
+	static void add(unsigned event, uint64_t n = 1)
+	{
+		bump(local().count[event], n);
+	}
+
+	static void add_cycles(unsigned stage, uint64_t n)
+	{
+		bump(local().cycles[stage], n);
+	}
+
+	/*
+	* Counts everything of an instruction just decoded.
+	*/
+	static void count(const ssde_insn &insn)
+	{
+		slot &s = local();
+
+		bump(s.count[ssde_counters::event_instructions]);
+
+		if (insn.has_rex)
+			bump(s.count[ssde_counters::event_rex]);
+
+		if (insn.has_vex)
+			bump(s.count[insn.vex_size == 4 ? ssde_counters::event_evex :
+			             insn.vex_size == 3 ? ssde_counters::event_vex3 : ssde_counters::event_vex2]);
+
+		if (insn.opcode1 != 0x0f)
+			bump(s.count[ssde_counters::event_map_1]);
+		else if (insn.opcode2 == 0x38)
+			bump(s.count[ssde_counters::event_map_0f38]);
+		else if (insn.opcode2 == 0x3a)
+			bump(s.count[ssde_counters::event_map_0f3a]);
+		else
+			bump(s.count[ssde_counters::event_map_0f]);
+
+		if (insn.has_modrm)
+			bump(s.count[ssde_counters::event_modrm]);
+
+		if (insn.has_sib)
+			bump(s.count[ssde_counters::event_sib]);
+
+		if (insn.has_disp)
+			bump(s.count[ssde_counters::event_disp]);
+
+		if (insn.has_imm)
+			bump(s.count[ssde_counters::event_imm]);
+
+		if (insn.has_imm2)
+			bump(s.count[ssde_counters::event_imm2]);
+
+		if (insn.has_rel)
+			bump(s.count[ssde_counters::event_rel]);
+
+		if (insn.error)
+			/* rare, the rest of the flags are only looked at then */
+		{
+			if (insn.error_opcode)
+				bump(s.count[ssde_counters::event_error_opcode]);
+
+			if (insn.error_operand)
+				bump(s.count[ssde_counters::event_error_operand]);
+
+			if (insn.error_length)
+				bump(s.count[ssde_counters::event_error_length]);
+
+			if (insn.error_lock)
+				bump(s.count[ssde_counters::event_error_lock]);
+
+			if (insn.error_novex)
+				bump(s.count[ssde_counters::event_error_novex]);
+
+			if (insn.error_truncated)
+				bump(s.count[ssde_counters::event_error_truncated]);
+		}
+	}
+
+#if defined(SSDE_PROFILE_TSC)
+	static uint64_t clock()
+	{
+		return __rdtsc();
+	}
+
+	/*
+	* Adds cycles from since to now to stage, since becomes now.
+	*/
+	static void lap(unsigned stage, uint64_t &since)
+	{
+		uint64_t now = clock();
+
+		add_cycles(stage, now - since);
+		since = now;
+	}
+#endif
+
+	/*
+	* Sum of counters of all threads, those alive and those gone. Counts
+	* of instructions being decoded while collecting may be missed.
+	*/
+	static ssde_counters collect()
+	{
+		registry &r = shared();
+
+		std::lock_guard<std::mutex> lock(r.lock);
+
+		ssde_counters sum = r.retired;
+
+		for (const slot *s : r.live)
+			sum.merge(s->snapshot());
+
+		return sum;
+	}
+
+	/*
+	* Zeroes counters of all threads.
+	*/
+	static void reset()
+	{
+		registry &r = shared();
+
+		std::lock_guard<std::mutex> lock(r.lock);
+
+		r.retired = ssde_counters();
+
+		for (slot *s : r.live)
+			s->clear();
+	}
+
+private:
+	struct slot
+	{
+		std::atomic<uint64_t> count[ssde_counters::events];
+		std::atomic<uint64_t> cycles[ssde_counters::stages];
+
+		slot()
+		{
+			clear();
+
+			registry &r = shared();
+
+			std::lock_guard<std::mutex> lock(r.lock);
+
+			r.live.push_back(this);
+		}
+
+		~slot()
+		{
+			registry &r = shared();
+
+			std::lock_guard<std::mutex> lock(r.lock);
+
+			r.retired.merge(snapshot());
+			r.live.erase(std::find(r.live.begin(), r.live.end(), this));
+		}
+
+		ssde_counters snapshot() const
+		{
+			ssde_counters counters;
+
+			for (unsigned i = 0; i < ssde_counters::events; ++i)
+				counters.count[i] = count[i].load(std::memory_order_relaxed);
+
+			for (unsigned i = 0; i < ssde_counters::stages; ++i)
+				counters.cycles[i] = cycles[i].load(std::memory_order_relaxed);
+
+			return counters;
+		}
+
+		void clear()
+		{
+			for (auto &c : count)
+				c.store(0, std::memory_order_relaxed);
+
+			for (auto &c : cycles)
+				c.store(0, std::memory_order_relaxed);
+		}
+	};
+
+	struct registry
+	{
+		std::mutex          lock;
+		std::vector<slot *> live;           // Counters of threads alive.
+		ssde_counters       retired;        // Sum of counters of threads gone.
+	};
+
+	static void bump(std::atomic<uint64_t> &counter, uint64_t n = 1)
+	{
+		/* only the owning thread writes, so this needn't be a locked add */
+		counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+	}
+
+	static registry &shared()
+	{
+		static registry r;
+
+		return r;
+	}
+
+	static slot &local()
+	{
+		thread_local slot s;
+
+		return s;
+	}
+};
+
+
+#define SSDE_PROFILE_ADD(event, n)  ssde_profile::add(ssde_counters::event, n)
+#define SSDE_PROFILE_INSN(insn)     ssde_profile::count(insn)
+
+#if defined(SSDE_PROFILE_TSC)
+#define SSDE_PROFILE_START()        uint64_t ssde_profile_since = ssde_profile::clock()
+#define SSDE_PROFILE_STAGE(stage)   ssde_profile::lap(ssde_counters::stage, ssde_profile_since)
+#else
+#define SSDE_PROFILE_START()        ((void)0)
+#define SSDE_PROFILE_STAGE(stage)   ((void)0)
+#endif
+
+#else
+
+#define SSDE_PROFILE_ADD(event, n)  ((void)0)
+#define SSDE_PROFILE_INSN(insn)     ((void)0)
+#define SSDE_PROFILE_START()        ((void)0)
+#define SSDE_PROFILE_STAGE(stage)   ((void)0)
+
+#endif
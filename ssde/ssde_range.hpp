@@ -0,0 +1,260 @@
+/*
+* The SSDE header file for instruction ranges usable with <algorithm>.
+* Copyright (C) 2015, Constantine Shablya. See Copyright Notice in LICENSE.md
+*/
+#pragma once
+#include "ssde.hpp"
+#include "ssde_sweep.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+
+/*
+* Forward iterator over instructions, as a linear sweep goes through them.
+* Dereferencing gives the disassembler, decoded at the instruction (value
+* type is ssde_insn, copying one out slices it). Instructions are decoded
+* on first use, so iterators that are only compared or copied are cheap.
+* An iterator at or past its limit is the end. Iterators decode the code
+* in place, it has to outlive them (as the ssde_range they come from).
+*/
+template <class arch>
+class ssde_iterator
+{
+public:
+	typedef std::forward_iterator_tag iterator_category;
+	typedef ssde_insn                 value_type;
+	typedef ptrdiff_t                 difference_type;
+	typedef const arch               *pointer;
+	typedef const arch               &reference;
+
+	ssde_iterator() :
+		dis(ssde_image(nullptr, 0)),
+		limit(0)
+	{
+	}
+
+	ssde_iterator(const arch &code, size_t ip, size_t limit) :
+		dis(ssde_image(code.data(), code.size(), code.base_address()), std::min(ip, limit)),
+		limit(limit)
+	{
+	}
+
+	ssde_iterator(const ssde_iterator &from) :
+		dis(from.dis),
+		limit(from.limit)
+	{
+	}
+
+	ssde_iterator &operator=(const ssde_iterator &from)
+	{
+		dis.assign(ssde_image(from.dis.data(), from.dis.size(), from.dis.base_address()), from.dis.ip);
+
+		limit   = from.limit;
+		decoded = false;
+
+		return *this;
+	}
+
+	reference operator*() const
+	{
+		if (!decoded)
+		{
+			dis.dec();
+			decoded = true;
+		}
+
+		return dis;
+	}
+
+	pointer operator->() const
+	{
+		return &**this;
+	}
+
+	ssde_iterator &operator++()
+	{
+		**this;
+
+		/* a truncated instruction at the end runs past the limit */
+		dis.ip  = dis.ip + dis.length < limit ? dis.ip + dis.length : limit;
+		decoded = false;
+
+		return *this;
+	}
+
+	ssde_iterator operator++(int)
+	{
+		ssde_iterator was(*this);
+
+		++*this;
+
+		return was;
+	}
+
+	bool operator==(const ssde_iterator &other) const
+	{
+		return dis.ip == other.dis.ip;
+	}
+
+	bool operator!=(const ssde_iterator &other) const
+	{
+		return dis.ip != other.dis.ip;
+	}
+
+	size_t offset() const                   // Offset of the instruction in the code.
+	{
+		return dis.ip;
+	}
+
+private:
+	mutable arch dis;                       // Disassembler at the instruction.
+	size_t       limit;                     // Offset iterators stop at.
+	mutable bool decoded = false;           // Whether dis holds the instruction at its IP.
+};
+
+
+/*
+* Instructions of the code of a disassembler, from an offset up to a
+* limit, e.g.:
+*
+*   ssde_range<ssde_x64> code(dis);
+*
+*   auto calls = std::count_if(code.begin(), code.end(), [](const ssde_insn &insn)
+*   {
+*     return insn.flow == ssde_insn::flow_call;
+*   });
+*
+* begin() and end() are of the same type, so it works with <algorithm>
+* of C++11 on as well as with C++20 ranges. The range keeps a copy of the
+* disassembler, sharing code it owns, if any.
+*/
+template <class arch>
+class ssde_range
+{
+public:
+	typedef ssde_iterator<arch> iterator;
+	typedef ssde_iterator<arch> const_iterator;
+
+	ssde_range() :
+		dis(ssde_image(nullptr, 0))
+	{
+	}
+
+	/*
+	* From IP of dis to the end of its code.
+	*/
+	explicit ssde_range(const arch &dis) :
+		dis(dis),
+		first(std::min(dis.ip, dis.size())),
+		last(dis.size())
+	{
+	}
+
+	/*
+	* Instructions starting at offsets first to last (exclusive).
+	*/
+	ssde_range(const arch &dis, size_t first, size_t last) :
+		dis(dis),
+		first(std::min(first, last)),
+		last(last)
+	{
+	}
+
+	iterator begin() const
+	{
+		return iterator(dis, first, last);
+	}
+
+	iterator end() const
+	{
+		return iterator(dis, last, last);
+	}
+
+	bool empty() const
+	{
+		return first >= last;
+	}
+
+	size_t first_offset() const             // Offset of the first instruction.
+	{
+		return first;
+	}
+
+	size_t last_offset() const              // Offset past the last instruction.
+	{
+		return last;
+	}
+
+private:
+	arch   dis;
+	size_t first = 0;
+	size_t last  = 0;
+};
+
+
+/*
+* Code cut into ranges of about the same number of instructions, at
+* instruction boundaries found by a linear sweep (ssde_sweep()), so that
+* each range decodes exactly the instructions the sweep would. Ranges
+* are kept in a vector, its iterators are random access and hand the
+* ranges out to parallel algorithms, e.g. with C++17:
+*
+*   ssde_chunks<ssde_x64> chunks(dis);
+*
+*   size_t calls = std::transform_reduce(std::execution::par,
+*     chunks.begin(), chunks.end(), size_t(0), std::plus<size_t>(),
+*     [](const ssde_range<ssde_x64> &range)
+*     {
+*       return std::count_if(range.begin(), range.end(), is_call);
+*     });
+*
+* Boundaries take a sweep to find (split between threads, 0 for one per
+* core), which pays off when what's done per instruction costs more than
+* decoding it.
+*/
+template <class arch>
+class ssde_chunks
+{
+public:
+	typedef typename std::vector<ssde_range<arch>>::const_iterator iterator;
+	typedef typename std::vector<ssde_range<arch>>::const_iterator const_iterator;
+
+	explicit ssde_chunks(const arch &dis, size_t instructions = 16*1024, unsigned threads = 0)
+	{
+		std::vector<size_t> offsets = ssde_sweep(dis, threads);
+
+		instructions = std::max<size_t>(instructions, 1);
+
+		for (size_t i = 0; i < offsets.size(); i += instructions)
+		{
+			size_t last = i + instructions < offsets.size() ? offsets[i + instructions] : dis.size();
+
+			ranges.push_back(ssde_range<arch>(dis, offsets[i], last));
+		}
+	}
+
+	iterator begin() const
+	{
+		return ranges.begin();
+	}
+
+	iterator end() const
+	{
+		return ranges.end();
+	}
+
+	size_t size() const                     // Number of ranges.
+	{
+		return ranges.size();
+	}
+
+	const ssde_range<arch> &operator[](size_t i) const
+	{
+		return ranges[i];
+	}
+
+private:
+	std::vector<ssde_range<arch>> ranges;
+};
@@ -0,0 +1,240 @@
+/*
+* The SSDE header file for decoding code arriving in chunks.
+* Copyright (C) 2015, Constantine Shablya. See Copyright Notice in LICENSE.md
+*/
+#pragma once
+#include "ssde.hpp"
+
+#include <algorithm>
+
+
+/*
+* Decoder of a stream of code given chunk by chunk, e.g. read from a pipe
+* or a socket. Instructions come out as if the chunks were one buffer:
+* one running over the end of a chunk is kept in a stash of at most
+* max_length - 1 bytes and decoded once the next chunk completes it.
+* Memory use doesn't depend on the size of the stream, chunks are
+* decoded in place.
+*
+* Pull interface:
+*
+*   ssde_stream<ssde_x64> stream;
+*
+*   while (size_t n = read(fd, chunk, sizeof(chunk)))
+*   {
+*     stream.feed(chunk, n);
+*
+*     while (stream.dec())
+*       ... stream.insn(), stream.address()
+*   }
+*
+*   stream.finish();
+*
+*   while (stream.dec())
+*     ... the stash, as a truncated instruction
+*
+* or push() and flush() with a callback doing the same. A chunk has to be
+* kept alive until dec() returns false on it.
+*
+* Addresses (and abs) start at base and count bytes of the stream.
+* Decoders look past the end of some invalid instructions (e.g. EVEX
+* payload of 62 in X86-64) to tell what they are, so any instruction
+* with an error within max_length bytes of the end of a chunk is stashed
+* and decoded again with the next chunk. Overlong instructions
+* (error_length) running over the end of a chunk are decoded from the
+* bytes up to it.
+*/
+template <class arch>
+class ssde_stream
+{
+public:
+	enum : size_t { max_length = 15 };      // Longest valid instruction, in bytes.
+
+	explicit ssde_stream(uint64_t base = 0) :
+		base(base),
+		dis(ssde_image(nullptr, 0)),
+		edge(ssde_image(nullptr, 0))
+	{
+	}
+
+	/*
+	* Next chunk of the stream, the previous one has to be used up.
+	*/
+	void feed(const uint8_t *data, size_t size)
+	{
+		position  += chunk_size;
+		chunk      = data;
+		chunk_size = size;
+		pos        = 0;
+
+		dis.assign(ssde_image(data, size, base + position));
+	}
+
+	/*
+	* End of the stream, dec() decodes what's stashed as it is.
+	*/
+	void finish()
+	{
+		finished = true;
+	}
+
+	/*
+	* Decodes the next complete instruction. Returns false once the chunk
+	* is used up (or everything is, after finish()).
+	*/
+	bool dec()
+	{
+		if (skip != 0)
+			/* the rest of an overlong instruction, already given */
+		{
+			size_t n = std::min(skip, chunk_size - pos);
+
+			pos  += n;
+			skip -= n;
+		}
+
+		if (stashed != 0)
+		{
+			size_t n = std::min<size_t>(chunk_size - pos, ssde::window);
+
+			if (n == 0 && !finished)
+				return false;
+
+			/* the start of the instruction and enough of the chunk to decode it */
+			memcpy(joined, stash, stashed);
+			memcpy(joined + stashed, chunk + pos, n);
+
+			edge.assign(ssde_image(joined, stashed + n, base + stash_address));
+			edge.dec();
+
+			if (edge.error && !finished && stashed + n < max_length)
+				/* still incomplete, the whole chunk goes into the stash */
+			{
+				memcpy(stash + stashed, chunk + pos, n);
+
+				stashed += n;
+				pos     += n;
+
+				return false;
+			}
+
+			current   = &edge;
+			insn_addr = base + stash_address;
+
+			if (edge.length < stashed)
+				/* an error shorter than the stash, the rest of it is the next instruction */
+			{
+				stashed       -= edge.length;
+				stash_address += edge.length;
+
+				memmove(stash, stash + edge.length, stashed);
+			}
+			else
+			{
+				advance(edge.length - stashed);
+				stashed = 0;
+			}
+
+			return true;
+		}
+
+		if (pos >= chunk_size)
+			return false;
+
+		dis.ip = pos;
+		dis.dec();
+
+		if (dis.error && !finished && chunk_size - pos < max_length)
+			/* may depend on bytes past the end of the chunk */
+		{
+			memcpy(stash, chunk + pos, chunk_size - pos);
+
+			stashed       = chunk_size - pos;
+			stash_address = position + pos;
+			pos           = chunk_size;
+
+			return false;
+		}
+
+		current   = &dis;
+		insn_addr = base + position + pos;
+
+		advance(dis.length);
+
+		return true;
+	}
+
+	/*
+	* Feeds a chunk and calls f(insn(), address()) for each instruction
+	* completed by it.
+	*/
+	template <class function>
+	void push(const uint8_t *data, size_t size, function f)
+	{
+		feed(data, size);
+
+		while (dec())
+			f(insn(), address());
+	}
+
+	/*
+	* Ends the stream and calls f(insn(), address()) for what's left.
+	*/
+	template <class function>
+	void flush(function f)
+	{
+		finish();
+
+		while (dec())
+			f(insn(), address());
+	}
+
+	const arch &insn() const                // Instruction decoded by the last dec(), at IP of its data(): the chunk or a copy of the stash.
+	{
+		return *current;
+	}
+
+	uint64_t address() const                // Address of the instruction decoded by the last dec().
+	{
+		return insn_addr;
+	}
+
+	size_t pending() const                  // Bytes stashed, waiting for the next chunk.
+	{
+		return stashed;
+	}
+
+private:
+	void advance(size_t n)                  // Moves past n bytes of the stream, some may be in chunks yet to come.
+	{
+		size_t left = chunk_size - pos;
+
+		if (n > left)
+		{
+			skip = n - left;
+			pos  = chunk_size;
+		}
+		else
+		{
+			pos += n;
+		}
+	}
+
+	uint64_t       base;                    // Address of the first byte of the stream.
+	uint64_t       position      = 0;       // Offset of the chunk in the stream.
+	const uint8_t *chunk         = nullptr; // Chunk being decoded.
+	size_t         chunk_size    = 0;       // Its size, in bytes.
+	size_t         pos           = 0;       // Offset of the next instruction in the chunk.
+	size_t         skip          = 0;       // Bytes of the stream to skip, see dec().
+	bool           finished      = false;   // Whether finish() was called.
+
+	uint8_t        stash[max_length];       // Start of an instruction running over the end of a chunk.
+	size_t         stashed       = 0;       // Bytes in the stash.
+	uint64_t       stash_address = 0;       // Offset of the stash in the stream.
+	uint8_t        joined[size_t(max_length) + ssde::window]; // Stash and the start of the next chunk.
+
+	arch           dis;                     // Decoder on the chunk.
+	arch           edge;                    // Decoder on joined.
+	const arch    *current       = &dis;    // Which of them decoded the last instruction.
+	uint64_t       insn_addr     = 0;       // Its address.
+};
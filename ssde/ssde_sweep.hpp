@@ -0,0 +1,126 @@
+/*
+* The SSDE header file for linear sweep split between threads.
+* Copyright (C) 2015, Constantine Shablya. See Copyright Notice in LICENSE.md
+*/
+#pragma once
+#include "ssde.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+
+/*
+* Linear sweep of dis from its IP to the end of its code, split between
+* threads. Returns offsets of the instructions, the very same ones
+*
+*   for (; dis.dec(); dis.next())
+*
+* would visit on a single thread. Decode one again by setting IP to it.
+*
+* The code is cut into chunks which are decoded at once, each from its
+* start, as if an instruction started there. Chunks are then stitched
+* in order: the real sweep enters a chunk at the end of the previous
+* chunk's last instruction and is decoded on until it lands on an offset
+* the chunk's own sweep went through. From there on both are the same,
+* and as X86 resynchronizes within a few instructions, little is redone.
+*
+* threads is the number of threads to use, 0 for one per core. Chunks
+* are at least min_chunk bytes long, smaller code is swept on the
+* calling thread.
+*/
+template <class arch>
+std::vector<size_t> ssde_sweep(const arch &dis, unsigned threads = 0)
+{
+	enum : size_t { min_chunk = 64*1024 };
+
+	size_t begin = std::min(dis.ip, dis.size());
+	size_t end   = dis.size();
+
+	if (threads == 0)
+		threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+	size_t count = std::max<size_t>(std::min<size_t>(threads, (end - begin) / min_chunk), 1);
+
+	/* bounds[k] to bounds[k + 1] is the k-th chunk */
+	std::vector<size_t> bounds(count + 1);
+
+	for (size_t k = 0; k <= count; ++k)
+		bounds[k] = begin + (end - begin) / count * k;
+
+	bounds[count] = end;
+
+	std::vector<std::vector<size_t>> chains(count);
+	std::vector<size_t>              exits(count);
+
+	auto sweep = [&](size_t k)
+	{
+		arch chunk(dis);
+
+		chunk.ip = bounds[k];
+
+		/* X86 instructions average 3 to 4 bytes */
+		chains[k].reserve((bounds[k + 1] - bounds[k]) / 4);
+
+		/* the last instruction may run into the next chunk, exits[k] is where it ends */
+		for (; chunk.ip < bounds[k + 1] && chunk.dec(); chunk.next())
+			chains[k].push_back(chunk.ip);
+
+		exits[k] = chunk.ip;
+	};
+
+	std::vector<std::thread> workers;
+
+	for (size_t k = 1; k < count; ++k)
+		workers.emplace_back(sweep, k);
+
+	sweep(0);
+
+	for (auto &worker : workers)
+		worker.join();
+
+	/* the first chunk starts where the real sweep does */
+	std::vector<size_t> offsets(std::move(chains[0]));
+
+	size_t ip = exits[0];
+
+	for (size_t k = 1; k < count; ++k)
+	{
+		const std::vector<size_t> &chain = chains[k];
+
+		auto it = chain.begin();
+
+		arch real(dis);
+
+		real.ip = ip;
+
+		for (;;)
+		{
+			it = std::lower_bound(it, chain.end(), real.ip);
+
+			if (it != chain.end() && *it == real.ip)
+				/* synchronized, the rest of the chunk is right */
+			{
+				offsets.insert(offsets.end(), it, chain.end());
+				ip = exits[k];
+
+				break;
+			}
+
+			if (real.ip >= bounds[k + 1] || !real.dec())
+				/* never synchronized, the whole chunk got redone */
+			{
+				ip = real.ip;
+
+				break;
+			}
+
+			offsets.push_back(real.ip);
+			real.next();
+		}
+
+		std::vector<size_t>().swap(chains[k]);
+	}
+
+	return offsets;
+}
@@ -1,5 +1,5 @@
 /*
-* The SSDE implementation for X86 instruction set.
+* The SSDE implementation for X86 and X86-64 instruction sets.
 * Copyright (C) 2015, Constantine Shablya. See Copyright Notice in LICENSE.md
 */
 #include "ssde_x86.hpp"
@@ -7,6 +7,14 @@
 #include <string>
 
 #include <stdint.h>
+#include <string.h>
+
+#if !defined(SSDE_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+/* SSSE3 and AVX2 kernels of length_map(), picked at run time */
+#define SSDE_SIMD
+#include <immintrin.h>
+#endif
 
 /*
 * Major amounts of information this code was based on ware taken from
@@ -21,763 +29,604 @@
 *   http://www.intel.com/content/dam/www/public/us/en/documents/manuals/64-ia-32-architectures-software-developer-instruction-set-reference-manual-325383.pdf
 */
 
-enum : uint16_t
+/* opcode flags of each opcode class */
+const uint16_t ssde_x86_op::desc[cls::error + 1] =
 {
-	none = 0,
-
-	rm  = 1 << 0, // expect Mod byte
-	rel = 1 << 1, // instruction's imm is a relative address
-	i8  = 1 << 2, // has  8 bit imm
-	i16 = 1 << 3, // has 16 bit imm
-	i32 = 1 << 4, // has 32 bit imm, which can be turned to 16 with 66 prefix
-	am  = 1 << 5, // instruction uses address mode, imm is a memory address
-	vx  = 1 << 6, // instruction requires a VEX prefix
-	mp  = 1 << 7, // instruction has a mandatory 66 prefix
-
-	r8  = i8  | rel,
-	r32 = i32 | rel,
+	none,                               /* none */
+	rm,                                 /* rm */
+	ex,                                 /* ex */
+	i8,                                 /* i8 */
+	rm | i8,                            /* rm_i8 */
+	ex | i8,                            /* ex_i8 */
+	r8,                                 /* r8 */
+	i16,                                /* i16 */
+	i16 | i8,                           /* i16_i8 */
+	i32,                                /* i32 */
+	rm | i32,                           /* rm_i32 */
+	ex | i32,                           /* ex_i32 */
+	r32,                                /* r32 */
+	rw | i32,                           /* rw_i32 */
+	am,                                 /* am */
+	vx | rm,                            /* vx_rm */
+	vx | rm | i8,                       /* vx_rm_i8 */
+	mp | rm,                            /* mp_rm */
+	mp | rm | i8,                       /* mp_rm_i8 */
+
+	o32 | none,                         /* none_o32  */
+	o32 | rm,                           /* rm_o32    */
+	o32 | i8,                           /* i8_o32    */
+	o32 | rm | i8,                      /* rm_i8_o32 */
+	o32 | i32 | i16,                    /* ptr_o32, far pointers */
+
+	error                               /* error */
+};
 
-	error = (uint16_t)-1
+/* prefix class of each byte */
+const uint8_t ssde_x86_op::prefix[256] =
+{
+	/*   x0   |   x1   |   x2   |   x3   |   x4   |   x5   |   x6   |   x7   */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 00x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 01x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 02x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 03x */
+	 g_none , g_none , g_none , g_none , g_none , g_none ,  g_2   , g_none , /* 04x */
+	 g_none , g_none , g_none , g_none , g_none , g_none ,  g_2   , g_none , /* 05x */
+	 g_none , g_none , g_none , g_none , g_none , g_none ,  g_2   , g_none , /* 06x */
+	 g_none , g_none , g_none , g_none , g_none , g_none ,  g_2   , g_none , /* 07x */
+	 g_rex  , g_rex  , g_rex  , g_rex  , g_rex  , g_rex  , g_rex  , g_rex  , /* 10x */
+	 g_rex  , g_rex  , g_rex  , g_rex  , g_rex  , g_rex  , g_rex  , g_rex  , /* 11x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 12x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 13x */
+	 g_none , g_none , g_none , g_none ,  g_2   ,  g_2   ,  g_3   ,  g_4   , /* 14x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 15x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 16x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 17x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 20x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 21x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 22x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 23x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 24x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 25x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 26x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 27x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 30x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 31x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 32x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 33x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 34x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 35x */
+	  g_1   , g_none ,  g_1   ,  g_1   , g_none , g_none , g_none , g_none , /* 36x */
+	 g_none , g_none , g_none , g_none , g_none , g_none , g_none , g_none , /* 37x */
 };
 
-/* 1st opcode flag table */
-static const uint16_t op_table[256] =
+/* 1st opcode class table */
+const uint8_t ssde_x86_op::cls::table[256] =
 {
-	/*x0  |  x1  |  x2  |  x3  |  x4  |  x5  |  x6  |  x7*/
-	  rm  ,  rm  ,  rm  ,  rm  ,  i8  ,  i32 , none , none , /* 00x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  i8  ,  i32 , none , error, /* 01x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  i8  ,  i32 , none , none , /* 02x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  i8  ,  i32 , none , none , /* 03x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  i8  ,  i32 , error, none , /* 04x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  i8  ,  i32 , error, none , /* 05x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  i8  ,  i32 , error, none , /* 06x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  i8  ,  i32 , error, none , /* 07x */
-	 none , none , none , none , none , none , none , none , /* 10x */
-	 none , none , none , none , none , none , none , none , /* 11x */
-	 none , none , none , none , none , none , none , none , /* 12x */
-	 none , none , none , none , none , none , none , none , /* 13x */
-	 none , none ,  rm  ,  rm  , error, error, error, error, /* 14x */
-	  i32 ,rm|i32,  i8  , rm|i8, none , none , none , none , /* 15x */
-	  r8  ,  r8  ,  r8  ,  r8  ,  r8  ,  r8  ,  r8  ,  r8  , /* 16x */
-	  r8  ,  r8  ,  r8  ,  r8  ,  r8  ,  r8  ,  r8  ,  r8  , /* 17x */
-	 rm|i8,rm|i32, rm|i8, rm|i8,  rm  ,  rm  ,  rm  ,  rm  , /* 20x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 21x */
-	 none , none , none , none , none , none , none , none , /* 22x */
-	 none , none,i32|i16, error, none , none , none , none , /* 23x */
-	  am  ,  am  ,  am  ,  am  , none , none , none , none , /* 24x */
-	  i8  ,  i32 , none , none , none , none , none , none , /* 25x */
-	  i8  ,  i8  ,  i8  ,  i8  ,  i8  ,  i8  ,  i8  ,  i8  , /* 26x */
-	  i32 ,  i32 ,  i32 ,  i32 ,  i32 ,  i32 ,  i32 ,  i32 , /* 27x */
-	 rm|i8, rm|i8,  i16 , none ,  rm  ,  rm  , rm|i8,rm|i32, /* 30x */
-	i16|i8, none ,  i16 , none , none ,  i8  , none , none , /* 31x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  i8  ,  i8  , none , none , /* 32x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 33x */
-	  r8  ,  r8  ,  r8  ,  r8  ,  i8  ,  i8  ,  i8  ,  i8  , /* 34x */
-	  r32 ,  r32,i32|i16,  r8  , none , none , none , none , /* 35x */
-	 error, none , error, error, none , none , error, error, /* 36x */
-	 none , none , none , none , none , none ,  rm  ,  rm  , /* 37x */
+	/*     x0    |     x1    |     x2    |     x3    |     x4    |     x5    |     x6    |     x7    */
+	     rm    ,     rm    ,     rm    ,     rm    ,     i8    ,    i32    ,  none_o32 ,  none_o32 , /* 00x */
+	     rm    ,     rm    ,     rm    ,     rm    ,     i8    ,    i32    ,  none_o32 ,   error   , /* 01x */
+	     rm    ,     rm    ,     rm    ,     rm    ,     i8    ,    i32    ,  none_o32 ,  none_o32 , /* 02x */
+	     rm    ,     rm    ,     rm    ,     rm    ,     i8    ,    i32    ,  none_o32 ,  none_o32 , /* 03x */
+	     rm    ,     rm    ,     rm    ,     rm    ,     i8    ,    i32    ,   error   ,  none_o32 , /* 04x */
+	     rm    ,     rm    ,     rm    ,     rm    ,     i8    ,    i32    ,   error   ,  none_o32 , /* 05x */
+	     rm    ,     rm    ,     rm    ,     rm    ,     i8    ,    i32    ,   error   ,  none_o32 , /* 06x */
+	     rm    ,     rm    ,     rm    ,     rm    ,     i8    ,    i32    ,   error   ,  none_o32 , /* 07x */
+	  none_o32 ,  none_o32 ,  none_o32 ,  none_o32 ,  none_o32 ,  none_o32 ,  none_o32 ,  none_o32 , /* 10x */
+	  none_o32 ,  none_o32 ,  none_o32 ,  none_o32 ,  none_o32 ,  none_o32 ,  none_o32 ,  none_o32 , /* 11x */
+	    none   ,    none   ,    none   ,    none   ,    none   ,    none   ,    none   ,    none   , /* 12x */
+	    none   ,    none   ,    none   ,    none   ,    none   ,    none   ,    none   ,    none   , /* 13x */
+	  none_o32 ,  none_o32 ,   rm_o32  ,     rm    ,   error   ,   error   ,   error   ,   error   , /* 14x */
+	    i32    ,   rm_i32  ,     i8    ,   rm_i8   ,    none   ,    none   ,    none   ,    none   , /* 15x */
+	     r8    ,     r8    ,     r8    ,     r8    ,     r8    ,     r8    ,     r8    ,     r8    , /* 16x */
+	     r8    ,     r8    ,     r8    ,     r8    ,     r8    ,     r8    ,     r8    ,     r8    , /* 17x */
+	   ex_i8   ,   ex_i32  , rm_i8_o32 ,   ex_i8   ,     rm    ,     rm    ,     rm    ,     rm    , /* 20x */
+	     rm    ,     rm    ,     rm    ,     rm    ,     rm    ,     rm    ,     rm    ,     ex    , /* 21x */
+	    none   ,    none   ,    none   ,    none   ,    none   ,    none   ,    none   ,    none   , /* 22x */
+	    none   ,    none   ,  ptr_o32  ,    none   ,    none   ,    none   ,    none   ,    none   , /* 23x */
+	     am    ,     am    ,     am    ,     am    ,    none   ,    none   ,    none   ,    none   , /* 24x */
+	     i8    ,    i32    ,    none   ,    none   ,    none   ,    none   ,    none   ,    none   , /* 25x */
+	     i8    ,     i8    ,     i8    ,     i8    ,     i8    ,     i8    ,     i8    ,     i8    , /* 26x */
+	   rw_i32  ,   rw_i32  ,   rw_i32  ,   rw_i32  ,   rw_i32  ,   rw_i32  ,   rw_i32  ,   rw_i32  , /* 27x */
+	   ex_i8   ,   ex_i8   ,    i16    ,    none   ,   rm_o32  ,   rm_o32  ,   ex_i8   ,   ex_i32  , /* 30x */
+	   i16_i8  ,    none   ,    i16    ,    none   ,    none   ,     i8    ,  none_o32 ,    none   , /* 31x */
+	     ex    ,     ex    ,     ex    ,     ex    ,   i8_o32  ,   i8_o32  ,  none_o32 ,    none   , /* 32x */
+	     ex    ,     ex    ,     ex    ,     ex    ,     ex    ,     ex    ,     ex    ,     ex    , /* 33x */
+	     r8    ,     r8    ,     r8    ,     r8    ,     i8    ,     i8    ,     i8    ,     i8    , /* 34x */
+	    r32    ,    r32    ,  ptr_o32  ,     r8    ,    none   ,    none   ,    none   ,    none   , /* 35x */
+	   error   ,    none   ,   error   ,   error   ,    none   ,    none   ,   error   ,   error   , /* 36x */
+	    none   ,    none   ,    none   ,    none   ,    none   ,    none   ,     rm    ,     ex    , /* 37x */
 };
 
 /*
-* 2nd opcode flag table
+* 2nd opcode class table
 * 0F xx
 */
-static const uint16_t op_table_0f[256] =
+const uint8_t ssde_x86_op::cls::table_0f[256] =
 {
-	/*x0  |  x1  |  x2  |  x3  |  x4  |  x5  |  x6  |  x7*/
-	  rm  ,  rm  ,  rm  ,  rm  , error, error, none , error, /* 00x */
-	 none , none , error, none , error,  rm  , none , error, /* 01x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 02x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 03x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  , error,  rm  , error, /* 04x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 05x */
-	 none , none , none , none , none , none , error, none , /* 06x */
-	 error, error, error, error, error, error, error, error, /* 07x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 10x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 11x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 12x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 13x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 14x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 15x */
-	 rm|i8, rm|i8, rm|i8, rm|i8,  rm  ,  rm  ,  rm  , none , /* 16x */
-	  rm  ,  rm  , error, error,  rm  ,  rm  ,  rm  ,  rm  , /* 17x */
-	  r32 ,  r32 ,  r32 ,  r32 ,  r32 ,  r32 ,  r32 ,  r32 , /* 20x */
-	  r32 ,  r32 ,  r32 ,  r32 ,  r32 ,  r32 ,  r32 ,  r32 , /* 21x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 22x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 23x */
-	 none , none , none ,  rm  , rm|i8,  rm  , error, error, /* 24x */
-	 none , none , none ,  rm  , rm|i8,  rm  ,  rm  ,  rm  , /* 25x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 26x */
-	  rm  , none , rm|i8,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 27x */
-	  rm  ,  rm  , rm|i8,  rm  , rm|i8, rm|i8, rm|i8,  rm  , /* 30x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 31x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 32x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 33x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 34x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 35x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 36x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 37x */
+	/*   x0  |   x1  |   x2  |   x3  |   x4  |   x5  |   x6  |   x7  */
+	   ex  ,   ex  ,   rm  ,   rm  , error ,  none ,  none ,  none , /* 00x */
+	  none ,  none , error ,  none , error ,   rm  ,  none , error , /* 01x */
+	   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  , /* 02x */
+	   ex  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   ex  , /* 03x */
+	   rm  ,   rm  ,   rm  ,   rm  ,   rm  , error ,   rm  , error , /* 04x */
+	   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  , /* 05x */
+	  none ,  none ,  none ,  none ,  none ,  none , error ,  none , /* 06x */
+	 error , error , error , error , error , error , error , error , /* 07x */
+	   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  , /* 10x */
+	   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  , /* 11x */
+	   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  , /* 12x */
+	   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  , /* 13x */
+	   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  , /* 14x */
+	   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  , /* 15x */
+	 rm_i8 , ex_i8 , ex_i8 , ex_i8 ,   rm  ,   rm  ,   rm  ,  none , /* 16x */
+	   rm  ,   rm  , error , error ,   rm  ,   rm  ,   rm  ,   rm  , /* 17x */
+	  r32  ,  r32  ,  r32  ,  r32  ,  r32  ,  r32  ,  r32  ,  r32  , /* 20x */
+	  r32  ,  r32  ,  r32  ,  r32  ,  r32  ,  r32  ,  r32  ,  r32  , /* 21x */
+	   ex  ,   ex  ,   ex  ,   ex  ,   ex  ,   ex  ,   ex  ,   ex  , /* 22x */
+	   ex  ,   ex  ,   ex  ,   ex  ,   ex  ,   ex  ,   ex  ,   ex  , /* 23x */
+	  none ,  none ,  none ,   rm  , rm_i8 ,   rm  , error , error , /* 24x */
+	  none ,  none ,  none ,   rm  , rm_i8 ,   rm  ,   ex  ,   rm  , /* 25x */
+	   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  , /* 26x */
+	   rm  ,  none , ex_i8 ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  , /* 27x */
+	   rm  ,   rm  , rm_i8 ,   rm  , rm_i8 , rm_i8 , rm_i8 ,   ex  , /* 30x */
+	  none ,  none ,  none ,  none ,  none ,  none ,  none ,  none , /* 31x */
+	   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  , /* 32x */
+	   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  , /* 33x */
+	   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  , /* 34x */
+	   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  , /* 35x */
+	   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  , /* 36x */
+	   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  , /* 37x */
 };
 
 /*
-* 3rd opcode flag table
+* 3rd opcode class table
 * 0F 38 xx
 */
-static const uint16_t op_table_38[256] =
+const uint8_t ssde_x86_op::cls::table_38[256] =
 {
-	/*x0  |  x1  |  x2  |  x3  |  x4  |  x5  |  x6  |  x7*/
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 00x */
-	  rm  ,  rm  ,  rm  ,  rm  , vx|rm, vx|rm, error, error, /* 01x */
-	 mp|rm, error, error, error, mp|rm, mp|rm, error, mp|rm, /* 02x */
-	 vx|rm, error, vx|rm, error,  rm  ,  rm  ,  rm  , error, /* 03x */
-	 mp|rm, mp|rm, mp|rm, mp|rm, mp|rm, mp|rm, error, error, /* 04x */
-	 mp|rm, mp|rm, mp|rm, mp|rm, vx|rm, vx|rm, error, error, /* 05x */
-	 mp|rm, mp|rm, mp|rm, mp|rm, mp|rm, mp|rm, error, mp|rm, /* 06x */
-	 mp|rm, mp|rm, mp|rm, mp|rm, mp|rm, mp|rm, mp|rm, mp|rm, /* 07x */
-	 mp|rm, mp|rm, error, error, error, error, error, error, /* 10x */
-	 error, error, error, error, error, error, error, error, /* 11x */
-	 error, error, error, error, error, error, error, error, /* 12x */
-	 vx|rm, vx|rm, error, error, error, error, error, error, /* 13x */
-	 error, error, error, error, error, error, error, error, /* 14x */
-	 error, error, error, error, error, error, error, error, /* 15x */
-	 error, error, error, error, error, error, error, error, /* 16x */
-	 vx|rm, vx|rm, error, error, error, error, error, error, /* 17x */
-	 mp|rm, mp|rm, error, error, error, error, error, error, /* 20x */
-	 error, error, error, error, error, error, error, error, /* 21x */
-	 error, error, error, error, error, error, vx|rm, vx|rm, /* 22x */
-	 vx|rm, error, vx|rm, error, vx|rm, error, vx|rm, error, /* 23x */
-	 error, error, error, error, error, error, vx|rm, vx|rm, /* 24x */
-	 vx|rm, error, vx|rm, error, vx|rm, error, vx|rm, error, /* 25x */
-	 error, error, error, error, error, error, vx|rm, vx|rm, /* 26x */
-	 vx|rm, error, vx|rm, error, vx|rm, error, vx|rm, error, /* 27x */
-	 error, error, error, error, error, error, error, error, /* 30x */
-	  rm  ,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , error, error, /* 31x */
-	 error, error, error, error, error, error, error, error, /* 32x */
-	 error, error, error,  rm  ,  rm  ,  rm  ,  rm  ,  rm  , /* 33x */
-	 error, error, error, error, error, error, error, error, /* 34x */
-	 error, error, error, error, error, error, error, error, /* 35x */
-	  rm  ,  rm  , error, error, error, error,  rm  , error, /* 36x */
-	 error, error, error, error, error, error, error, error, /* 37x */
+	/*   x0  |   x1  |   x2  |   x3  |   x4  |   x5  |   x6  |   x7  */
+	   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  , /* 00x */
+	   rm  ,   rm  ,   rm  ,   rm  , vx_rm , vx_rm , vx_rm , vx_rm , /* 01x */
+	 mp_rm , error , error , vx_rm , mp_rm , mp_rm , vx_rm , mp_rm , /* 02x */
+	 vx_rm , vx_rm , vx_rm , error ,   rm  ,   rm  ,   rm  , vx_rm , /* 03x */
+	 mp_rm , mp_rm , mp_rm , mp_rm , mp_rm , mp_rm , vx_rm , vx_rm , /* 04x */
+	 mp_rm , mp_rm , mp_rm , mp_rm , vx_rm , vx_rm , error , error , /* 05x */
+	 mp_rm , mp_rm , mp_rm , mp_rm , mp_rm , mp_rm , vx_rm , mp_rm , /* 06x */
+	 mp_rm , mp_rm , mp_rm , mp_rm , mp_rm , mp_rm , mp_rm , mp_rm , /* 07x */
+	 mp_rm , mp_rm , vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , /* 10x */
+	 error , error , error , error , vx_rm , vx_rm , vx_rm , vx_rm , /* 11x */
+	 vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , error , error , /* 12x */
+	 vx_rm , vx_rm , vx_rm , vx_rm , error , error , error , error , /* 13x */
+	 error , error , vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , error , /* 14x */
+	 error , error , error , error , error , error , error , error , /* 15x */
+	 error , error , error , error , error , vx_rm , vx_rm , vx_rm , /* 16x */
+	 vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , /* 17x */
+	 mp_rm , mp_rm , mp_rm , vx_rm , error , error , error , error , /* 20x */
+	 vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , /* 21x */
+	 vx_rm , vx_rm , vx_rm , vx_rm , error , error , vx_rm , vx_rm , /* 22x */
+	 vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , /* 23x */
+	 vx_rm , vx_rm , vx_rm , vx_rm , error , error , vx_rm , vx_rm , /* 24x */
+	 vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , /* 25x */
+	 error , error , error , error , vx_rm , vx_rm , vx_rm , vx_rm , /* 26x */
+	 vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , vx_rm , /* 27x */
+	 error , error , error , error , vx_rm , error , vx_rm , vx_rm , /* 30x */
+	   rm  ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  , error , mp_rm , /* 31x */
+	 error , error , error , error , error , error , error , error , /* 32x */
+	 error , error , error ,   rm  ,   rm  ,   rm  ,   rm  ,   rm  , /* 33x */
+	 error , error , error , error , error , error , error , error , /* 34x */
+	 error , error , error , error , error , error , error , error , /* 35x */
+	   rm  ,   rm  , vx_rm , vx_rm , error , vx_rm ,   rm  , vx_rm , /* 36x */
+	 error , error , error , error , error , error , error , error , /* 37x */
 };
 
 /*
-* 3rd opcode flag table
+* 3rd opcode class table
 * 0F 3A xx
 */
-static const uint16_t op_table_3a[256] =
+const uint8_t ssde_x86_op::cls::table_3a[256] =
 {
-	/* x0   |   x1   |   x2   |   x3   |   x4   |   x5   |   x6   |   x7 */
-	  error ,  error ,  error ,  error ,  error ,  error ,vx|rm|i8,  error , /* 00x */
-	mp|rm|i8,mp|rm|i8,mp|rm|i8,mp|rm|i8,mp|rm|i8,mp|rm|i8,mp|rm|i8,   rm   , /* 01x */
-	  error ,  error ,  error ,  error ,mp|rm|i8,mp|rm|i8,mp|rm|i8,mp|rm|i8, /* 02x */
-	vx|rm|i8,vx|rm|i8,  error ,  error ,  error ,  error ,  error ,  error , /* 03x */
-	mp|rm|i8,mp|rm|i8,mp|rm|i8,  error ,  error ,  error ,  error ,  error , /* 04x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 05x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 06x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 07x */
-	  mp|rm ,  mp|rm ,mp|rm|i8,  error ,  error ,  error ,  error ,  error , /* 10x */
-	  error ,  error ,vx|rm|i8,vx|rm|i8,vx|rm|i8,  error ,  error ,  error , /* 11x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 12x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 13x */
-	mp|rm|i8,mp|rm|i8,mp|rm|i8,mp|rm|i8,  error ,  error ,  error ,  error , /* 14x */
-	vx|rm|i8,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 15x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 16x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 17x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 20x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 21x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 22x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 23x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 24x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 25x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 26x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 27x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 30x */
-	  error ,  error ,  error ,  error ,mp|rm|i8,  error ,  error ,  error , /* 31x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 32x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 33x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 34x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 35x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 36x */
-	  error ,  error ,  error ,  error ,  error ,  error ,  error ,  error , /* 37x */
+	/*    x0    |    x1    |    x2    |    x3    |    x4    |    x5    |    x6    |    x7    */
+	 vx_rm_i8 , vx_rm_i8 , vx_rm_i8 , vx_rm_i8 , vx_rm_i8 , vx_rm_i8 , vx_rm_i8 ,  error   , /* 00x */
+	 mp_rm_i8 , mp_rm_i8 , mp_rm_i8 , mp_rm_i8 , mp_rm_i8 , mp_rm_i8 , mp_rm_i8 ,  rm_i8   , /* 01x */
+	  error   ,  error   ,  error   ,  error   , mp_rm_i8 , mp_rm_i8 , mp_rm_i8 , mp_rm_i8 , /* 02x */
+	 vx_rm_i8 , vx_rm_i8 , vx_rm_i8 , vx_rm_i8 ,  error   , vx_rm_i8 , vx_rm_i8 , vx_rm_i8 , /* 03x */
+	 mp_rm_i8 , mp_rm_i8 , mp_rm_i8 , vx_rm_i8 ,  error   , vx_rm_i8 , vx_rm_i8 , vx_rm_i8 , /* 04x */
+	  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   , /* 05x */
+	 vx_rm_i8 , vx_rm_i8 , vx_rm_i8 , vx_rm_i8 ,  error   ,  error   ,  error   ,  error   , /* 06x */
+	 vx_rm_i8 , vx_rm_i8 , vx_rm_i8 , vx_rm_i8 ,  error   ,  error   , vx_rm_i8 , vx_rm_i8 , /* 07x */
+	 mp_rm_i8 , mp_rm_i8 , mp_rm_i8 , vx_rm_i8 , mp_rm_i8 ,  error   , vx_rm_i8 ,  error   , /* 10x */
+	  error   ,  error   , vx_rm_i8 , vx_rm_i8 , vx_rm_i8 ,  error   ,  error   ,  error   , /* 11x */
+	 vx_rm_i8 , vx_rm_i8 ,  error   ,  error   , vx_rm_i8 , vx_rm_i8 , vx_rm_i8 , vx_rm_i8 , /* 12x */
+	  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   , /* 13x */
+	 mp_rm_i8 , mp_rm_i8 , mp_rm_i8 , mp_rm_i8 ,  error   ,  error   , vx_rm_i8 , vx_rm_i8 , /* 14x */
+	 vx_rm_i8 ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   , /* 15x */
+	 vx_rm_i8 , vx_rm_i8 , vx_rm_i8 , vx_rm_i8 ,  error   ,  error   ,  error   ,  error   , /* 16x */
+	  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   , /* 17x */
+	  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   , /* 20x */
+	  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   , /* 21x */
+	  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   , /* 22x */
+	  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   , /* 23x */
+	  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   , /* 24x */
+	  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   , /* 25x */
+	  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   , /* 26x */
+	  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   , /* 27x */
+	  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   , /* 30x */
+	  error   ,  error   ,  error   ,  error   ,  rm_i8   ,  error   , mp_rm_i8 , mp_rm_i8 , /* 31x */
+	  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   , /* 32x */
+	  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   , mp_rm_i8 , /* 33x */
+	  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   , /* 34x */
+	  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   , /* 35x */
+	 vx_rm_i8 ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   , /* 36x */
+	  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   ,  error   , /* 37x */
 };
 
-
-bool ssde_x86::dec()
+/* 1st opcode flow table */
+const uint8_t ssde_x86_op::flow::table[256] =
 {
-	if (ip >= buffer.length())
-		return false;
-
-	reset_fields();
-
-	decode_prefixes();
-	decode_opcode();
-
-	if (flags != ::error)
-		/* it's not a bullshit instruction */
-	{
-		if (flags & ::mp && group3 != p_66)
-			/* this instruction lacks mandatory 66 prefix */
-		{
-			error = true;
-			error_opcode = true;
-		}
-
-		if (flags & ::rm)
-			/* this instruction has a Mod byte, decode it */
-		{
-			decode_modrm();
-
-			if (has_sib)
-				/* if instruction has a SIB byte, decode it, too */
-			{
-				decode_sib();
-			}
-
-			if (has_disp)
-				/* if instruction has displacement value, read it */
-			{
-				disp = 0;
-
-				for (int i = 0; i < disp_size; i++)
-					disp |= buffer[ip + length++] << i*8;
+	/*    x0    |    x1    |    x2    |    x3    |    x4    |    x5    |    x6    |    x7    */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 00x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 01x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 02x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 03x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 04x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 05x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 06x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 07x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 10x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 11x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 12x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 13x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 14x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 15x */
+	   jcc    ,   jcc    ,   jcc    ,   jcc    ,   jcc    ,   jcc    ,   jcc    ,   jcc    , /* 16x */
+	   jcc    ,   jcc    ,   jcc    ,   jcc    ,   jcc    ,   jcc    ,   jcc    ,   jcc    , /* 17x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 20x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 21x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 22x */
+	   none   ,   none   , call_ind ,   none   ,   none   ,   none   ,   none   ,   none   , /* 23x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 24x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 25x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 26x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 27x */
+	   none   ,   none   ,   ret    ,   ret    ,   none   ,   none   ,   none   ,   none   , /* 30x */
+	   none   ,   none   ,   ret    ,   ret    ,   intr   ,   intr   ,   intr   ,   ret    , /* 31x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 32x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 33x */
+	   jcc    ,   jcc    ,   jcc    ,   jcc    ,   none   ,   none   ,   none   ,   none   , /* 34x */
+	   call   ,   jmp    , jmp_ind  ,   jmp    ,   none   ,   none   ,   none   ,   none   , /* 35x */
+	   none   ,   intr   ,   none   ,   none   ,   halt   ,   none   ,   none   ,   none   , /* 36x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   ext    , /* 37x */
+};
 
-				if (disp & (1 << (disp_size*8 - 1)))
-					/* disp is signed, extend the sign if needed */
-				{
-					switch (disp_size)
-					{
-					case 1:
-						disp |= 0xffffff00;
-						break;
-
-					case 2:
-						disp |= 0xffff0000;
-						break;
-
-					default:
-						break;
-					}
-				}
-			}
-		}
-		else if (group1 == p_lock)
-			/* LOCK prefix only makes sense for Mod M */
-		{
-			error = true;
-			error_lock = true;
-		}
+/*
+* 2nd opcode flow table
+* 0F xx
+*/
+const uint8_t ssde_x86_op::flow::table_0f[256] =
+{
+	/*    x0    |    x1    |    x2    |    x3    |    x4    |    x5    |    x6    |    x7    */
+	   none   ,   none   ,   none   ,   none   ,   none   , syscall  ,   none   ,   ret    , /* 00x */
+	   none   ,   none   ,   none   ,   halt   ,   none   ,   none   ,   none   ,   none   , /* 01x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 02x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 03x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 04x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 05x */
+	   none   ,   none   ,   none   ,   none   , syscall  ,   ret    ,   none   ,   none   , /* 06x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 07x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 10x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 11x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 12x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 13x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 14x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 15x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 16x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 17x */
+	   jcc    ,   jcc    ,   jcc    ,   jcc    ,   jcc    ,   jcc    ,   jcc    ,   jcc    , /* 20x */
+	   jcc    ,   jcc    ,   jcc    ,   jcc    ,   jcc    ,   jcc    ,   jcc    ,   jcc    , /* 21x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 22x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 23x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 24x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 25x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 26x */
+	   none   ,   halt   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 27x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 30x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 31x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 32x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 33x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 34x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 35x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   , /* 36x */
+	   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   none   ,   halt   , /* 37x */
+};
 
-		/* decode moffs, imm or rel */
-		decode_imm();
+/*
+* FF opcode flow table
+* FF /reg
+*/
+const uint8_t ssde_x86_op::flow::table_ff[8] =
+{
+	/*    /0    |    /1    |    /2    |    /3    |    /4    |    /5    |    /6    |    /7    */
+	   none   ,   none   , call_ind , call_ind , jmp_ind  , jmp_ind  ,   none   ,   none   ,
+};
 
+/* -- decodes a run of instructions into SoA columns ---------------------- */
+template <bool x64>
+size_t ssde_x86_engine<x64>::decode_batch(size_t begin, size_t max_count, ssde_batch &out)
+{
+	out.resize(max_count);
 
-		if (length > 15)
-			/* CPU can't handle instructions longer than 15 bytes */
-		{
-			length = 15;
+	size_t count = 0;
 
-			error = true;
-			error_length = true;
-		}
-	}
-	else
+	for (ip = begin; count < max_count && decode<fields::rel>(); next(), ++count)
 	{
-		error = true;
-		error_opcode = true;
-
-		length = 1;
+		uint16_t f = 0;
+
+		f |= error     ? ssde_batch::f_error : 0;
+		f |= has_modrm ? ssde_batch::f_modrm : 0;
+		f |= has_sib   ? ssde_batch::f_sib   : 0;
+		f |= has_disp  ? ssde_batch::f_disp  : 0;
+		f |= has_imm   ? ssde_batch::f_imm   : 0;
+		f |= has_imm2  ? ssde_batch::f_imm2  : 0;
+		f |= has_rel   ? ssde_batch::f_rel   : 0;
+		f |= has_vex   ? ssde_batch::f_vex   : 0;
+		f |= has_rex   ? ssde_batch::f_rex   : 0;
+		f |= group1 == p_lock ? ssde_batch::f_lock : 0;
+
+		out.offset[count]  = ip;
+		out.length[count]  = static_cast<uint8_t>(length);
+		out.opcode1[count] = opcode1;
+		out.opcode2[count] = opcode2;
+		out.opcode3[count] = opcode3;
+		out.flags[count]   = f;
+		out.flow[count]    = flow;
+		out.target[count]  = has_rel ? abs : 0;
 	}
 
-	return true;
-}
+	out.count = count;
 
-/* -- resets fields before new iteration of the instruction decoder -------- */
-void ssde_x86::reset_fields()
-{
-	length = 0;
-
-	error         = false;
-	error_opcode  = false;
-	error_operand = false;
-	error_length  = false;
-	error_lock    = false;
-	error_novex   = false;
-
-	has_modrm = false;
-	has_sib   = false;
-	has_imm   = false;
-	has_imm2  = false;
-	has_disp  = false;
-	has_rel   = false;
-	has_vex   = false;
-
-	group1 = 0;
-	group2 = 0;
-	group3 = 0;
-	group4 = 0;
-
-	opcode1 = 0;
-	opcode2 = 0;
-	opcode3 = 0;
-
-	has_vex    = false;
-	vex_zero   = false;
-	vex_reg    = 0;
-	vex_opmask = 0;
-	vex_l      = 0;
-	vex_round  = rnd_off;
-	vex_sae    = false;
-
-	flags = ::error;
+	return count;
 }
 
-/* -- decode legacy prefixes the same way CPU does ------------------------- */
-void ssde_x86::decode_prefixes()
+/*
+* The length map. At most offsets in code there is no prefix and a one
+* byte opcode, the length of those is a fixed part, given by the opcode
+* alone, plus whatever Mod R/M, SIB and displacement add. SIMD kernels
+* look both up for 16 or 32 offsets at a time; offsets with prefixes,
+* escapes, VEX, F6 and F7 are left to length_at().
+*/
+
+/* -- fixed part of length of one byte opcodes, | 0x10 if Mod R/M follows -- */
+template <bool x64>
+static const uint8_t *simple_lengths()
 {
-	for (int x = 0; x < 14; ++x, ++length)
-		/*
-		* This is prefix analyzer. It behaves exactly the
-		* same way real CPUs analyze instructions for
-		* prefixes. Normally, each instruction is allowed
-		* to have up to 4 prefixes from each group. Though,
-		* in cases when instruction has more prefixes, it
-		* will ignore any prefix it meets if there was a
-		* prefix from the same group before it. Instruction
-		* decoders can only handle words up to 15 bytes long,
-		* if the word is longer than that, decoder will fail.
-		*/
+	struct table
 	{
-		uint8_t prefix = buffer[ip + length];
+		uint8_t length[256];
 
-		/* 1st group */
-		if (prefix == p_lock  ||
-		    prefix == p_repnz ||
-		    prefix == p_repz)
+		table()
 		{
-			if (group1 == p_none)
-				group1 = prefix;
-
-			continue;
-		}
+			for (int b = 0; b < 256; ++b)
+			{
+				uint8_t  group = ssde_x86_op::prefix[b];
+				uint16_t flags = ssde_x86_op::desc[ssde_x86_op::cls::table[b]];
 
-		/* 2nd group */
-		if (prefix == p_seg_cs || prefix == p_seg_ss ||
-		    prefix == p_seg_ds || prefix == p_seg_es ||
-		    prefix == p_seg_fs || prefix == p_seg_gs
-			/* p_branch_not_taken, p_branch_taken, */)
-		{
-			if (group2 == p_none)
-				group2 = prefix;
+				length[b] = 0;
 
-			continue;
-		}
+				if ((group != ssde_x86_op::g_none && (x64 || group != ssde_x86_op::g_rex)) ||
+				    b == 0x0f || b == 0xc4 || b == 0xc5 || b == 0x62 || b == 0xf6 || b == 0xf7)
+					/* left to length_at() */
+				{
+					continue;
+				}
 
-		/* 3rd group */
-		if (prefix == p_66)
-		{
-			if (group3 == p_none)
-				group3 = prefix;
+				if (flags == ssde_x86_op::error || (x64 && flags & ssde_x86_op::o32))
+				{
+					length[b] = 1;
+					continue;
+				}
 
-			continue;
-		}
+				/* same as length_at() without any prefixes */
+				int imm_size  = 0;
+				int imm2_size = 0;
 
-		/* 4th group */
-		if (prefix == p_67)
-		{
-			if (group4 == p_none)
-				group4 = prefix;
+				if (flags & ssde_x86_op::am)
+				{
+					imm_size = x64 ? 8 : 4;
+				}
+				else
+				{
+					if (flags & ssde_x86_op::i32)
+						imm_size = 4;
 
-			continue;
-		}
+					if (flags & ssde_x86_op::i16)
+						(imm_size ? imm2_size : imm_size) = 2;
 
-		break;
-	}
-}
+					if (flags & ssde_x86_op::i8)
+						(imm_size ? imm2_size : imm_size) = 1;
+				}
 
-/* -- read opcode bytes or decode them from VEX ---------------------------- */
-void ssde_x86::decode_opcode()
-{
-	if ((static_cast<uint8_t>(buffer[ip + length]) == 0xc4 ||
-	     static_cast<uint8_t>(buffer[ip + length]) == 0xc5 ||
-	     static_cast<uint8_t>(buffer[ip + length]) == 0x62) &&
-	    (buffer[ip + length+1] & 0xc0) == 0xc0)
-		/* looks like we've found a VEX prefix */
-	{
-		has_vex = true;
+				length[b] = static_cast<uint8_t>(1 + imm_size + imm2_size);
 
-		if (group1 != 0 ||
-		    group2 != 0 ||
-		    group3 != 0 ||
-		    group4 != 0)
-			/* VEX-encoded instructions are not allowed to be preceeded by legacy prefixes */
-		{
-			error = true;
-			error_opcode = true;
+				if (flags & ssde_x86_op::rm)
+					length[b] |= 0x10;
+			}
 		}
+	};
 
+	static const table t;
 
-		uint8_t prefix = buffer[ip + length++];
+	return t.length;
+}
 
-		if (prefix == 0x62)
-			/* this is a 4 byte VEX */
-		{
-			vex_size = 4;
+#ifdef SSDE_SIMD
+/*
+* Length of Mod R/M, SIB and displacement, indexed by mod << 3 | rm.
+* SIB base 5 with mod 0 adds another 4 bytes.
+*/
+#define SSDE_MODRM_LENGTHS_0 1, 1, 1, 1, 2, 5, 1, 1,  2, 2, 2, 2, 3, 2, 2, 2
+#define SSDE_MODRM_LENGTHS_1 5, 5, 5, 5, 6, 5, 5, 5,  1, 1, 1, 1, 1, 1, 1, 1
 
+/* -- length map, 32 offsets at a time ------------------------------------ */
+template <bool x64>
+__attribute__((target("avx2")))
+static size_t length_map_avx2(const uint8_t *code, size_t size, uint8_t *lengths)
+{
+	const uint8_t *simple = simple_lengths<x64>();
 
-			uint8_t vex_1 = buffer[ip + length++];
-			uint8_t vex_2 = buffer[ip + length++];
-			uint8_t vex_3 = buffer[ip + length++];
+	__m256i table[16];
 
-			vex_decode_mm(vex_1 & 0x03);
-			
+	for (int k = 0; k < 16; ++k)
+		table[k] = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(simple + k*16)));
 
-			/* determine destination register from vvvv */
-			vex_reg = (~vex_2 >> 3) & 0x0f | (vex_3 & 0x80 ? 0x10 : 0);
+	const __m256i modrm_0 = _mm256_setr_epi8(SSDE_MODRM_LENGTHS_0, SSDE_MODRM_LENGTHS_0);
+	const __m256i modrm_1 = _mm256_setr_epi8(SSDE_MODRM_LENGTHS_1, SSDE_MODRM_LENGTHS_1);
 
-			vex_decode_pp(vex_2 & 0x03);
+	const __m256i nibble = _mm256_set1_epi8(0x0f);
+	const __m256i zero   = _mm256_setzero_si256();
 
-			vex_zero = vex_3 & 0x80 ? true : false;
-			vex_l    = (vex_3 >> 5) & 0x03;
+	size_t i = 0;
 
-			vex_sae  = vex_3 & 0x10 ? true : false;
+	for (; i + 32 + ssde::window <= size; i += 32)
+	{
+		__m256i b0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(code + i));
+		__m256i b1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(code + i + 1));
+		__m256i b2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(code + i + 2));
 
-			vex_opmask = vex_3 & 0x07;
-			
-			if (vex_rc)
-				/* rounding control, implies vector is 512 bits wide */
-			{
-				vex_round = vex_l;
-				vex_l     = 0x02;
-			}
-			else if (vex_l == 0x03)
-				/* destination vector can't be wider than 512 bits */
-			{
-				error = true;
-				error_operand = true;
-			}
-		}
-		else
-			/* 2 or 3 byte VEX */
-		{
-			if (prefix == 0xc4)
-				/* this is a 3 byte VEX */
-			{
-				vex_size = 3;
+		/* 256 entry lookup of the opcode, a 16 entry shuffle per high nibble */
+		__m256i lo   = _mm256_and_si256(b0, nibble);
+		__m256i hi   = _mm256_and_si256(_mm256_srli_epi16(b0, 4), nibble);
+		__m256i info = zero;
 
+		for (int k = 0; k < 16; ++k)
+		{
+			__m256i match = _mm256_cmpeq_epi8(hi, _mm256_set1_epi8(static_cast<char>(k)));
+			info = _mm256_or_si256(info, _mm256_and_si256(match, _mm256_shuffle_epi8(table[k], lo)));
+		}
 
-				uint8_t vex_1 = buffer[ip + length++];
-				vex_decode_mm(vex_1 & 0x1f);
-			}
-			else
-				/* this is a 2 byte VEX */
-			{
-				vex_size = 2;
-				opcode1  = 0x0f;
-			}
+		/* Mod R/M, SIB and displacement */
+		__m256i index = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(b1, 3), _mm256_set1_epi8(0x18)),
+		                                _mm256_and_si256(b1, _mm256_set1_epi8(0x07)));
 
+		__m256i high  = _mm256_cmpeq_epi8(_mm256_and_si256(index, _mm256_set1_epi8(0x10)), _mm256_set1_epi8(0x10));
+		__m256i modrm = _mm256_blendv_epi8(_mm256_shuffle_epi8(modrm_0, index), _mm256_shuffle_epi8(modrm_1, index), high);
 
-			uint8_t vex_2 = buffer[ip + length++];
+		__m256i sib_5 = _mm256_and_si256(_mm256_cmpeq_epi8(index, _mm256_set1_epi8(0x04)),
+		                                 _mm256_cmpeq_epi8(_mm256_and_si256(b2, _mm256_set1_epi8(0x07)), _mm256_set1_epi8(0x05)));
 
-			vex_l = vex_2 & 0x04 ? 1 : 0;
+		modrm = _mm256_add_epi8(modrm, _mm256_and_si256(sib_5, _mm256_set1_epi8(4)));
 
-			/* determine destination register from vvvv */
-			vex_reg = (~vex_2 >> 3) & 0x0f;
+		__m256i has_modrm = _mm256_cmpeq_epi8(_mm256_and_si256(info, _mm256_set1_epi8(0x10)), _mm256_set1_epi8(0x10));
+		__m256i length    = _mm256_add_epi8(_mm256_and_si256(info, nibble), _mm256_and_si256(has_modrm, modrm));
 
-			vex_decode_pp(vex_2 & 0x03);
-		}
-	}
-	else
-		/* instruction operands are written normal way */
-	{
-		opcode1 = buffer[ip + length++];
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(lengths + i), length);
 
-		if (opcode1 == 0x0f)
-		{
-			opcode2 = buffer[ip + length++];
-		}
-		else
-			/* this is a regular single opcode instruction */
+		for (uint32_t slow = _mm256_movemask_epi8(_mm256_cmpeq_epi8(info, zero)); slow; slow &= slow - 1)
+			/* prefixes, escapes and such */
 		{
-			flags = op_table[opcode1];
-		}
-	}
+			size_t at = i + __builtin_ctz(slow);
 
-	if (opcode1 == 0x0f)
-		/* decode 2nd or 3rd opcode byte */
-	{
-		switch (opcode2)
-		{
-		case 0x38:
-			opcode3 = buffer[ip + length++];
-			flags   = op_table_38[opcode3];
-			break;
-
-		case 0x3a:
-			opcode3 = buffer[ip + length++];
-			flags   = op_table_3a[opcode3];
-			break;
-
-		default:
-			opcode2 = buffer[ip + length++];
-			flags   = opcode2;
-			break;
+			lengths[at] = static_cast<uint8_t>(ssde_x86_engine<x64>::length_at(code + at));
 		}
 	}
 
-	if (flags & ::vx && !has_vex)
-		/* this instruction can only be VEX-encoded */
-	{
-		error = true;
-		error_novex = true;
-	}
-
-	if (opcode1 == 0xf6 || opcode1 == 0xf7)
-		/*
-		* These are two exceptional opcodes that extend
-		* using 3 bits of Mod R/M byte and they lack
-		* consistent flags. Instead of creating a new
-		* flags table for each extended opcode, I decided
-		* to put this little bit of code that is dedicated
-		* to these two exceptional opcodes.
-		*/
-	{
-		switch (buffer[ip + length] >> 3 & 0x07)
-		{
-		case 0x00:
-		case 0x01:
-			{
-				if (opcode1 == 0xf6)
-					flags = rm | i8;
-
-				if (opcode1 == 0xf7)
-					flags = rm | i32;
-			}
-			break;
-
-		default:
-			flags = rm;
-			break;
-		}
-	}
+	return i;
 }
 
-/* -- decodes a Mod R/M byte ----------------------------------------------- */
-void ssde_x86::decode_modrm()
+/* -- length map, 16 offsets at a time ------------------------------------ */
+template <bool x64>
+__attribute__((target("ssse3")))
+static size_t length_map_ssse3(const uint8_t *code, size_t size, uint8_t *lengths)
 {
-	uint8_t modrm_byte = buffer[ip + length++];
+	const uint8_t *simple = simple_lengths<x64>();
 
-	has_modrm = true;
-	modrm_mod = modrm_byte >> 6 & 0x03;
-	modrm_reg = modrm_byte >> 3 & 0x07;
-	modrm_rm  = modrm_byte      & 0x07;
+	__m128i table[16];
 
-	switch (modrm_mod)
-	{
-	case 0x00:
-		if (group4 == p_67)
-		{
-			if (modrm_rm == 0x06)
-			{
-				has_disp  = true;
-				disp_size = 2;
-			}
-		}
-		else
-		{
-			if (modrm_rm == 0x04)
-				has_sib = true;
+	for (int k = 0; k < 16; ++k)
+		table[k] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(simple + k*16));
 
-			if (modrm_rm == 0x05)
-			{
-				has_disp  = true;
-				disp_size = 4;
-			}
-		}
-		break;
+	const __m128i modrm_0 = _mm_setr_epi8(SSDE_MODRM_LENGTHS_0);
+	const __m128i modrm_1 = _mm_setr_epi8(SSDE_MODRM_LENGTHS_1);
 
-	case 0x01:
-		{
-			if (group4 != p_67 && modrm_rm == 0x04)
-				has_sib = true;
+	const __m128i nibble = _mm_set1_epi8(0x0f);
+	const __m128i zero   = _mm_setzero_si128();
 
-			has_disp  = true;
-			disp_size = 1;
-		}
-		break;
+	size_t i = 0;
 
-	case 0x02:
-		{
-			if (group4 != p_67 && modrm_rm == 0x04)
-				has_sib = true;
+	for (; i + 16 + ssde::window <= size; i += 16)
+	{
+		__m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(code + i));
+		__m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(code + i + 1));
+		__m128i b2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(code + i + 2));
 
-			has_disp  = true;
-			disp_size = group4 != p_67 ? 4 : 2;
-		}
-		break;
+		/* 256 entry lookup of the opcode, a 16 entry shuffle per high nibble */
+		__m128i lo   = _mm_and_si128(b0, nibble);
+		__m128i hi   = _mm_and_si128(_mm_srli_epi16(b0, 4), nibble);
+		__m128i info = zero;
 
-	case 0x03:
-		if (group1 == p_lock)
-			/* LOCK prefix is not allowed to be used with Mod R */
+		for (int k = 0; k < 16; ++k)
 		{
-			error = true;
-			error_lock = true;
+			__m128i match = _mm_cmpeq_epi8(hi, _mm_set1_epi8(static_cast<char>(k)));
+			info = _mm_or_si128(info, _mm_and_si128(match, _mm_shuffle_epi8(table[k], lo)));
 		}
-		break;
-
-	default:
-		break;
-	}
-}
 
-/* -- decodes SIB byte ----------------------------------------------------- */
-void ssde_x86::decode_sib()
-{
-	uint8_t sib_byte = buffer[ip + length++];
+		/* Mod R/M, SIB and displacement, no blendv before SSE4.1 */
+		__m128i index = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(b1, 3), _mm_set1_epi8(0x18)),
+		                             _mm_and_si128(b1, _mm_set1_epi8(0x07)));
 
-	sib_scale = 1 << (sib_byte >> 6 & 0x03);
-	sib_index = sib_byte >> 3 & 0x07;
-	sib_base  = sib_byte      & 0x07;
-}
+		__m128i high  = _mm_cmpeq_epi8(_mm_and_si128(index, _mm_set1_epi8(0x10)), _mm_set1_epi8(0x10));
+		__m128i modrm = _mm_or_si128(_mm_andnot_si128(high, _mm_shuffle_epi8(modrm_0, index)),
+		                             _mm_and_si128(high, _mm_shuffle_epi8(modrm_1, index)));
 
-/* -- decodes a moffs, imm or rel operand ---------------------------------- */
-void ssde_x86::decode_imm()
-{
-	if (flags & ::am)
-		/* address mode instructions behave a little differently */
-	{
-		has_imm  = true;
-		imm_size = group4 != p_67 ? 4 : 2;
-	}
-	else
-	{
-		if (flags & ::i32)
-		{
-			has_imm  = true;
-			imm_size = group3 != p_66 ? 4 : 2;
-		}
+		__m128i sib_5 = _mm_and_si128(_mm_cmpeq_epi8(index, _mm_set1_epi8(0x04)),
+		                              _mm_cmpeq_epi8(_mm_and_si128(b2, _mm_set1_epi8(0x07)), _mm_set1_epi8(0x05)));
 
-		if (flags & ::i16)
-		{
-			if (has_imm)
-			{
-				has_imm2  = true;
-				imm2_size = 2;
-			}
-			else
-			{
-				has_imm  = true;
-				imm_size = 2;
-			}
-		}
+		modrm = _mm_add_epi8(modrm, _mm_and_si128(sib_5, _mm_set1_epi8(4)));
 
-		if (flags & ::i8)
-		{
-			if (has_imm)
-			{
-				has_imm2  = true;
-				imm2_size = 1;
-			}
-			else
-			{
-				has_imm  = true;
-				imm_size = 1;
-			}
-		}
-	}
-
-	if (has_imm)
-	{
-		imm = 0;
-
-		for (int i = 0; i < imm_size; ++i)
-			imm |= buffer[ip + length++] << i*8;
+		__m128i has_modrm = _mm_cmpeq_epi8(_mm_and_si128(info, _mm_set1_epi8(0x10)), _mm_set1_epi8(0x10));
+		__m128i length    = _mm_add_epi8(_mm_and_si128(info, nibble), _mm_and_si128(has_modrm, modrm));
 
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(lengths + i), length);
 
-		if (has_imm2)
+		for (uint32_t slow = _mm_movemask_epi8(_mm_cmpeq_epi8(info, zero)); slow; slow &= slow - 1)
+			/* prefixes, escapes and such */
 		{
-			imm2 = 0;
+			size_t at = i + __builtin_ctz(slow);
 
-			for (int i = 0; i < imm2_size; ++i)
-				imm2 |= buffer[ip + length++] << i*8;
+			lengths[at] = static_cast<uint8_t>(ssde_x86_engine<x64>::length_at(code + at));
 		}
 	}
 
-	if (flags & ::rel)
-		/* this instruction has relative address, move imm to rel */
-	{
-		has_imm = false;
-
-		rel_size = imm_size;
-		rel = imm;
-
-		if (rel & (1 << (rel_size*8 - 1)))
-			/* rel is signed, extend the sign if needed */
-		{
-			switch (rel_size)
-			{
-			case 1:
-				rel |= 0xffffff00;
-				break;
-
-			case 2:
-				rel |= 0xffff0000;
-				break;
+	return i;
+}
+#endif
 
-			default:
-				break;
-			}
-		}
+/* -- lengths of instructions at every offset of code --------------------- */
+template <bool x64>
+void ssde_x86_engine<x64>::length_map(const uint8_t *code, size_t size, uint8_t *lengths)
+{
+	size_t i = 0;
 
-		abs = ip + length + rel;
+#ifdef SSDE_SIMD
+	if (__builtin_cpu_supports("avx2"))
+		i = length_map_avx2<x64>(code, size, lengths);
+	else if (__builtin_cpu_supports("ssse3"))
+		i = length_map_ssse3<x64>(code, size, lengths);
+#endif
 
-		has_rel = true;
-	}
-}
+	for (; i + window <= size; ++i)
+		lengths[i] = static_cast<uint8_t>(length_at(code + i));
 
-/* -- decode SIMD prefix from pp field of VEX ------------------------------ */
-void ssde_x86::vex_decode_pp(uint8_t pp)
-{
-	switch (pp)
+	for (; i < size; ++i)
+		/* same as dec(), instructions running past the end keep their length */
 	{
-	case 0x01:
-		group3 = p_66;
-		break;
-
-	case 0x02:
-		group1 = p_repz;
-		break;
+		uint8_t tail[window] = {};
 
-	case 0x03:
-		group1 = p_repnz;
-		break;
+		memcpy(tail, code + i, size - i);
 
-	default:
-		break;
+		lengths[i] = static_cast<uint8_t>(length_at(tail));
 	}
 }
 
-/* -- determine opcode bytes from mm field of VEX -------------------------- */
-void ssde_x86::vex_decode_mm(uint8_t mm)
-{
-	switch (mm)
-	{
-	case 0x01:
-		opcode1 = 0x0f;
-		break;
-
-	case 0x02:
-		opcode1 = 0x0f;
-		opcode2 = 0x38;
-		break;
-
-	case 0x03:
-		opcode1 = 0x0f;
-		opcode2 = 0x3a;
-		break;
-
-	default:
-		error = true;
-		error_opcode = true;
-		break;
-	}
-}
\ No newline at end of file
+/* both modes are compiled here, ssde_x64 needs this file as well */
+template class ssde_x86_engine<false>;
+template class ssde_x86_engine<true>;
@@ -4,15 +4,119 @@
 */
 #pragma once
 #include "ssde.hpp"
+#include "ssde_profile.hpp"
 
 /*
-* SSDE disassembler for X86 architecture.
+* Opcode flags, opcode class tables and prefix classes shared by the X86
+* and X86-64 decoders, see ssde_x86.cpp.
 */
-class ssde_x86 final : public ssde
+struct ssde_x86_op
+{
+	enum : uint16_t
+	{
+		none = 0,
+
+		rm  = 1 << 0,  // expect Mod byte
+		ox  = 1 << 1,  // expect Mod opcode extension + change behaviour of REX.B
+		rel = 1 << 2,  // instruction's imm is a relative address
+		i8  = 1 << 3,  // has  8 bit imm
+		i16 = 1 << 4,  // has 16 bit imm
+		i32 = 1 << 5,  // has 32 bit imm, which can be turned to 16 with 66 prefix (not with REX.W)
+		rw  = 1 << 6,  // supports REX.W
+		am  = 1 << 7,  // instruction uses address mode, imm is a memory address
+		vx  = 1 << 8,  // instruction requires a VEX prefix
+		mp  = 1 << 9,  // instruction has a mandatory 66 prefix
+		o32 = 1 << 10, // instruction is invalid in 64 bit mode
+
+		ex  = rm  | ox,
+		r8  = i8  | rel,
+		r32 = i32 | rel,
+
+		error = (uint16_t)-1
+	};
+
+	/*
+	* There are only a couple dozen distinct combinations of flags, so
+	* opcode tables hold a byte wide class and flags of each class are
+	* kept in desc. Both modes share the tables, opcodes that only exist
+	* outside of 64 bit mode have o32 in their class.
+	*/
+	struct cls
+	{
+		enum : uint8_t
+		{
+			none, rm, ex, i8, rm_i8, ex_i8, r8, i16, i16_i8, i32, rm_i32, ex_i32,
+			r32, rw_i32, am, vx_rm, vx_rm_i8, mp_rm, mp_rm_i8,
+
+			none_o32, rm_o32, i8_o32, rm_i8_o32, ptr_o32,
+
+			error
+		};
+
+		static const uint8_t table[256];    // 1st opcode class table.
+		static const uint8_t table_0f[256]; // 2nd opcode class table, 0F xx.
+		static const uint8_t table_38[256]; // 3rd opcode class table, 0F 38 xx.
+		static const uint8_t table_3a[256]; // 3rd opcode class table, 0F 3A xx.
+	};
+
+	static const uint16_t desc[cls::error + 1]; // Opcode flags of each class.
+
+	/*
+	* Flow control classes of legacy opcodes, VEX-encoded ones have none.
+	* Classes of opcodes extended by Mod R/M reg are ext in the tables,
+	* those are looked up by reg in a table of their own.
+	*/
+	struct flow
+	{
+		enum : uint8_t
+		{
+			none     = ssde_insn::flow_none,
+			jcc      = ssde_insn::flow_jcc,
+			jmp      = ssde_insn::flow_jmp,
+			call     = ssde_insn::flow_call,
+			ret      = ssde_insn::flow_ret,
+			jmp_ind  = ssde_insn::flow_jmp_indirect,
+			call_ind = ssde_insn::flow_call_indirect,
+			syscall  = ssde_insn::flow_syscall,
+			intr     = ssde_insn::flow_interrupt,
+			halt     = ssde_insn::flow_halt,
+
+			ext      = 0xff
+		};
+
+		static const uint8_t table[256];    // 1st opcode flow table.
+		static const uint8_t table_0f[256]; // 2nd opcode flow table, 0F xx.
+		static const uint8_t table_ff[8];   // FF /reg flow table, the only ext opcode.
+	};
+
+	/*
+	* Prefix classes. REX only is a prefix in 64 bit mode.
+	*/
+	enum : uint8_t
+	{
+		g_none,
+		g_1,
+		g_2,
+		g_3,
+		g_4,
+		g_rex
+	};
+
+	static const uint8_t prefix[256];       // Prefix class of each byte.
+};
+
+
+/*
+* Decoder engine shared by the X86 and X86-64 disassemblers. x64 selects
+* 64 bit mode: REX prefixes, 8 byte immediates and moffs, 32 bit address
+* size override and opcodes invalid in 64 bit mode.
+*/
+template <bool x64>
+class ssde_x86_engine : public ssde
 {
 public:
 	/*
-	* X86 Prefixes.
+	* Legacy X86 prefixes.
 	*/
 	enum : uint8_t
 	{
@@ -32,97 +136,1051 @@ public:
 
 		p_branch_not_taken = 0x2e,          // Branch not taken hint.
 		p_branch_taken     = 0x3e,          // Branch taken hint.
-
-		p_precision_double = 0xf2,          // Double precision scalar prefix
-		p_precision_single = 0xf3,          // Single precision scalar prefix
 	};
 
+	enum : unsigned { address_bits = x64 ? 64 : 32 }; // Width of abs, relative targets wrap around at it.
+
+	using ssde::ssde;
+
 	/*
-	* EVEX rounding modes.
+	* Decode instruction pointed by IP, non-virtual dec(). mask is a set of
+	* ssde::fields, work and stores for fields outside of it are compiled
+	* out, e.g. decode<fields::length | fields::rel>() is enough for CFGs.
 	*/
-	enum : uint8_t
-	{
-		rnd_rne = 0x00,                     //
-		rnd_rd  = 0x01,                     //
-		rnd_ru  = 0x02,                     //
-		rnd_rz  = 0x03,                     //
+	template <unsigned mask = fields::all>
+	bool decode();
 
-		rnd_off = (uint8_t)-1               // 
-	};
+	/*
+	* Decode up to max_count instructions starting at begin into out.
+	* Returns the number of instructions decoded, IP is left pointing
+	* to the first instruction that wasn't decoded.
+	*/
+	size_t decode_batch(size_t begin, size_t max_count, ssde_batch &out);
 
-	using ssde::ssde;
+	/*
+	* Length of the instruction at code, as dec() would report it. Doesn't
+	* touch any fields, so it's the way to go for hooking and boundary
+	* scanning. Reads up to ssde::window bytes past code, the overload
+	* taking a size is bounds checked.
+	*/
+	static int length_at(const uint8_t *code);
 
-	bool dec() override final;
+	/*
+	* Lengths of the instructions at every offset of code: lengths[i] is
+	* what dec() reports with IP at i, instructions running past the end
+	* included. Uses SSSE3 or AVX2 if the CPU has them, unless built with
+	* SSDE_NO_SIMD. lengths has to have room for size bytes.
+	*/
+	static void length_map(const uint8_t *code, size_t size, uint8_t *lengths);
 
 private:
+	typedef ssde_x86_op op;
+
+	static uint16_t lookup(const uint8_t *table, uint8_t opcode);
+
 	void reset_fields();
 
 	void decode_prefixes();
-	void decode_opcode();
-	void decode_modrm();
-	void decode_sib();
-	void decode_imm();
+	template <unsigned mask> void decode_opcode();
+	void decode_0f(uint8_t map);
+	template <unsigned mask> void decode_modrm();
+	template <unsigned mask> void decode_sib();
+	template <unsigned mask> void decode_imm();
 
 	void vex_decode_pp(uint8_t pp);
 	void vex_decode_mm(uint8_t mm);
 
+private:
+	uint16_t flags  = 0;                    // Opcode flags of the instruction.
+	int      cursor = 0;                    // Position of the decoder, relative to IP.
+};
+
+
+/*
+* SSDE disassembler for X86 architecture.
+*/
+class ssde_x86 final : public ssde_impl<ssde_x86, ssde_x86_engine<false>>
+{
 public:
-	bool error_lock = false;                // LOCK prefix is not allowed.
-	bool error_novex = false;               // Instruction is only allowed to be VEX encoded.
-
-	uint8_t group1 = 0;                     // Opcode prefix in 1st group, 0 if none. 1st group includes LOCK, REPNZ and REPZ prefixes.
-	uint8_t group2 = 0;                     // Opcode prefix in 2nd group, 0 if none. 2nd group includes segment prefixes and/or branch hints.
-	uint8_t group3 = 0;                     // Opcode prefix in 3rd group, 0 if none. 3rd group includes operand-size override prefix (p_66)
-	uint8_t group4 = 0;                     // Opcode prefix in 4th group, 0 if none. 4th group includes address-size override prefix (p_67)
-	
-	bool    has_vex    = false;             // Has VEX prefix.
-	bool    vex_zero   = false;             // Should zero or merge?; z field.
-	uint8_t vex_size   = 0;                 // Size of VEX prefix (usually 2 or 3 bytes).
-	uint8_t vex_reg    = 0;                 // VEX register specifier.
-	uint8_t vex_opmask = 0;                 // VEX opmask register specifier.
-	/* VEX.W, VEX.R, VEX.X, VEX.B have no effect in 32 bit mode */
-	uint8_t vex_l      = 0;                 // VEX L field.
-	uint8_t vex_round  = rnd_off;           // Rounding mode.
-	
-	union
-	{
-		bool vex_sae = false;               // Suppress exceptions.
-		bool vex_rc;                        // Rounding control.
-		bool vex_broadcast;                 // Broadcast single element across the destination register.
+	/*
+	* X86 Prefixes, in addition to the legacy ones.
+	*/
+	enum : uint8_t
+	{
+		p_precision_double = 0xf2,          // Double precision scalar prefix
+		p_precision_single = 0xf3,          // Single precision scalar prefix
 	};
 
+	using ssde_impl::ssde_impl;
 
-	uint8_t opcode1 = 0;                    // 1st opcode byte.
-	uint8_t opcode2 = 0;                    // 2nd opcode byte.
-	uint8_t opcode3 = 0;                    // 3rd opcode byte.
+	using ssde_impl::length_at;
+	using ssde_x86_engine::length_at;
+};
 
-	bool    has_modrm = false;              // Has Mod R/M byte.
-	uint8_t modrm_mod = 0;                  // Mod R/M address mode.
-	uint8_t modrm_reg = 0;                  // Register number or opcode information.
-	uint8_t modrm_rm  = 0;                  // Operand register.
 
-	bool    has_sib   = false;              // Has SIB byte.
-	uint8_t sib_scale = 0;                  // Index scale factor.
-	uint8_t sib_index = 0;                  // Index register.
-	uint8_t sib_base  = 0;                  // Base register.
+/*
+* The decoder is defined in the header, so that decode(), dec() and
+* length_at() can be inlined into loops of the caller.
+*/
 
-	bool    has_disp  = false;              // Has address displacement.
-	int     disp_size = 0;                  // Size of address displacement, in bytes.
-	int32_t disp      = 0;                  // Displacement value.
+/* -- decodes instruction pointed by IP ------------------------------------ */
+template <bool x64>
+template <unsigned mask>
+inline bool ssde_x86_engine<x64>::decode()
+{
+	if (!fetch())
+		return false;
 
+	reset_fields();
 
-	bool     has_imm   = false;             // Has immediate value.
-	bool     has_imm2  = false;             // Has 2 immediate values.
-	int      imm_size  = 0;                 // Size of the first immediate value, in bytes.
-	int      imm2_size = 0;                 // Size of the second immediate value, in bytes.
-	uint32_t imm       = 0;                 // First immediate value.
-	uint32_t imm2      = 0;                 // Second immediate value.
+	SSDE_PROFILE_START();
 
-	bool     has_rel  = false;              // Has relative address.
-	int      rel_size = 0;                  // Size of relative address, in bytes.
-	int32_t  rel      = 0;                  // Relative address value.
-	uint32_t abs      = 0;                  // Absolute address value.
+	decode_prefixes();
 
-private:
-	uint16_t flags;
-};
+	SSDE_PROFILE_ADD(event_prefix_bytes, cursor);
+	SSDE_PROFILE_STAGE(stage_prefixes);
+
+	decode_opcode<mask>();
+
+	SSDE_PROFILE_STAGE(stage_opcode);
+
+	if (flags != op::error)
+		/* it's not a bullshit instruction */
+	{
+		if (!has_vex)
+			/* flow control class, cursor is at Mod R/M if there is one */
+		{
+			uint8_t f = opcode1 == 0x0f ? op::flow::table_0f[opcode2] : op::flow::table[opcode1];
+
+			if (f == op::flow::ext)
+				f = op::flow::table_ff[bytes[cursor] >> 3 & 0x07];
+
+			if (opcode1 == 0xc7 && bytes[cursor] == 0xf8)
+				/* XBEGIN, its imm is the relative address of the abort handler */
+			{
+				flags |= op::rel;
+				f      = op::flow::jcc;
+			}
+
+			flow = f;
+		}
+
+		if (flags & op::mp && group3 != p_66)
+			/* this instruction lacks mandatory 66 prefix */
+		{
+			error = true;
+			error_opcode = true;
+		}
+
+		if (flags & op::rm)
+			/* this instruction has a Mod byte, decode it */
+		{
+			decode_modrm<mask>();
+
+			if (has_sib)
+				/* if instruction has a SIB byte, decode it, too */
+			{
+				decode_sib<mask>();
+			}
+
+			if (has_disp && !(mask & fields::disp))
+				/* displacement value wasn't asked for, skip it */
+			{
+				cursor += disp_size;
+			}
+			else if (has_disp)
+				/* if instruction has displacement value, read it */
+			{
+				disp = static_cast<int32_t>(load(bytes + cursor, disp_size));
+				cursor += disp_size;
+
+				if (disp & (1 << (disp_size*8 - 1)))
+					/* disp is signed, extend the sign if needed */
+				{
+					switch (disp_size)
+					{
+					case 1:
+						disp |= 0xffffff00;
+						break;
+
+					case 2:
+						disp |= 0xffff0000;
+						break;
+
+					default:
+						break;
+					}
+				}
+			}
+
+			if (x64)
+				/* perform Mod R/M and/or SIB REX extensions */
+			{
+				if (has_sib)
+				{
+					if (mask & fields::modrm)
+						modrm_reg |= rex_r ? 0x08 : 0;
+
+					if (mask & fields::sib)
+					{
+						sib_index |= rex_x ? 0x08 : 0;
+						sib_base  |= rex_b ? 0x08 : 0;
+					}
+				}
+				else if (mask & fields::modrm)
+				{
+					if (flags & op::ox)
+						/* Mod extended opcodes are extended differently */
+					{
+						modrm_reg |= rex_b ? 0x08 : 0;
+					}
+					else
+					{
+						modrm_reg |= rex_r ? 0x08 : 0;
+						modrm_rm  |= rex_b ? 0x08 : 0;
+					}
+				}
+			}
+
+			SSDE_PROFILE_STAGE(stage_modrm);
+		}
+		else if (group1 == p_lock)
+			/* LOCK prefix only makes sense for Mod M */
+		{
+			error = true;
+			error_lock = true;
+		}
+
+		/* decode moffs, imm or rel */
+		decode_imm<mask>();
+
+		SSDE_PROFILE_STAGE(stage_imm);
+
+
+		if (cursor > 15)
+			/* CPU can't handle instructions longer than 15 bytes */
+		{
+			cursor = 15;
+
+			error = true;
+			error_length = true;
+		}
+
+		length = cursor;
+	}
+	else
+	{
+		error = true;
+		error_opcode = true;
+
+		length = 1;
+	}
+
+	check_truncated();
+
+	SSDE_PROFILE_INSN(*this);
+
+	return true;
+}
+
+/* -- length-only decoder, no fields are touched --------------------------- */
+template <bool x64>
+inline int ssde_x86_engine<x64>::length_at(const uint8_t *code)
+{
+	int length = 0;
+
+	bool rex_w = false;
+	bool p66   = false;
+	bool p67   = false;
+
+	for (int x = 0; x < 14; ++x, ++length)
+		/* same prefix rules as decode_prefixes(), only state that affects length is kept */
+	{
+		uint8_t prefix = code[length];
+		uint8_t group  = op::prefix[prefix];
+
+		if (group == op::g_none || (group == op::g_rex && !x64))
+			break;
+
+		if (group == op::g_rex)
+			rex_w = prefix & 0x08 ? true : false;
+		else
+			rex_w = false;
+
+		if (group == op::g_3)
+			p66 = true;
+		else if (group == op::g_4)
+			p67 = true;
+	}
+
+	uint8_t        opcode1 = code[length];
+	const uint8_t *table   = op::cls::table_0f;
+	uint16_t       flags;
+
+	if ((opcode1 == 0xc4 || opcode1 == 0xc5 || opcode1 == 0x62) &&
+	    (x64 || (code[length + 1] & 0xc0) == 0xc0))
+		/* VEX, only mm, pp and W fields matter */
+	{
+		uint8_t mm = 0x01;
+		uint8_t pp;
+
+		++length;
+
+		if (opcode1 == 0x62)
+		{
+			mm    = code[length] & 0x03;
+			rex_w = code[length + 1] & 0x80 ? true : false;
+			pp    = code[length + 1] & 0x03;
+
+			length += 3;
+		}
+		else
+		{
+			if (opcode1 == 0xc4)
+			{
+				mm    = code[length] & 0x1f;
+				rex_w = code[length + 1] & 0x80 ? true : false;
+
+				++length;
+			}
+
+			pp = code[length++] & 0x03;
+		}
+
+		if (pp == 0x01)
+			p66 = true;
+
+		switch (mm)
+		{
+		case 0x01:
+			table = op::cls::table_0f;
+			break;
+
+		case 0x02:
+			table = op::cls::table_38;
+			break;
+
+		case 0x03:
+			table = op::cls::table_3a;
+			break;
+
+		default:
+			return 1;
+		}
+
+		opcode1 = 0x0f;
+	}
+	else
+	{
+		++length;
+
+		if (opcode1 == 0x0f && code[length] == 0x38)
+		{
+			table = op::cls::table_38;
+			++length;
+		}
+		else if (opcode1 == 0x0f && code[length] == 0x3a)
+		{
+			table = op::cls::table_3a;
+			++length;
+		}
+	}
+
+	if (opcode1 == 0x0f)
+		flags = lookup(table, code[length++]);
+	else
+		flags = lookup(op::cls::table, opcode1);
+
+	if (opcode1 == 0xf6 || opcode1 == 0xf7)
+		/* see decode_opcode() */
+	{
+		switch (code[length] >> 3 & 0x07)
+		{
+		case 0x00:
+		case 0x01:
+			flags = opcode1 == 0xf6 ? op::ex | op::i8 : op::ex | op::i32;
+			break;
+
+		default:
+			flags = op::rm;
+			break;
+		}
+	}
+
+	if (flags == op::error)
+		return 1;
+
+	if (flags & op::rm)
+	{
+		uint8_t modrm_byte = code[length++];
+		uint8_t modrm_mod  = modrm_byte >> 6 & 0x03;
+		uint8_t modrm_rm   = modrm_byte      & 0x07;
+
+		if (!x64 && p67)
+			/* 16 bit addressing */
+		{
+			switch (modrm_mod)
+			{
+			case 0x00:
+				length += modrm_rm == 0x06 ? 2 : 0;
+				break;
+
+			case 0x01:
+				length += 1;
+				break;
+
+			case 0x02:
+				length += 2;
+				break;
+
+			default:
+				break;
+			}
+		}
+		else if (modrm_mod != 0x03)
+		{
+			if (modrm_rm == 0x04)
+				/* SIB, base 5 without a Mod displacement takes a disp32 */
+			{
+				if (modrm_mod == 0x00 && (code[length] & 0x07) == 0x05)
+					length += 4;
+
+				++length;
+			}
+
+			if (modrm_mod == 0x00)
+				length += modrm_rm == 0x05 ? 4 : 0;
+			else
+				length += modrm_mod == 0x01 ? 1 : 4;
+		}
+	}
+
+	if (flags & op::am)
+	{
+		length += x64 ? (p67 ? 4 : 8) : (p67 ? 2 : 4);
+	}
+	else
+	{
+		/* same as decode_imm(), a 2nd immediate overrides the size of the 3rd one */
+		int imm_size  = 0;
+		int imm2_size = 0;
+
+		if (flags & op::i32)
+			imm_size = x64 && rex_w ? ((flags & op::rw) ? 8 : 4) : p66 ? 2 : 4;
+
+		if (flags & op::i16)
+			(imm_size ? imm2_size : imm_size) = 2;
+
+		if (flags & op::i8)
+			(imm_size ? imm2_size : imm_size) = 1;
+
+		length += imm_size + imm2_size;
+	}
+
+	return length > 15 ? 15 : length;
+}
+
+/* -- looks up opcode flags of the opcode in a class table ----------------- */
+template <bool x64>
+inline uint16_t ssde_x86_engine<x64>::lookup(const uint8_t *table, uint8_t opcode)
+{
+	uint16_t flags = op::desc[table[opcode]];
+
+	if (x64 && flags & op::o32)
+		/* this opcode doesn't exist in 64 bit mode */
+	{
+		flags = op::error;
+	}
+
+	return flags;
+}
+
+/* -- resets fields before new iteration of the instruction decoder -------- */
+template <bool x64>
+inline void ssde_x86_engine<x64>::reset_fields()
+{
+	reset();
+
+	cursor = 0;
+	flags  = op::error;
+}
+
+/* -- decode legacy prefixes (+ REX) the same way CPU does ----------------- */
+template <bool x64>
+inline void ssde_x86_engine<x64>::decode_prefixes()
+{
+	for (int x = 0; x < 14; ++x, ++cursor)
+		/*
+		* This is prefix analyzer. It behaves exactly the
+		* same way real CPUs analyze instructions for
+		* prefixes. Normally, each instruction is allowed
+		* to have up to 4 prefixes from each group. Though,
+		* in cases when instruction has more prefixes, it
+		* will ignore any prefix it meets if there was a
+		* prefix from the same group before it. Instruction
+		* decoders can only handle words up to 15 bytes long,
+		* if the word is longer than that, decoder will fail.
+		*/
+	{
+		uint8_t prefix = bytes[cursor];
+
+		switch (op::prefix[prefix])
+		{
+		case op::g_1:
+			/* LOCK, REPNZ, REPZ */
+			if (group1 == p_none)
+				group1 = prefix;
+			break;
+
+		case op::g_2:
+			/* segment prefixes and branch hints */
+			if (group2 == p_none)
+				group2 = prefix;
+			break;
+
+		case op::g_3:
+			/* operand size override */
+			if (group3 == p_none)
+				group3 = prefix;
+			break;
+
+		case op::g_4:
+			/* address size override */
+			if (group4 == p_none)
+				group4 = prefix;
+			break;
+
+		case op::g_rex:
+			if (x64)
+				/*
+				* Unlike all legacy prefixes, if CPU
+				* meets multiple of REX prefixes, it
+				* will only take the last one into
+				* account. REX prefixes before legacy
+				* ones are silently ignored.
+				*/
+			{
+				has_rex = true;
+
+				rex_w = prefix & 0x08 ? true : false;
+				rex_r = prefix & 0x04 ? true : false;
+				rex_x = prefix & 0x02 ? true : false;
+				rex_b = prefix & 0x01 ? true : false;
+
+				continue;
+			}
+			return;
+
+		default:
+			return;
+		}
+
+		if (x64 && has_rex)
+			/* a legacy prefix after REX, REX is ignored */
+		{
+			has_rex = false;
+
+			rex_w = false;
+			rex_r = false;
+			rex_x = false;
+			rex_b = false;
+		}
+	}
+}
+
+/* -- read opcode bytes or decode them from VEX ---------------------------- */
+template <bool x64>
+template <unsigned mask>
+inline void ssde_x86_engine<x64>::decode_opcode()
+{
+	if ((bytes[cursor] == 0xc4 ||
+	     bytes[cursor] == 0xc5 ||
+	     bytes[cursor] == 0x62) &&
+	    (x64 || (bytes[cursor + 1] & 0xc0) == 0xc0))
+		/*
+		* Looks like we've found a VEX prefix. Outside of
+		* 64 bit mode these are LES, LDS and BOUND unless
+		* Mod R/M byte that would follow them is Mod R.
+		*/
+	{
+		has_vex = true;
+
+		if (group1 != 0 ||
+		    group2 != 0 ||
+		    group3 != 0 ||
+		    group4 != 0)
+			/* VEX-encoded instructions are not allowed to be preceeded by legacy prefixes */
+		{
+			error = true;
+			error_opcode = true;
+		}
+
+		if (has_rex)
+			/* VEX-encoded instructions are not allowed to have REX either */
+		{
+			error = true;
+			error_opcode = true;
+		}
+
+
+		uint8_t prefix = bytes[cursor++];
+
+		if (prefix == 0x62)
+			/* this is a 4 byte VEX */
+		{
+			vex_size = 4;
+
+
+			uint8_t vex_1 = bytes[cursor++];
+			uint8_t vex_2 = bytes[cursor++];
+			uint8_t vex_3 = bytes[cursor++];
+
+			/* R, X, B, R' and V' are inverted, as in VEX */
+			vex_r = vex_1 & 0x80 ? false : true;
+			vex_x = vex_1 & 0x40 ? false : true;
+			vex_b = vex_1 & 0x20 ? false : true;
+
+			vex_decode_mm(vex_1 & 0x03);
+
+
+			vex_w = vex_2 & 0x80 ? true : false;
+
+			vex_decode_pp(vex_2 & 0x03);
+
+			vex_l    = (vex_3 >> 5) & 0x03;
+			vex_sae  = vex_rc = vex_broadcast = vex_3 & 0x10 ? true : false;
+
+			if (mask & fields::vex)
+			{
+				vex_rr = vex_1 & 0x10 ? false : true;
+
+				/* determine destination register from V'vvvv */
+				vex_reg = ((~vex_2 >> 3) & 0x0f) | (vex_3 & 0x08 ? 0 : 0x10);
+
+				vex_zero   = vex_3 & 0x80 ? true : false;
+				vex_opmask = vex_3 & 0x07;
+			}
+
+			if (vex_rc)
+				/* rounding control, implies vector is 512 bits wide */
+			{
+				vex_round = vex_l;
+				vex_l     = 0x02;
+			}
+			else if (vex_l == 0x03)
+				/* destination vector can't be wider than 512 bits */
+			{
+				error = true;
+				error_operand = true;
+			}
+		}
+		else
+			/* 2 or 3 byte VEX */
+		{
+			if (prefix == 0xc4)
+				/* this is a 3 byte VEX */
+			{
+				vex_size = 3;
+
+
+				uint8_t vex_1 = bytes[cursor++];
+
+				vex_r = vex_1 & 0x80 ? false : true;
+				vex_x = vex_1 & 0x40 ? false : true;
+				vex_b = vex_1 & 0x20 ? false : true;
+
+				vex_decode_mm(vex_1 & 0x1f);
+			}
+			else
+				/* this is a 2 byte VEX */
+			{
+				vex_size = 2;
+				opcode1  = 0x0f;
+			}
+
+
+			uint8_t vex_2 = bytes[cursor++];
+
+			if (prefix == 0xc4)
+			{
+				vex_w = vex_2 & 0x80 ? true : false;
+			}
+			else
+			{
+				vex_r = vex_2 & 0x80 ? false : true;
+			}
+
+			vex_l = vex_2 & 0x04 ? 1 : 0;
+
+			if (mask & fields::vex)
+				/* determine destination register from vvvv */
+			{
+				vex_reg = (~vex_2 >> 3) & 0x0f;
+			}
+
+			vex_decode_pp(vex_2 & 0x03);
+		}
+
+		if (x64)
+			/* VEX extends registers the same way REX does */
+		{
+			rex_w = vex_w;
+			rex_r = vex_r;
+			rex_x = vex_x;
+			rex_b = vex_b;
+		}
+
+		if (opcode1 == 0x0f)
+			/* the opcode byte follows VEX, opcode2 holds the map */
+		{
+			decode_0f(opcode2);
+		}
+	}
+	else
+		/* instruction operands are written normal way */
+	{
+		opcode1 = bytes[cursor++];
+
+		if (opcode1 == 0x0f)
+		{
+			if (bytes[cursor] == 0x38 || bytes[cursor] == 0x3a)
+				/* 3 byte opcode */
+			{
+				opcode2 = bytes[cursor++];
+			}
+
+			decode_0f(opcode2);
+		}
+		else
+			/* this is a regular single opcode instruction */
+		{
+			flags = lookup(op::cls::table, opcode1);
+		}
+	}
+
+	if (flags & op::vx && !has_vex)
+		/* this instruction can only be VEX-encoded */
+	{
+		error = true;
+		error_novex = true;
+	}
+
+	if (opcode1 == 0xf6 || opcode1 == 0xf7)
+		/*
+		* These are two exceptional opcodes that extend
+		* using 3 bits of Mod R/M byte and they lack
+		* consistent flags. Instead of creating a new
+		* flags table for each extended opcode, I decided
+		* to put this little bit of code that is dedicated
+		* to these two exceptional opcodes.
+		*/
+	{
+		switch (bytes[cursor] >> 3 & 0x07)
+		{
+		case 0x00:
+		case 0x01:
+			{
+				if (opcode1 == 0xf6)
+					flags = op::ex | op::i8;
+
+				if (opcode1 == 0xf7)
+					flags = op::ex | op::i32;
+			}
+			break;
+
+		default:
+			flags = op::rm;
+			break;
+		}
+	}
+}
+
+/* -- reads the opcode byte following 0F, 0F 38 or 0F 3A ------------------- */
+template <bool x64>
+inline void ssde_x86_engine<x64>::decode_0f(uint8_t map)
+{
+	switch (map)
+	{
+	case 0x38:
+		opcode3 = bytes[cursor++];
+		flags   = lookup(op::cls::table_38, opcode3);
+		break;
+
+	case 0x3a:
+		opcode3 = bytes[cursor++];
+		flags   = lookup(op::cls::table_3a, opcode3);
+		break;
+
+	default:
+		opcode2 = bytes[cursor++];
+		flags   = lookup(op::cls::table_0f, opcode2);
+		break;
+	}
+}
+
+/* -- decodes a Mod R/M byte ----------------------------------------------- */
+template <bool x64>
+template <unsigned mask>
+inline void ssde_x86_engine<x64>::decode_modrm()
+{
+	uint8_t modrm_byte = bytes[cursor++];
+	uint8_t mod        = modrm_byte >> 6 & 0x03;
+	uint8_t rm         = modrm_byte      & 0x07;
+
+	/* 67 prefix turns on 16 bit addressing, in 64 bit mode it's 32 bit one */
+	bool addr16 = !x64 && group4 == p_67;
+
+	has_modrm = true;
+
+	if (mask & fields::modrm)
+	{
+		modrm_mod = mod;
+		modrm_reg = modrm_byte >> 3 & 0x07;
+		modrm_rm  = rm;
+	}
+
+	switch (mod)
+	{
+	case 0x00:
+		if (addr16)
+		{
+			if (rm == 0x06)
+			{
+				has_disp  = true;
+				disp_size = 2;
+			}
+		}
+		else
+		{
+			if (rm == 0x04)
+			{
+				has_sib = true;
+
+				if ((bytes[cursor] & 0x07) == 0x05)
+					/* SIB base 5 takes disp32 instead of a base register */
+				{
+					has_disp  = true;
+					disp_size = 4;
+				}
+			}
+
+			if (rm == 0x05)
+			{
+				has_disp  = true;
+				disp_size = 4;
+			}
+		}
+		break;
+
+	case 0x01:
+		{
+			if (!addr16 && rm == 0x04)
+				has_sib = true;
+
+			has_disp  = true;
+			disp_size = 1;
+		}
+		break;
+
+	case 0x02:
+		{
+			if (!addr16 && rm == 0x04)
+				has_sib = true;
+
+			has_disp  = true;
+			disp_size = !addr16 ? 4 : 2;
+		}
+		break;
+
+	case 0x03:
+		if (group1 == p_lock)
+			/* LOCK prefix is not allowed to be used with Mod R */
+		{
+			error = true;
+			error_lock = true;
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+/* -- decodes SIB byte ----------------------------------------------------- */
+template <bool x64>
+template <unsigned mask>
+inline void ssde_x86_engine<x64>::decode_sib()
+{
+	uint8_t sib_byte = bytes[cursor++];
+
+	if (mask & fields::sib)
+	{
+		sib_scale = 1 << (sib_byte >> 6 & 0x03);
+		sib_index = sib_byte >> 3 & 0x07;
+		sib_base  = sib_byte      & 0x07;
+	}
+}
+
+/* -- decodes a moffs, imm or rel operand ---------------------------------- */
+template <bool x64>
+template <unsigned mask>
+inline void ssde_x86_engine<x64>::decode_imm()
+{
+	if (flags & op::am)
+		/* address mode instructions behave a little differently */
+	{
+		has_imm  = true;
+
+		if (x64)
+			imm_size = group4 != p_67 ? 8 : 4;
+		else
+			imm_size = group4 != p_67 ? 4 : 2;
+	}
+	else
+	{
+		if (flags & op::i32)
+		{
+			has_imm  = true;
+			imm_size = x64 && rex_w ? ((flags & op::rw) ? 8 : 4) : group3 != p_66 ? 4 : 2;
+		}
+
+		if (flags & op::i16)
+		{
+			if (has_imm)
+			{
+				has_imm2  = true;
+				imm2_size = 2;
+			}
+			else
+			{
+				has_imm  = true;
+				imm_size = 2;
+			}
+		}
+
+		if (flags & op::i8)
+		{
+			if (has_imm)
+			{
+				has_imm2  = true;
+				imm2_size = 1;
+			}
+			else
+			{
+				has_imm  = true;
+				imm_size = 1;
+			}
+		}
+	}
+
+	if (has_imm && !(mask & (fields::imm | fields::rel)))
+		/* operand values weren't asked for, skip them */
+	{
+		cursor += has_imm2 ? imm_size + imm2_size : imm_size;
+	}
+	else if (has_imm)
+	{
+		imm = load(bytes + cursor, imm_size);
+		cursor += imm_size;
+
+
+		if (has_imm2)
+		{
+			imm2 = static_cast<uint16_t>(load(bytes + cursor, imm2_size));
+			cursor += imm2_size;
+		}
+	}
+
+	if (flags & op::rel)
+		/* this instruction has relative address, move imm to rel */
+	{
+		has_imm = false;
+
+		rel_size = imm_size;
+
+		if (mask & fields::rel)
+		{
+			rel = static_cast<uint32_t>(imm);
+
+			if (rel & (1 << (rel_size*8 - 1)))
+				/* rel is signed, extend the sign if needed */
+			{
+				switch (rel_size)
+				{
+				case 1:
+					rel |= 0xffffff00;
+					break;
+
+				case 2:
+					rel |= 0xffff0000;
+					break;
+
+				default:
+					break;
+				}
+			}
+
+			if (x64)
+				abs = origin + ip + cursor + rel;
+			else
+				abs = static_cast<uint32_t>(origin + ip + cursor + rel);
+		}
+		else
+			/* imm was only read for imm, abs shares it and is left cleared */
+		{
+			imm = 0;
+		}
+
+		has_rel = true;
+	}
+}
+
+/* -- decode SIMD prefix from pp field of VEX ------------------------------ */
+template <bool x64>
+inline void ssde_x86_engine<x64>::vex_decode_pp(uint8_t pp)
+{
+	switch (pp)
+	{
+	case 0x01:
+		group3 = p_66;
+		break;
+
+	case 0x02:
+		group1 = p_repz;
+		break;
+
+	case 0x03:
+		group1 = p_repnz;
+		break;
+
+	default:
+		break;
+	}
+}
+
+/* -- determine opcode bytes from mm field of VEX -------------------------- */
+template <bool x64>
+inline void ssde_x86_engine<x64>::vex_decode_mm(uint8_t mm)
+{
+	switch (mm)
+	{
+	case 0x01:
+		opcode1 = 0x0f;
+		break;
+
+	case 0x02:
+		opcode1 = 0x0f;
+		opcode2 = 0x38;
+		break;
+
+	case 0x03:
+		opcode1 = 0x0f;
+		opcode2 = 0x3a;
+		break;
+
+	default:
+		error = true;
+		error_opcode = true;
+		break;
+	}
+}
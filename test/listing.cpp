@@ -0,0 +1,148 @@
+/*
+* Listing tests for SSDE (http://github.com/notnanocat/ssde): text of
+* every instruction of a checked-in object, against objdump -d of it.
+* This file is not a subject to license, feel free to use it in any way
+* You wish.
+*
+*   listing [object expected.intel.txt expected.att.txt]
+*
+* Objects default to listing64.o and listing32.o, their expected text
+* to the .intel.txt and .att.txt next to them. That is the output of
+*
+*   objdump -d -w [-M intel] object | tail -n +8
+*
+* with branch targets written as SSDE writes them, 0x1c rather than
+* 1c <.text+0x1c>. Every line that differs is printed, the exit code is
+* 1 if there is any.
+*/
+#include "../ssde/ssde_x86.hpp"
+#include "../ssde/ssde_x64.hpp"
+#include "../ssde/ssde_file.hpp"
+#include "../ssde/ssde_format.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdio>
+
+using namespace std;
+
+
+static const size_t max_length = 15;    // Longest X86 instruction, in bytes.
+
+
+/* -- objdump's line of an instruction, without the padding of bytes ------ */
+static string line_of(uint64_t address, const char *bytes, const char *text)
+{
+	char prefix[32];
+
+	snprintf(prefix, sizeof(prefix), "%4llx:\t", static_cast<unsigned long long>(address));
+
+	return string(prefix) + bytes + "\t" + text;
+}
+
+static string strip_padding(const string &line)
+{
+	size_t tab  = line.find('\t');
+	size_t text = tab == string::npos ? string::npos : line.find('\t', tab + 1);
+
+	if (text == string::npos)
+		return line;
+
+	size_t end = line.find_last_not_of(' ', text - 1);
+
+	return line.substr(0, end + 1) + line.substr(text);
+}
+
+template <class arch>
+static void list_sections(const ssde_file &file, uint8_t syntax, vector<string> &lines)
+{
+	for (const ssde_section &section : file.sections)
+	{
+		for (arch dis(section.image()); dis.dec(); dis.next())
+		{
+			char bytes[3 * max_length + 1];
+			char text[ssde_format::max_text];
+
+			ssde_format::bytes(section.data + dis.ip, std::min<size_t>(dis.length, section.size - dis.ip), bytes, sizeof(bytes));
+			ssde_format::format(dis, text, sizeof(text), syntax);
+
+			lines.push_back(line_of(section.address + dis.ip, bytes, text));
+		}
+	}
+}
+
+static int check(const string &object, const string &expected, uint8_t syntax)
+{
+	ssde_file file;
+
+	if (!file.open(object.c_str()))
+	{
+		cout << object << ": can't be read" << endl;
+		return 1;
+	}
+
+	ifstream in(expected);
+
+	if (!in)
+	{
+		cout << expected << ": can't be read" << endl;
+		return 1;
+	}
+
+	vector<string> lines;
+
+	if (file.x64)
+		list_sections<ssde_x64>(file, syntax, lines);
+	else
+		list_sections<ssde_x86>(file, syntax, lines);
+
+	int    failed = 0;
+	size_t i      = 0;
+
+	for (string line; getline(in, line); ++i)
+	{
+		string want = strip_padding(line);
+		string got  = i < lines.size() ? lines[i] : string("(nothing)");
+
+		if (want != got)
+		{
+			cout << expected << ":" << i + 1 << endl << "  objdump: " << want << endl << "  ssde:    " << got << endl;
+			++failed;
+		}
+	}
+
+	for (; i < lines.size(); ++i)
+	{
+		cout << expected << ": " << lines[i] << " is not expected" << endl;
+		++failed;
+	}
+
+	cout << expected << ": " << (failed == 0 ? "passed" : "failed") << endl;
+
+	return failed == 0 ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+	vector<string> objects;
+
+	if (argc > 1)
+		objects.push_back(argv[1]);
+	else
+		objects = { "listing64.o", "listing32.o" };
+
+	int failed = 0;
+
+	for (const string &object : objects)
+	{
+		string base = object.substr(0, object.rfind('.'));
+
+		failed += check(object, argc > 2 ? argv[2] : base + ".intel.txt", ssde_format::syntax_intel);
+		failed += check(object, argc > 3 ? argv[3] : base + ".att.txt", ssde_format::syntax_att);
+	}
+
+	return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,27 @@
+# Instructions of X86 whose text once differed from that of objdump,
+# assembled into listing32.o; listing32.intel.txt and listing32.att.txt
+# are objdump -d -w of it. See listing.cpp.
+	.text
+	.intel_syntax noprefix
+	fwait
+	into
+	xabort 0x3
+	xbegin 1f
+	xend
+1:	.byte 0xf3, 0xc3
+	.byte 0x2e, 0x74, 0x00
+	.byte 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00
+	.byte 0x66, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00
+	.byte 0x66, 0x90
+	.byte 0x2e, 0x8b, 0x00
+	.byte 0x2e, 0x40
+	.byte 0x26, 0xa5
+	rep stosd
+	movsw
+	.byte 0x67, 0xa4
+	fadd st, st(1)
+	faddp st(1), st
+	prefetcht1 [esi]
+	ldmxcsr [edx]
+	lea eax, [ebx-0x10]
+	ret
@@ -0,0 +1,68 @@
+# Instructions of X86-64 whose text once differed from that of objdump,
+# assembled into listing64.o; listing64.intel.txt and listing64.att.txt
+# are objdump -d -w of it. See listing.cpp.
+	.text
+	.intel_syntax noprefix
+	fwait
+	xabort 0xff
+	xbegin 1f
+	.byte 0x66, 0xc7, 0xf8, 0x00, 0x00
+	xend
+1:	.byte 0xf3, 0xc3
+	.byte 0xf3, 0xeb, 0x00
+	.byte 0x2e, 0x74, 0x00
+	.byte 0x3e, 0x0f, 0x85, 0x00, 0x00, 0x00, 0x00
+	.byte 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00
+	.byte 0x66, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00
+	.byte 0x66, 0x90
+	.byte 0x66, 0x66, 0x90
+	.byte 0x2e, 0x48, 0x8b, 0x00
+	.byte 0x64, 0x48, 0x8b, 0x00
+	.byte 0x3e, 0xff, 0xe0
+	.byte 0x2e, 0xff, 0x10
+	.byte 0x66, 0x48, 0x8d, 0x3d, 0x00, 0x00, 0x00, 0x00
+	.byte 0x66, 0x66, 0x48, 0xe8, 0x00, 0x00, 0x00, 0x00
+	rep stosd
+	rep stosq
+	rep movsb
+	movsq
+	.byte 0x64, 0xa5
+	lodsb
+	scasb
+	repe cmpsw
+	repne scasb
+	insb
+	outsd
+	.byte 0x67, 0xa4
+	fadd st, st(1)
+	fmul st, st(0)
+	faddp st(1), st
+	fsubrp st(1), st
+	fucomip st, st(1)
+	fcmovb st, st(2)
+	fxch st(1)
+	prefetcht0 [rsi+0x40]
+	prefetchw [rax]
+	clflush [rax]
+	ldmxcsr [rdx+0x1c0]
+	stmxcsr [rdi+0x1c0]
+	fxsave [rax]
+	lea rax, [rip-0x20]
+	mov eax, DWORD PTR [rip-0x10]
+	shlx ecx, ecx, r8d
+	adcx eax, ebx
+	push 0x10
+	.byte 0x66, 0x6a, 0x10
+	.byte 0x66, 0x48, 0x05, 0x00, 0x01, 0x00, 0x00
+	vaddps zmm1, zmm2, ZMMWORD PTR [rax+0x80]
+	vaddps zmm1, zmm2, DWORD BCST [rax+0x8]
+	vaddps zmm1, zmm2, zmm3, {rn-sae}
+	vrndscaleps zmm1, zmm2, {sae}, 3
+	vcvtsi2ss xmm1, xmm2, {rz-sae}, rax
+	vcmpps k1, zmm2, zmm3, {sae}, 1
+	vpcompressd ZMMWORD PTR [rax+0x8]{k1}, zmm1
+	vgatherdpd zmm1{k1}, QWORD PTR [rax+ymm2*8+0x40]
+	vpsllw zmm1, zmm2, XMMWORD PTR [rax+0x10]
+	vcvtps2pd zmm1, YMMWORD PTR [rax+0x20]
+	vfmadd231sd xmm1, xmm2, QWORD PTR [rax+0x8]
+	ret
@@ -0,0 +1,127 @@
+/*
+* Operand tests for SSDE (http://github.com/notnanocat/ssde): text of
+* single X64 instructions in both syntaxes, against that of objdump -d.
+* This file is not a subject to license, feel free to use it in any way
+* You wish.
+*
+*   operands
+*
+* Cases are those where operands were once wrong: 66 as VEX pp or a part
+* of the opcode rather than an operand size override, and EVEX disp8 in
+* units of the memory accessed. Every mismatch is printed, the exit code
+* is the number of them.
+*/
+#include "../ssde/ssde_x86.hpp"
+#include "../ssde/ssde_x64.hpp"
+#include "../ssde/ssde_format.hpp"
+
+#include <iostream>
+#include <cstring>
+
+using namespace std;
+
+
+struct operands_case
+{
+	uint8_t     code[15];
+	size_t      size;
+	const char *intel;                      // objdump -d -M intel
+	const char *att;                        // objdump -d
+};
+
+static const operands_case cases[] =
+{
+	/* 66 is VEX pp of SHLX, SARX is F3 and SHRX is F2 */
+	{ { 0xc4, 0xe2, 0x39, 0xf7, 0xc9 }, 5,
+	  "shlx   ecx,ecx,r8d",
+	  "shlx   %r8d,%ecx,%ecx" },
+	{ { 0xc4, 0xe2, 0x3a, 0xf7, 0xc9 }, 5,
+	  "sarx   ecx,ecx,r8d",
+	  "sarx   %r8d,%ecx,%ecx" },
+	{ { 0xc4, 0xe2, 0x3b, 0xf7, 0xc9 }, 5,
+	  "shrx   ecx,ecx,r8d",
+	  "shrx   %r8d,%ecx,%ecx" },
+	{ { 0xc4, 0xe2, 0xb1, 0xf7, 0x43, 0x10 }, 6,
+	  "shlx   rax,QWORD PTR [rbx+0x10],r9",
+	  "shlx   %r9,0x10(%rbx),%rax" },
+	{ { 0xc4, 0xe2, 0x6a, 0xf7, 0x03 }, 5,
+	  "sarx   eax,DWORD PTR [rbx],edx",
+	  "sarx   %edx,(%rbx),%eax" },
+	{ { 0xc4, 0x42, 0x9b, 0xf7, 0xd3 }, 5,
+	  "shrx   r10,r11,r12",
+	  "shrx   %r12,%r11,%r10" },
+
+	/* 66 is a part of ADCX, and an operand size override of MOV */
+	{ { 0x66, 0x0f, 0x38, 0xf6, 0xc3 }, 5,
+	  "adcx   eax,ebx",
+	  "adcx   %ebx,%eax" },
+	{ { 0x66, 0x89, 0xd8 }, 3,
+	  "mov    ax,bx",
+	  "mov    %bx,%ax" },
+	{ { 0x6a, 0x10 }, 2,
+	  "push   0x10",
+	  "push   $0x10" },
+
+	/* disp8 of VEX is in bytes, of EVEX in units of N */
+	{ { 0x62, 0xf1, 0x6c, 0x48, 0x58, 0x48, 0x02 }, 7,
+	  "vaddps zmm1,zmm2,ZMMWORD PTR [rax+0x80]",
+	  "vaddps 0x80(%rax),%zmm2,%zmm1" },
+	{ { 0xc5, 0xec, 0x58, 0x48, 0xc0 }, 5,
+	  "vaddps ymm1,ymm2,YMMWORD PTR [rax-0x40]",
+	  "vaddps -0x40(%rax),%ymm2,%ymm1" },
+	{ { 0xc5, 0xea, 0x58, 0x48, 0x08 }, 5,
+	  "vaddss xmm1,xmm2,DWORD PTR [rax+0x8]",
+	  "vaddss 0x8(%rax),%xmm2,%xmm1" },
+	{ { 0x62, 0xf2, 0x7d, 0x49, 0x8b, 0x48, 0x02 }, 7,
+	  "vpcompressd ZMMWORD PTR [rax+0x8]{k1},zmm1",
+	  "vpcompressd %zmm1,0x8(%rax){%k1}" },
+	{ { 0x62, 0xf2, 0xfd, 0x49, 0x92, 0x4c, 0xd0, 0x08 }, 8,
+	  "vgatherdpd zmm1{k1},QWORD PTR [rax+ymm2*8+0x40]",
+	  "vgatherdpd 0x40(%rax,%ymm2,8),%zmm1{%k1}" },
+	{ { 0x62, 0xf1, 0x6d, 0x48, 0xf1, 0x48, 0x01 }, 7,
+	  "vpsllw zmm1,zmm2,XMMWORD PTR [rax+0x10]",
+	  "vpsllw 0x10(%rax),%zmm2,%zmm1" },
+	{ { 0xc4, 0xe2, 0xe9, 0xb9, 0x48, 0x08 }, 6,
+	  "vfmadd231sd xmm1,xmm2,QWORD PTR [rax+0x8]",
+	  "vfmadd231sd 0x8(%rax),%xmm2,%xmm1" },
+};
+
+
+static int check(const operands_case &c, uint8_t syntax, const char *expected)
+{
+	char text[ssde_format::max_text];
+
+	ssde_x64 dis(c.code, c.size);
+
+	if (!dis.dec() || dis.length != c.size)
+		/* not a single instruction of all the bytes */
+	{
+		cout << expected << ": length " << static_cast<int>(dis.length) << " of " << c.size << endl;
+		return 1;
+	}
+
+	ssde_format::format(dis, text, sizeof(text), syntax);
+
+	if (strcmp(text, expected) != 0)
+	{
+		cout << expected << ": " << text << endl;
+		return 1;
+	}
+
+	return 0;
+}
+
+int main()
+{
+	int failed = 0;
+
+	for (const operands_case &c : cases)
+	{
+		failed += check(c, ssde_format::syntax_intel, c.intel);
+		failed += check(c, ssde_format::syntax_att, c.att);
+	}
+
+	cout << sizeof(cases) / sizeof(cases[0]) * 2 - failed << " of " << sizeof(cases) / sizeof(cases[0]) * 2 << " passed" << endl;
+
+	return failed;
+}